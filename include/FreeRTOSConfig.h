@@ -101,6 +101,102 @@ extern "C"
 /* 1: 使能互斥锁, 默认: 0 */
 #define configUSE_MUTEXES 1
 
+/* 1: 使能链式优先级继承, 互斥锁持有者阻塞在另一个互斥锁上时, 沿持有者链继续传递优先级, 默认: 0 */
+#define configUSE_PRIORITY_INHERITANCE_CHAIN 0
+
+/* 链式优先级继承一次最多提升的任务个数(包括直接持有者), 默认: 4 */
+#define configMAX_PRIORITY_INHERITANCE_CHAIN_DEPTH 4
+
+/* 1: 使能任务组, 在一个临界区内挂起、恢复组内所有任务或调整它们的优先级, 默认: 0 */
+#define configUSE_TASK_GROUPS 0
+
+/* 1: 使能按比例分配调度, configPROPORTIONAL_SHARE_PRIORITY 优先级的任务按权重分配 CPU 周期, 不再轮流执行, 默认: 0 */
+#define configUSE_PROPORTIONAL_SHARE 0
+
+/* 按比例分配调度所在的优先级 */
+#define configPROPORTIONAL_SHARE_PRIORITY 1
+
+/* 新任务的默认权重, 取值 1 ~ 4096, 默认: 100 */
+#define configPROPORTIONAL_SHARE_DEFAULT_WEIGHT 100
+
+/* 任务阻塞后最多可补偿的 CPU 周期数, 默认: 一个时钟节拍的周期数 */
+#define configPROPORTIONAL_SHARE_MAX_CREDIT (configCPU_CLOCK_HZ / configTICK_RATE_HZ)
+
+/* 1: 使能时间触发调度, 任务按静态调度表在主帧内的固定偏移处释放, 其余时间按优先级调度, 默认: 0 */
+#define configUSE_TIME_TRIGGERED_SCHEDULE 0
+
+/* 时间触发调度表最多的槽数, 默认: 16 */
+#define configTIME_TRIGGERED_MAX_SLOTS 16
+
+/* 1: 使能时间分区调度, 主帧分成若干窗口, 每个窗口内只运行所属分区的任务, 空闲时间交给后台分区 0, 默认: 0 */
+#define configUSE_TIME_PARTITIONS 0
+
+/* 时间分区的个数, 包括后台分区 0, 默认: 4 */
+#define configNUM_PARTITIONS 4
+
+/* 1: 使能 RCU (读-复制-更新), 读者进出读临界区不写共享数据, 由回收任务在宽限期结束后执行回调, 默认: 0 */
+#define configUSE_RCU 0
+
+/* RCU 回收任务的优先级, 默认: 1 */
+#define configRCU_TASK_PRIORITY 1
+
+/* RCU 回收任务的栈空间大小, 默认: configMINIMAL_STACK_SIZE */
+#define configRCU_TASK_STACK_DEPTH configMINIMAL_STACK_SIZE
+
+/* 1: 使能栈分层, 长时间未运行任务的栈写回慢速内存, 运行时换入共享的 DTCM 栈槽, 默认: 0 */
+#define configUSE_STACK_TIERING 0
+
+/* DTCM 栈槽的个数, 默认: 4 */
+#define configSTACK_TIER_SLOTS 4
+
+/* 每个栈槽的大小, 单位: 字, 必须是偶数, 默认: configMINIMAL_STACK_SIZE */
+#define configSTACK_TIER_SLOT_DEPTH configMINIMAL_STACK_SIZE
+
+/* 任务切出多少个时钟节拍后由空闲任务把栈写回慢速内存, 默认: 1000 */
+#define configSTACK_TIER_WRITE_BACK_TICKS 1000
+
+/* 1: 时钟节拍中断只记录节拍并挂起 PendSV, 延时列表在 PendSV 中分批处理, 批与批之间开中断, 默认: 0 */
+#define configUSE_DEFERRED_TICK_PROCESSING 0
+
+/* 处理延时节拍时每个临界区内最多唤醒的任务数, 默认: 1 */
+#define configDEFERRED_TICK_UNBLOCK_BATCH 1
+
+/* 1: 使能软中断, 在 PendSV 中按优先级运行的无栈延后函数, 默认: 0 */
+#define configUSE_SWI 0
+
+/* 软中断优先级的个数, 即软中断的个数, 最大 32, 默认: 8 */
+#define configSWI_MAX_PRIORITIES 8
+
+/* 1: 使能 vPortFreeFromISR, 中断中释放的内存块先挂入无锁链表, 由下次 pvPortMalloc/vPortFree 或空闲任务归还堆, 默认: 0 */
+#define configUSE_HEAP_DEFERRED_FREE 0
+
+/* 1: 使能 ulTaskNotifyWaitBits, 通知方检查任务等待的位, 条件满足才唤醒任务, 默认: 0 */
+#define configUSE_TASK_NOTIFY_WAIT_BITS 0
+
+/* 1: 使能 I/O 环, 任务向提交队列提交操作, 驱动在中断中把完成写入流缓冲区, 任务一次等待多个完成, 默认: 0 */
+#define configUSE_IO_RING 0
+
+/* 1: 使能唤醒延迟压力测试, 周期任务在合成负载下测量从节拍到运行的周期数并统计直方图, 默认: 0 */
+#define configUSE_LATENCY_SOAK 0
+
+/* 唤醒延迟压力测试的测量任务个数上限, 默认: 4 */
+#define configLATENCY_SOAK_MAX_TASKS 4
+
+/* 唤醒延迟直方图的桶数, 默认: 64 */
+#define configLATENCY_SOAK_HISTOGRAM_BINS 64
+
+/* 1: 使能最坏延迟搜索, 以模糊测试的方式变异负载参数, 保留使延迟变大的场景, 最后输出最小复现场景, 需要 configUSE_LATENCY_SOAK, 默认: 0 */
+#define configUSE_LATENCY_SEARCH 0
+
+/* 最坏延迟搜索保留的场景个数, 默认: 8 */
+#define configLATENCY_SEARCH_CORPUS_SIZE 8
+
+/* 1: 使能自适应节拍, 只有一个任务就绪且节拍前没有调度决策时推迟节拍中断到下一个任务解除阻塞, 不能与延迟节拍处理和节拍钩子同时使用, 默认: 0 */
+#define configUSE_ADAPTIVE_TICK 0
+
+/* 1: 使能截止期定时器, 与阻塞任务一起放在延时链表中, 回调在节拍中断中直接运行, 默认: 0 */
+#define configUSE_DEADLINE_TIMERS 0
+
 /* 1: 使能递归互斥锁, 默认: 0 */
 #define configUSE_RECURSIVE_MUTEXES 1
 
@@ -116,6 +212,69 @@ extern "C"
 /* 1: 使能队列集, 默认: 0 */
 #define configUSE_QUEUE_SETS 1
 
+/* 1: 队列阻塞时在同一个临界区内完成超时检查、加入事件列表和任务切换, 不挂起调度器也不锁队列, 默认: 0 */
+#define configUSE_QUEUE_SINGLE_CRITICAL_BLOCKING 0
+
+/* 1: 队列存储区为 2 的幂字节时用掩码回绕读写位置, 并在创建时按条目大小(4/8/16 字节)选择拷贝函数, 默认: 0 */
+#define configUSE_QUEUE_POW2_STORAGE 0
+
+/* 1: 使能弹性队列, 队列满时从共享段池借用溢出段, 排空后归还, 默认: 0 */
+#define configUSE_QUEUE_ELASTIC 0
+
+/* 弹性队列溢出段的大小, 单位: Byte, 默认: 64 */
+#define configQUEUE_ELASTIC_SEGMENT_SIZE 64
+
+/* 弹性队列共享段池中溢出段的个数, 默认: 16 */
+#define configQUEUE_ELASTIC_POOL_SEGMENTS 16
+
+/* 1: 使能数据包缓冲区(pbuf), 由固定大小的段组成链, 预留头部空间, 添加或去掉协议头时无需拷贝数据, 默认: 0 */
+#define configUSE_PACKET_BUFFERS 0
+
+/* 数据包缓冲区每个段的存储区大小, 单位: Byte, 最大 65535, 默认: 256 */
+#define configPACKET_BUFFER_SEGMENT_SIZE 256
+
+/* 数据包缓冲区池中段的个数, 默认: 32 */
+#define configPACKET_BUFFER_POOL_SEGMENTS 32
+
+/* 1: 内核的数据拷贝和填充(队列、流缓冲区、堆)使用移植层针对 Cortex-M7 优化的函数, 不使用 C 库的 memcpy/memset, 默认: 0 */
+#define configUSE_PORT_OPTIMISED_COPY 0
+
+/* 流缓冲区和消息缓冲区中不小于该字节数的拷贝交给 DMA 完成, 调用任务阻塞等待, 需实现 xPortCopyOffloadStart, 0: 不使用 DMA, 默认: 0 */
+#define configCOPY_OFFLOAD_THRESHOLD 0
+
+/* 1: 按拷贝长度分段统计内核拷贝的次数和字节数, 默认: 0 */
+#define configGENERATE_COPY_STATS 0
+
+/* 1: 用 DWT 周期计数器测量移植层的任务切换(PendSV)、临界区和时钟节拍中断的执行周期数, 默认: 0 */
+#define configGENERATE_PORT_PROFILE 0
+
+/* 1: 使能 kernel_inline.h, 以内联函数直接读取节拍计数、当前任务、调度器状态、队列和流缓冲区的数据量, 不调用函数也不进入临界区, 默认: 0 */
+#define configUSE_INLINE_KERNEL_QUERIES 0
+
+/* 1: 使能飞行记录器, 始终记录最近的内核事件, 满足触发条件后再记录一段事件然后冻结, 供事后读取分析, 默认: 0 */
+#define configUSE_FLIGHT_RECORDER 0
+
+/* 飞行记录器保存的事件个数, 必须是 2 的幂, 默认: 64 */
+#define configFLIGHT_RECORDER_LENGTH 64
+
+/* 触发后继续记录的事件个数, 默认: configFLIGHT_RECORDER_LENGTH / 4 */
+#define configFLIGHT_RECORDER_POST_TRIGGER_EVENTS 16
+
+/* 任务从就绪到运行的延迟超过该 CPU 周期数时触发, 0: 不触发, 默认: 0 */
+#define configFLIGHT_RECORDER_READY_LATENCY_CYCLES 0
+
+/* 临界区长度超过该 CPU 周期数时触发, 0: 不触发, 默认: 0 */
+#define configFLIGHT_RECORDER_CRITICAL_SECTION_CYCLES 0
+
+/* 1: 队列满导致发送失败时触发, 默认: 0 */
+#define configFLIGHT_RECORDER_TRIGGER_ON_QUEUE_FULL 0
+
+/* 1: 堆内存申请失败时触发, 默认: 1 */
+#define configFLIGHT_RECORDER_TRIGGER_ON_MALLOC_FAILED 1
+
+/* 1: xTaskDelayUntil 发现唤醒时间已过(错过周期)时触发, 默认: 1 */
+#define configFLIGHT_RECORDER_TRIGGER_ON_DEADLINE_MISSED 1
+
 /* 1: 使能时间片调度, 默认: 1 */
 #define configUSE_TIME_SLICING 1
 
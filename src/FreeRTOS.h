@@ -393,6 +393,53 @@
     #define portPOINTER_SIZE_TYPE    uint32_t
 #endif
 
+#ifndef configUSE_FLIGHT_RECORDER
+    #define configUSE_FLIGHT_RECORDER    0
+#endif
+
+#if ( configUSE_FLIGHT_RECORDER == 1 )
+    #ifndef configFLIGHT_RECORDER_LENGTH
+        #define configFLIGHT_RECORDER_LENGTH    64
+    #endif
+
+    #if ( ( configFLIGHT_RECORDER_LENGTH < 2 ) || ( ( configFLIGHT_RECORDER_LENGTH & ( configFLIGHT_RECORDER_LENGTH - 1 ) ) != 0 ) )
+        #error configFLIGHT_RECORDER_LENGTH must be a power of 2.
+    #endif
+
+/* By default a quarter of the history is kept for events after the trigger. */
+    #ifndef configFLIGHT_RECORDER_POST_TRIGGER_EVENTS
+        #define configFLIGHT_RECORDER_POST_TRIGGER_EVENTS    ( configFLIGHT_RECORDER_LENGTH / 4 )
+    #endif
+
+    #if ( configFLIGHT_RECORDER_POST_TRIGGER_EVENTS >= configFLIGHT_RECORDER_LENGTH )
+        #error configFLIGHT_RECORDER_POST_TRIGGER_EVENTS must be less than configFLIGHT_RECORDER_LENGTH.
+    #endif
+
+    #ifndef configFLIGHT_RECORDER_READY_LATENCY_CYCLES
+        #define configFLIGHT_RECORDER_READY_LATENCY_CYCLES    0
+    #endif
+
+    #ifndef configFLIGHT_RECORDER_CRITICAL_SECTION_CYCLES
+        #define configFLIGHT_RECORDER_CRITICAL_SECTION_CYCLES    0
+    #endif
+
+    #ifndef configFLIGHT_RECORDER_TRIGGER_ON_QUEUE_FULL
+        #define configFLIGHT_RECORDER_TRIGGER_ON_QUEUE_FULL    0
+    #endif
+
+    #ifndef configFLIGHT_RECORDER_TRIGGER_ON_MALLOC_FAILED
+        #define configFLIGHT_RECORDER_TRIGGER_ON_MALLOC_FAILED    1
+    #endif
+
+    #ifndef configFLIGHT_RECORDER_TRIGGER_ON_DEADLINE_MISSED
+        #define configFLIGHT_RECORDER_TRIGGER_ON_DEADLINE_MISSED    1
+    #endif
+
+/* The flight recorder is attached through the trace macros, so its header is
+ * included before the unused trace macros are removed below. */
+    #include "flight_recorder.h"
+#endif
+
 /* Remove any unused trace macros. */
 #ifndef traceSTART
 
@@ -603,6 +650,10 @@
     #define traceQUEUE_DELETE( pxQueue )
 #endif
 
+#ifndef traceQUEUE_ELASTIC_GROW
+    #define traceQUEUE_ELASTIC_GROW( pxQueue )
+#endif
+
 #ifndef traceTASK_CREATE
     #define traceTASK_CREATE( pxNewTCB )
 #endif
@@ -619,6 +670,12 @@
     #define traceTASK_DELAY_UNTIL( x )
 #endif
 
+#ifndef traceTASK_DELAY_UNTIL_MISSED
+
+/* Called when xTaskDelayUntil() finds the wake time has already passed. */
+    #define traceTASK_DELAY_UNTIL_MISSED( x )
+#endif
+
 #ifndef traceTASK_DELAY
     #define traceTASK_DELAY()
 #endif
@@ -873,6 +930,385 @@
     #define configUSE_QUEUE_SETS    0
 #endif
 
+#ifndef configUSE_QUEUE_SINGLE_CRITICAL_BLOCKING
+
+/* By default a blocking queue send or receive suspends the scheduler and locks
+ * the queue while the calling task is placed on the event list. */
+    #define configUSE_QUEUE_SINGLE_CRITICAL_BLOCKING    0
+#endif
+
+#ifndef configUSE_QUEUE_POW2_STORAGE
+
+/* By default queue items are copied with memcpy() and read and write positions
+ * wrap by comparison against the end of the storage area. */
+    #define configUSE_QUEUE_POW2_STORAGE    0
+#endif
+
+#ifndef configUSE_QUEUE_ELASTIC
+    #define configUSE_QUEUE_ELASTIC    0
+#endif
+
+#if ( configUSE_QUEUE_ELASTIC == 1 )
+    #ifndef configQUEUE_ELASTIC_SEGMENT_SIZE
+        #define configQUEUE_ELASTIC_SEGMENT_SIZE    64
+    #endif
+
+    #ifndef configQUEUE_ELASTIC_POOL_SEGMENTS
+        #define configQUEUE_ELASTIC_POOL_SEGMENTS    16
+    #endif
+#endif
+
+#ifndef configUSE_PRIORITY_INHERITANCE_CHAIN
+
+/* By default only the direct holder of a mutex inherits the priority of a task
+ * that blocks on the mutex. */
+    #define configUSE_PRIORITY_INHERITANCE_CHAIN    0
+#endif
+
+#if ( configUSE_PRIORITY_INHERITANCE_CHAIN == 1 )
+    #ifndef configMAX_PRIORITY_INHERITANCE_CHAIN_DEPTH
+        #define configMAX_PRIORITY_INHERITANCE_CHAIN_DEPTH    4
+    #endif
+
+    #if ( configUSE_MUTEXES != 1 )
+        #error configUSE_PRIORITY_INHERITANCE_CHAIN requires configUSE_MUTEXES to be set to 1
+    #endif
+
+    #if ( INCLUDE_xSemaphoreGetMutexHolder != 1 )
+        #error configUSE_PRIORITY_INHERITANCE_CHAIN requires INCLUDE_xSemaphoreGetMutexHolder to be set to 1
+    #endif
+#endif
+
+#ifndef configUSE_TASK_GROUPS
+    #define configUSE_TASK_GROUPS    0
+#endif
+
+#ifndef configUSE_PROPORTIONAL_SHARE
+    #define configUSE_PROPORTIONAL_SHARE    0
+#endif
+
+#if ( configUSE_PROPORTIONAL_SHARE == 1 )
+    #ifndef configPROPORTIONAL_SHARE_PRIORITY
+        #error If configUSE_PROPORTIONAL_SHARE is set to 1 then configPROPORTIONAL_SHARE_PRIORITY must also be defined.
+    #endif
+
+    #if ( configPROPORTIONAL_SHARE_PRIORITY >= configMAX_PRIORITIES )
+        #error configPROPORTIONAL_SHARE_PRIORITY must be less than configMAX_PRIORITIES.
+    #endif
+
+    #ifndef configPROPORTIONAL_SHARE_DEFAULT_WEIGHT
+        #define configPROPORTIONAL_SHARE_DEFAULT_WEIGHT    100
+    #endif
+
+/* The most CPU time, in cycles, a task in the proportional share band can be
+ * owed after being blocked.  Defaults to one tick. */
+    #ifndef configPROPORTIONAL_SHARE_MAX_CREDIT
+        #define configPROPORTIONAL_SHARE_MAX_CREDIT    ( configCPU_CLOCK_HZ / configTICK_RATE_HZ )
+    #endif
+#endif
+
+#ifndef configUSE_TIME_TRIGGERED_SCHEDULE
+    #define configUSE_TIME_TRIGGERED_SCHEDULE    0
+#endif
+
+#if ( configUSE_TIME_TRIGGERED_SCHEDULE == 1 )
+
+/* The most slots a time triggered schedule table can hold. */
+    #ifndef configTIME_TRIGGERED_MAX_SLOTS
+        #define configTIME_TRIGGERED_MAX_SLOTS    16
+    #endif
+
+    #if ( configTIME_TRIGGERED_MAX_SLOTS < 1 )
+        #error configTIME_TRIGGERED_MAX_SLOTS must be at least 1.
+    #endif
+#endif
+
+#ifndef configUSE_TIME_PARTITIONS
+    #define configUSE_TIME_PARTITIONS    0
+#endif
+
+#if ( configUSE_TIME_PARTITIONS == 1 )
+
+/* The number of temporal partitions, including background partition 0. */
+    #ifndef configNUM_PARTITIONS
+        #define configNUM_PARTITIONS    4
+    #endif
+
+    #if ( configNUM_PARTITIONS < 2 )
+        #error configNUM_PARTITIONS must be at least 2.
+    #endif
+
+    #if ( configUSE_PREEMPTION != 1 )
+        #error configUSE_TIME_PARTITIONS requires configUSE_PREEMPTION to be set to 1 so windows can end while a task is running.
+    #endif
+
+    #if ( configUSE_PROPORTIONAL_SHARE == 1 )
+        #error configUSE_TIME_PARTITIONS and configUSE_PROPORTIONAL_SHARE cannot both be set to 1.
+    #endif
+#endif
+
+#ifndef configUSE_STACK_TIERING
+    #define configUSE_STACK_TIERING    0
+#endif
+
+#if ( configUSE_STACK_TIERING == 1 )
+
+/* The number of fast memory stack slots shared by the tasks that use stack
+ * tiering. */
+    #ifndef configSTACK_TIER_SLOTS
+        #define configSTACK_TIER_SLOTS    4
+    #endif
+
+/* The size of each slot in words.  Must be even so every slot starts on an
+ * eight byte boundary. */
+    #ifndef configSTACK_TIER_SLOT_DEPTH
+        #define configSTACK_TIER_SLOT_DEPTH    configMINIMAL_STACK_SIZE
+    #endif
+
+/* The number of ticks a task must have been switched out before the idle task
+ * writes its stack back to slow memory. */
+    #ifndef configSTACK_TIER_WRITE_BACK_TICKS
+        #define configSTACK_TIER_WRITE_BACK_TICKS    1000
+    #endif
+
+/* Placed after the declaration of the slots, normally to put them in a linker
+ * section that is located in fast memory such as DTCM. */
+    #ifndef configSTACK_TIER_SLOT_ATTRIBUTE
+        #define configSTACK_TIER_SLOT_ATTRIBUTE    __attribute__( ( aligned( 8 ) ) )
+    #endif
+
+    #if ( configSTACK_TIER_SLOTS < 1 )
+        #error configSTACK_TIER_SLOTS must be at least 1.
+    #endif
+
+    #if ( ( configSTACK_TIER_SLOT_DEPTH % 2 ) != 0 )
+        #error configSTACK_TIER_SLOT_DEPTH must be even.
+    #endif
+#endif
+
+#ifndef configUSE_DEFERRED_TICK_PROCESSING
+    #define configUSE_DEFERRED_TICK_PROCESSING    0
+#endif
+
+#if ( configUSE_DEFERRED_TICK_PROCESSING == 1 )
+
+/* The maximum number of delayed tasks moved to a ready list inside one
+ * critical section when deferred ticks are processed. */
+    #ifndef configDEFERRED_TICK_UNBLOCK_BATCH
+        #define configDEFERRED_TICK_UNBLOCK_BATCH    1
+    #endif
+
+    #if ( configDEFERRED_TICK_UNBLOCK_BATCH < 1 )
+        #error configDEFERRED_TICK_UNBLOCK_BATCH must be at least 1.
+    #endif
+
+    #if ( ( configUSE_PREEMPTION != 1 ) || ( defined( configUSE_TIME_SLICING ) && ( configUSE_TIME_SLICING == 0 ) ) )
+        #error configUSE_DEFERRED_TICK_PROCESSING requires configUSE_PREEMPTION and configUSE_TIME_SLICING to be set to 1 as every tick ends in a context switch.
+    #endif
+#endif
+
+#ifndef configUSE_SWI
+    #define configUSE_SWI    0
+#endif
+
+#if ( configUSE_SWI == 1 )
+
+/* The number of software interrupt priorities.  Each software interrupt has a
+ * priority of its own, so this is also the number of software interrupts. */
+    #ifndef configSWI_MAX_PRIORITIES
+        #define configSWI_MAX_PRIORITIES    8
+    #endif
+
+    #if ( ( configSWI_MAX_PRIORITIES < 1 ) || ( configSWI_MAX_PRIORITIES > 32 ) )
+        #error configSWI_MAX_PRIORITIES must be between 1 and 32.
+    #endif
+#endif
+
+#ifndef configUSE_HEAP_DEFERRED_FREE
+    #define configUSE_HEAP_DEFERRED_FREE    0
+#endif
+
+#ifndef configUSE_TASK_NOTIFY_WAIT_BITS
+    #define configUSE_TASK_NOTIFY_WAIT_BITS    0
+#endif
+
+#if ( ( configUSE_TASK_NOTIFY_WAIT_BITS == 1 ) && defined( configUSE_TASK_NOTIFICATIONS ) && ( configUSE_TASK_NOTIFICATIONS == 0 ) )
+    #error configUSE_TASK_NOTIFY_WAIT_BITS requires configUSE_TASK_NOTIFICATIONS to be set to 1.
+#endif
+
+#ifndef configUSE_IO_RING
+    #define configUSE_IO_RING    0
+#endif
+
+#if ( ( configUSE_IO_RING == 1 ) && defined( configSUPPORT_DYNAMIC_ALLOCATION ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 0 ) )
+    #error configUSE_IO_RING requires configSUPPORT_DYNAMIC_ALLOCATION to be set to 1.
+#endif
+
+#ifndef configUSE_LATENCY_SOAK
+    #define configUSE_LATENCY_SOAK    0
+#endif
+
+#ifndef configLATENCY_SOAK_MAX_TASKS
+    #define configLATENCY_SOAK_MAX_TASKS    4
+#endif
+
+#ifndef configLATENCY_SOAK_HISTOGRAM_BINS
+    #define configLATENCY_SOAK_HISTOGRAM_BINS    64
+#endif
+
+#ifndef configLATENCY_SOAK_STACK_DEPTH
+    #define configLATENCY_SOAK_STACK_DEPTH    ( configMINIMAL_STACK_SIZE * 2 )
+#endif
+
+#if ( configUSE_LATENCY_SOAK == 1 )
+    #if ( INCLUDE_xTaskDelayUntil == 0 )
+        #error configUSE_LATENCY_SOAK requires INCLUDE_xTaskDelayUntil to be set to 1.
+    #endif
+
+    #if ( defined( configSUPPORT_DYNAMIC_ALLOCATION ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 0 ) )
+        #error configUSE_LATENCY_SOAK requires configSUPPORT_DYNAMIC_ALLOCATION to be set to 1.
+    #endif
+
+    #if ( defined( configUSE_TASK_NOTIFICATIONS ) && ( configUSE_TASK_NOTIFICATIONS == 0 ) )
+        #error configUSE_LATENCY_SOAK requires configUSE_TASK_NOTIFICATIONS to be set to 1.
+    #endif
+#endif
+
+#ifndef configUSE_LATENCY_SEARCH
+    #define configUSE_LATENCY_SEARCH    0
+#endif
+
+#ifndef configLATENCY_SEARCH_CORPUS_SIZE
+    #define configLATENCY_SEARCH_CORPUS_SIZE    8
+#endif
+
+#if ( ( configUSE_LATENCY_SEARCH == 1 ) && ( configUSE_LATENCY_SOAK == 0 ) )
+    #error configUSE_LATENCY_SEARCH requires configUSE_LATENCY_SOAK to be set to 1.
+#endif
+
+#ifndef configUSE_ADAPTIVE_TICK
+    #define configUSE_ADAPTIVE_TICK    0
+#endif
+
+#if ( configUSE_ADAPTIVE_TICK == 1 )
+    #if ( configUSE_DEFERRED_TICK_PROCESSING == 1 )
+        #error configUSE_ADAPTIVE_TICK cannot be used with configUSE_DEFERRED_TICK_PROCESSING, as the tick is deferred from the tick interrupt.
+    #endif
+
+    #if ( configUSE_TICK_HOOK == 1 )
+        #error configUSE_ADAPTIVE_TICK cannot be used with configUSE_TICK_HOOK, as the hook is not called for deferred ticks.
+    #endif
+
+    #if !defined( portADAPTIVE_TICK_START ) || !defined( portADAPTIVE_TICK_STOP ) || !defined( portADAPTIVE_TICK_ELAPSED )
+        #error configUSE_ADAPTIVE_TICK is set to 1 but the port does not define portADAPTIVE_TICK_START(), portADAPTIVE_TICK_STOP() and portADAPTIVE_TICK_ELAPSED().
+    #endif
+#endif
+
+#ifndef configUSE_DEADLINE_TIMERS
+    #define configUSE_DEADLINE_TIMERS    0
+#endif
+
+#ifndef configUSE_PACKET_BUFFERS
+    #define configUSE_PACKET_BUFFERS    0
+#endif
+
+#if ( configUSE_PACKET_BUFFERS == 1 )
+    #ifndef configPACKET_BUFFER_SEGMENT_SIZE
+        #define configPACKET_BUFFER_SEGMENT_SIZE    256
+    #endif
+
+    #ifndef configPACKET_BUFFER_POOL_SEGMENTS
+        #define configPACKET_BUFFER_POOL_SEGMENTS    32
+    #endif
+
+    #if ( ( configPACKET_BUFFER_SEGMENT_SIZE < 1 ) || ( configPACKET_BUFFER_SEGMENT_SIZE > 65535 ) )
+        #error configPACKET_BUFFER_SEGMENT_SIZE must be between 1 and 65535.
+    #endif
+
+    #if ( configPACKET_BUFFER_POOL_SEGMENTS < 1 )
+        #error configPACKET_BUFFER_POOL_SEGMENTS must be at least 1.
+    #endif
+#endif
+
+#ifndef configUSE_INLINE_KERNEL_QUERIES
+
+/* By default the kernel variables read by kernel_inline.h are private to the
+ * kernel. */
+    #define configUSE_INLINE_KERNEL_QUERIES    0
+#endif
+
+#ifndef configUSE_PORT_OPTIMISED_COPY
+
+/* By default the kernel copies and fills memory with the C library memcpy()
+ * and memset(). */
+    #define configUSE_PORT_OPTIMISED_COPY    0
+#endif
+
+#ifndef configCOPY_OFFLOAD_THRESHOLD
+
+/* By default no copy is offloaded to a DMA engine. */
+    #define configCOPY_OFFLOAD_THRESHOLD    0
+#endif
+
+#ifndef configGENERATE_COPY_STATS
+    #define configGENERATE_COPY_STATS    0
+#endif
+
+#if ( configUSE_PORT_OPTIMISED_COPY == 0 )
+    #if ( configCOPY_OFFLOAD_THRESHOLD > 0 )
+        #error configCOPY_OFFLOAD_THRESHOLD requires configUSE_PORT_OPTIMISED_COPY to be set to 1
+    #endif
+
+    #if ( configGENERATE_COPY_STATS == 1 )
+        #error configGENERATE_COPY_STATS requires configUSE_PORT_OPTIMISED_COPY to be set to 1
+    #endif
+#endif
+
+#if ( configCOPY_OFFLOAD_THRESHOLD > 0 )
+    #if ( INCLUDE_xTaskGetSchedulerState != 1 ) && ( configUSE_TIMERS != 1 )
+        #error configCOPY_OFFLOAD_THRESHOLD requires INCLUDE_xTaskGetSchedulerState or configUSE_TIMERS to be set to 1
+    #endif
+#endif
+
+/* The kernel copies and fills memory through portMEMCPY() and portMEMSET().
+ * portMEMCPY_DEFERRABLE() is used instead for bulk copies that are only made
+ * from task context outside critical sections, which a port may hand to a DMA
+ * engine while the calling task blocks.  A port that provides its own routines
+ * defines these macros in portmacro.h. */
+#ifndef portMEMCPY
+    #define portMEMCPY( pvDestination, pvSource, xBytes )    ( void ) memcpy( ( pvDestination ), ( pvSource ), ( xBytes ) )
+#endif
+
+#ifndef portMEMSET
+    #define portMEMSET( pvDestination, iValue, xBytes )    ( void ) memset( ( pvDestination ), ( iValue ), ( xBytes ) )
+#endif
+
+#ifndef portMEMCPY_DEFERRABLE
+    #define portMEMCPY_DEFERRABLE( pvDestination, pvSource, xBytes )    portMEMCPY( ( pvDestination ), ( pvSource ), ( xBytes ) )
+#endif
+
+/* configUSE_CYCLE_COUNTER is set to 1 when a kernel feature that needs
+ * portGET_CYCLE_COUNTER() is enabled, so the port starts the counter along with
+ * the scheduler.  It can also be set to 1 in FreeRTOSConfig.h for application
+ * use of the counter. */
+#ifndef configGENERATE_PORT_PROFILE
+    #define configGENERATE_PORT_PROFILE    0
+#endif
+
+#ifndef configUSE_CYCLE_COUNTER
+    #if ( ( configUSE_PROPORTIONAL_SHARE == 1 ) || ( configGENERATE_PORT_PROFILE == 1 ) || ( configUSE_FLIGHT_RECORDER == 1 ) || ( configUSE_TIME_TRIGGERED_SCHEDULE == 1 ) || ( configUSE_LATENCY_SOAK == 1 ) )
+        #define configUSE_CYCLE_COUNTER    1
+    #else
+        #define configUSE_CYCLE_COUNTER    0
+    #endif
+#endif
+
+#if ( configUSE_CYCLE_COUNTER == 1 )
+    #ifndef portGET_CYCLE_COUNTER
+        #error configUSE_CYCLE_COUNTER is set to 1 but the port does not define portGET_CYCLE_COUNTER().
+    #endif
+#endif
+
 #ifndef portTASK_USES_FLOATING_POINT
     #define portTASK_USES_FLOATING_POINT()
 #endif
@@ -937,6 +1373,42 @@
     #error configTASK_NOTIFICATION_ARRAY_ENTRIES must be at least 1
 #endif
 
+#ifndef configUSE_RCU
+    #define configUSE_RCU    0
+#endif
+
+#if ( configUSE_RCU == 1 )
+    #ifndef configRCU_TASK_PRIORITY
+        #define configRCU_TASK_PRIORITY    1
+    #endif
+
+    #ifndef configRCU_TASK_STACK_DEPTH
+        #define configRCU_TASK_STACK_DEPTH    configMINIMAL_STACK_SIZE
+    #endif
+
+/* The task notification used by vRcuSynchronize() to wait for the grace
+ * period to end. */
+    #ifndef configRCU_SYNCHRONIZE_NOTIFY_INDEX
+        #define configRCU_SYNCHRONIZE_NOTIFY_INDEX    0
+    #endif
+
+    #if ( configRCU_TASK_PRIORITY >= configMAX_PRIORITIES )
+        #error configRCU_TASK_PRIORITY must be less than configMAX_PRIORITIES.
+    #endif
+
+    #if ( configRCU_SYNCHRONIZE_NOTIFY_INDEX >= configTASK_NOTIFICATION_ARRAY_ENTRIES )
+        #error configRCU_SYNCHRONIZE_NOTIFY_INDEX must be less than configTASK_NOTIFICATION_ARRAY_ENTRIES.
+    #endif
+
+    #if ( configUSE_TASK_NOTIFICATIONS != 1 ) || ( INCLUDE_vTaskDelay != 1 )
+        #error configUSE_RCU requires configUSE_TASK_NOTIFICATIONS and INCLUDE_vTaskDelay to be set to 1.
+    #endif
+
+    #if ( INCLUDE_xTaskGetCurrentTaskHandle != 1 ) && ( configUSE_MUTEXES != 1 )
+        #error configUSE_RCU requires INCLUDE_xTaskGetCurrentTaskHandle or configUSE_MUTEXES to be set to 1.
+    #endif
+#endif
+
 #ifndef configUSE_POSIX_ERRNO
     #define configUSE_POSIX_ERRNO    0
 #endif
@@ -1275,6 +1747,36 @@ typedef struct xSTATIC_TCB
     #if ( configUSE_MUTEXES == 1 )
         UBaseType_t uxDummy12[ 2 ];
     #endif
+    #if ( configUSE_PRIORITY_INHERITANCE_CHAIN == 1 )
+        void * pvDummy13;
+    #endif
+    #if ( configUSE_TASK_GROUPS == 1 )
+        StaticListItem_t xDummy23;
+    #endif
+    #if ( configUSE_PROPORTIONAL_SHARE == 1 )
+        uint32_t ulDummy24[ 2 ];
+        uint64_t ullDummy25[ 2 ];
+    #endif
+    #if ( configUSE_FLIGHT_RECORDER == 1 )
+        uint32_t ulDummy26;
+    #endif
+    #if ( configUSE_TIME_PARTITIONS == 1 )
+        UBaseType_t uxDummy27;
+    #endif
+    #if ( configUSE_RCU == 1 )
+        UBaseType_t uxDummy28;
+        uint8_t ucDummy29;
+    #endif
+    #if ( configUSE_STACK_TIERING == 1 )
+        void * pxDummy30;
+        TickType_t xDummy31;
+        UBaseType_t uxDummy32;
+        configSTACK_DEPTH_TYPE uxDummy33;
+    #endif
+    #if ( configUSE_TASK_NOTIFY_WAIT_BITS == 1 )
+        uint32_t ulDummy34;
+        BaseType_t xDummy35;
+    #endif
     #if ( configUSE_APPLICATION_TASK_TAG == 1 )
         void * pxDummy14;
     #endif
@@ -1343,6 +1845,19 @@ typedef struct xSTATIC_QUEUE
         UBaseType_t uxDummy8;
         uint8_t ucDummy9;
     #endif
+
+    #if ( configUSE_QUEUE_POW2_STORAGE == 1 )
+        size_t xDummy10;
+        void * pvDummy11;
+    #endif
+
+    #if ( configUSE_QUEUE_ELASTIC == 1 )
+        UBaseType_t uxDummy12;
+        void * pvDummy13[ 2 ];
+        UBaseType_t uxDummy14[ 4 ];
+        void * pvDummy15;
+        uint8_t ucDummy16;
+    #endif
 } StaticQueue_t;
 typedef StaticQueue_t StaticSemaphore_t;
 
@@ -1374,6 +1889,40 @@ typedef struct xSTATIC_EVENT_GROUP
     #endif
 } StaticEventGroup_t;
 
+/*
+ * In line with software engineering best practice, FreeRTOS implements a strict
+ * data hiding policy, so the real task group structure is not accessible to the
+ * application.  StaticTaskGroup_t has the same size and alignment requirements
+ * as the real structure, so it can be used to allocate a task group statically.
+ * See xTaskGroupCreateStatic().
+ */
+typedef struct xSTATIC_TASK_GROUP
+{
+    StaticList_t xDummy1;
+
+    #if ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+        uint8_t ucDummy2;
+    #endif
+} StaticTaskGroup_t;
+
+/*
+ * In line with software engineering best practice, FreeRTOS implements a strict
+ * data hiding policy, so the real deadline timer structure is not accessible to
+ * the application.  StaticDeadlineTimer_t has the same size and alignment
+ * requirements as the real structure, so it can be used to hold a deadline
+ * timer.  See xTaskDeadlineTimerInit().
+ */
+typedef struct xSTATIC_DEADLINE_TIMER
+{
+    void * pvDummy1;
+    StaticListItem_t xDummy2;
+    TickType_t xDummy3;
+    TaskFunction_t pvDummy4;
+    void * pvDummy5[ 2 ];
+    TickType_t xDummy6[ 2 ];
+    uint8_t ucDummy7;
+} StaticDeadlineTimer_t;
+
 /*
  * In line with software engineering best practice, especially when supplying a
  * library that is likely to change in future versions, FreeRTOS implements a
@@ -92,6 +92,53 @@ void freertos::FreertosHeap4::prvInsertBlockIntoFreeList(freertos::BlockLink_t *
     }
 }
 
+#if (configUSE_HEAP_DEFERRED_FREE == 1)
+
+void freertos::FreertosHeap4::prvFreeDeferredBlocks()
+{
+    freertos::BlockLink_t *pxLink;
+    freertos::BlockLink_t *pxNextLink;
+    size_t xBytes = 0;
+
+    /* Take the whole list, so interrupts can carry on pushing onto an empty
+     * one while it is drained. */
+    pxLink = pxDeferredFreeBlocks.exchange(nullptr, std::memory_order_acquire);
+
+    while (pxLink != NULL)
+    {
+        pxNextLink = pxLink->pxNextFreeBlock;
+
+        /* The block is being returned to the heap - it is no longer
+         * allocated. */
+        heapFREE_BLOCK(pxLink);
+
+#if (configHEAP_CLEAR_MEMORY_ON_FREE == 1)
+        {
+            portMEMSET(((uint8_t *)pxLink) + heap_struct_size, 0, pxLink->xBlockSize - heap_struct_size);
+        }
+#endif
+
+        xBytes += pxLink->xBlockSize;
+        xFreeBytesRemaining += pxLink->xBlockSize;
+        traceFREE(((uint8_t *)pxLink) + heap_struct_size, pxLink->xBlockSize);
+        prvInsertBlockIntoFreeList(pxLink);
+        xNumberOfSuccessfulFrees++;
+
+        pxLink = pxNextLink;
+    }
+
+    if (xBytes != 0)
+    {
+        xDeferredFreeBytes.fetch_sub(xBytes, std::memory_order_relaxed);
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+}
+
+#endif /* configUSE_HEAP_DEFERRED_FREE */
+
 freertos::FreertosHeap4::FreertosHeap4(uint8_t *buffer, size_t size)
 {
     freertos::BlockLink_t *pxFirstFreeBlock;
@@ -147,6 +194,13 @@ void *freertos::FreertosHeap4::Malloc(size_t xWantedSize)
     vTaskSuspendAll();
 
     {
+#if (configUSE_HEAP_DEFERRED_FREE == 1)
+        {
+            /* Make the blocks freed from interrupts available first. */
+            prvFreeDeferredBlocks();
+        }
+#endif
+
         /* If this is the first call to malloc then the heap will require
          * initialisation to setup the list of free blocks. */
         if (pxEnd == NULL)
@@ -315,12 +369,18 @@ void freertos::FreertosHeap4::Free(void *pv)
 
 #if (configHEAP_CLEAR_MEMORY_ON_FREE == 1)
                 {
-                    (void)memset(puc + heap_struct_size, 0, pxLink->xBlockSize - heap_struct_size);
+                    portMEMSET(puc + heap_struct_size, 0, pxLink->xBlockSize - heap_struct_size);
                 }
 #endif
 
                 vTaskSuspendAll();
                 {
+#if (configUSE_HEAP_DEFERRED_FREE == 1)
+                    {
+                        prvFreeDeferredBlocks();
+                    }
+#endif
+
                     /* Add this block to the list of free blocks. */
                     xFreeBytesRemaining += pxLink->xBlockSize;
                     traceFREE(pv, pxLink->xBlockSize);
@@ -341,6 +401,64 @@ void freertos::FreertosHeap4::Free(void *pv)
     }
 }
 
+#if (configUSE_HEAP_DEFERRED_FREE == 1)
+
+void freertos::FreertosHeap4::FreeFromISR(void *pv)
+{
+    freertos::BlockLink_t *pxLink;
+    freertos::BlockLink_t *pxHead;
+
+    if (pv != NULL)
+    {
+        /* The memory being freed will have an BlockLink_t structure immediately
+         * before it. */
+        pxLink = (freertos::BlockLink_t *)(((uint8_t *)pv) - freertos::FreertosHeap4::heap_struct_size);
+
+        configASSERT(heapBLOCK_IS_ALLOCATED(pxLink) != 0);
+        configASSERT(pxLink->pxNextFreeBlock == NULL);
+
+        if ((heapBLOCK_IS_ALLOCATED(pxLink) != 0) && (pxLink->pxNextFreeBlock == NULL))
+        {
+            /* Count the bytes first so the counter never goes below zero when
+             * the list is drained. */
+            xDeferredFreeBytes.fetch_add(pxLink->xBlockSize & ~heapBLOCK_ALLOCATED_BITMASK, std::memory_order_relaxed);
+
+            /* Push the block onto the deferred list.  The block stays marked as
+             * allocated until it is drained. */
+            pxHead = pxDeferredFreeBlocks.load(std::memory_order_relaxed);
+
+            do
+            {
+                pxLink->pxNextFreeBlock = pxHead;
+            } while (!pxDeferredFreeBlocks.compare_exchange_weak(pxHead, pxLink, std::memory_order_release, std::memory_order_relaxed));
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+}
+
+void freertos::FreertosHeap4::FreeDeferredBlocks()
+{
+    /* Only suspend the scheduler if there is something to do, as this is
+     * called from the idle task on every pass. */
+    if (pxDeferredFreeBlocks.load(std::memory_order_relaxed) != NULL)
+    {
+        vTaskSuspendAll();
+        {
+            prvFreeDeferredBlocks();
+        }
+        (void)xTaskResumeAll();
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+}
+
+#endif /* configUSE_HEAP_DEFERRED_FREE */
+
 void *freertos::FreertosHeap4::Calloc(size_t xNum, size_t xSize)
 {
     void *pv = NULL;
@@ -351,7 +469,7 @@ void *freertos::FreertosHeap4::Calloc(size_t xNum, size_t xSize)
 
         if (pv != NULL)
         {
-            (void)memset(pv, 0, xNum * xSize);
+            portMEMSET(pv, 0, xNum * xSize);
         }
     }
 
@@ -463,4 +581,25 @@ extern "C"
     {
         return _heap4.GetHeapStats(pxHeapStats);
     }
+
+#if (configUSE_HEAP_DEFERRED_FREE == 1)
+
+    /*-----------------------------------------------------------*/
+
+    void vPortFreeFromISR(void *pv)
+    {
+        _heap4.FreeFromISR(pv);
+    }
+
+    void vPortFreeDeferredBlocks(void)
+    {
+        _heap4.FreeDeferredBlocks();
+    }
+
+    size_t xPortGetDeferredFreeBytes(void)
+    {
+        return _heap4.xDeferredFreeBytes.load(std::memory_order_relaxed);
+    }
+
+#endif /* configUSE_HEAP_DEFERRED_FREE */
 }
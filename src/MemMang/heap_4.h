@@ -1,4 +1,5 @@
 #pragma once
+#include <atomic>
 #include <stddef.h>
 #include <stdlib.h>
 #include <string.h>
@@ -80,6 +81,20 @@ namespace freertos
          */
         void prvInsertBlockIntoFreeList(freertos::BlockLink_t *pxBlockToInsert);
 
+#if (configUSE_HEAP_DEFERRED_FREE == 1)
+        /* Blocks passed to FreeFromISR() that have not been returned to the free
+         * list yet, most recent first, linked through pxNextFreeBlock.  Interrupts
+         * only ever push onto the list and the task level takes the whole list at
+         * once, so no lock is needed. */
+        std::atomic<freertos::BlockLink_t *> pxDeferredFreeBlocks{nullptr};
+
+        /*
+         * Returns the blocks passed to FreeFromISR() to the free list.  Must be
+         * called with the scheduler suspended.
+         */
+        void prvFreeDeferredBlocks();
+#endif
+
     public:
         FreertosHeap4(uint8_t *buffer, size_t size);
 
@@ -94,5 +109,14 @@ namespace freertos
         void Free(void *pv);
         void *Calloc(size_t xNum, size_t xSize);
         void GetHeapStats(HeapStats_t *pxHeapStats);
+
+#if (configUSE_HEAP_DEFERRED_FREE == 1)
+        /* The number of bytes passed to FreeFromISR() that have not been returned
+         * to the free list yet. */
+        std::atomic<size_t> xDeferredFreeBytes{0};
+
+        void FreeFromISR(void *pv);
+        void FreeDeferredBlocks();
+#endif
     };
 } // namespace freertos
@@ -0,0 +1,312 @@
+/*
+ * FreeRTOS Kernel V10.5.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers.  That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Lint e961, e750 and e9021 are suppressed as a MISRA exception justified
+ * because the MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750 !e9021 See comment above. */
+
+/* This entire source file will be skipped if the application is not configured
+ * to include flight recorder functionality.  This #if is closed at the very
+ * bottom of this file. */
+#if ( configUSE_FLIGHT_RECORDER == 1 )
+
+/* The history length is a power of 2 so the write position wraps with a
+ * mask. */
+    #define frHISTORY_MASK    ( ( uint32_t ) configFLIGHT_RECORDER_LENGTH - 1UL )
+
+/* The recorder is only ever in one of these states.  It moves from recording
+ * to triggered when a trigger condition is met, and from triggered to frozen
+ * once the post trigger window has been recorded. */
+    #define frSTATE_RECORDING    ( ( uint8_t ) 0U )
+    #define frSTATE_TRIGGERED    ( ( uint8_t ) 1U )
+    #define frSTATE_FROZEN       ( ( uint8_t ) 2U )
+
+/* The history, and the number of events written to it since it was last
+ * cleared.  Only accessed with interrupts masked. */
+    PRIVILEGED_DATA static FlightRecorderEvent_t xHistory[ configFLIGHT_RECORDER_LENGTH ];
+    PRIVILEGED_DATA static uint32_t ulEventsRecorded = 0UL;
+    PRIVILEGED_DATA static FlightRecorderEvent_t xTriggerEvent = { 0UL, ( uint32_t ) eFlightRecorderUser, NULL, 0UL };
+    PRIVILEGED_DATA static UBaseType_t uxPostTriggerEventsRemaining = ( UBaseType_t ) 0U;
+    PRIVILEGED_DATA static volatile uint8_t ucRecorderState = frSTATE_RECORDING;
+
+/* Trigger thresholds, in cycles.  0 disables the trigger. */
+    PRIVILEGED_DATA static uint32_t ulReadyLatencyThreshold = ( uint32_t ) configFLIGHT_RECORDER_READY_LATENCY_CYCLES;
+    PRIVILEGED_DATA static uint32_t ulCriticalSectionThreshold = ( uint32_t ) configFLIGHT_RECORDER_CRITICAL_SECTION_CYCLES;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Write an event to the history and advance the post trigger window.  Must be
+ * called with interrupts masked.
+ */
+    static void prvWriteEvent( eFlightRecorderEvent eEvent,
+                               const void * pvObject,
+                               uint32_t ulValue,
+                               BaseType_t xTrigger ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+    static void prvWriteEvent( eFlightRecorderEvent eEvent,
+                               const void * pvObject,
+                               uint32_t ulValue,
+                               BaseType_t xTrigger )
+    {
+        FlightRecorderEvent_t * pxEvent;
+
+        if( ucRecorderState != frSTATE_FROZEN )
+        {
+            pxEvent = &( xHistory[ ulEventsRecorded & frHISTORY_MASK ] );
+            pxEvent->ulCycles = portGET_CYCLE_COUNTER();
+            pxEvent->ulEvent = ( uint32_t ) eEvent;
+            pxEvent->pvObject = pvObject;
+            pxEvent->ulValue = ulValue;
+            ulEventsRecorded++;
+
+            if( ucRecorderState == frSTATE_TRIGGERED )
+            {
+                uxPostTriggerEventsRemaining--;
+
+                if( uxPostTriggerEventsRemaining == ( UBaseType_t ) 0U )
+                {
+                    ucRecorderState = frSTATE_FROZEN;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else if( xTrigger != pdFALSE )
+            {
+                /* Only the first trigger counts.  Triggers within the post
+                 * trigger window are recorded as ordinary events. */
+                xTriggerEvent = *pxEvent;
+
+                if( configFLIGHT_RECORDER_POST_TRIGGER_EVENTS == 0 )
+                {
+                    ucRecorderState = frSTATE_FROZEN;
+                }
+                else
+                {
+                    uxPostTriggerEventsRemaining = ( UBaseType_t ) configFLIGHT_RECORDER_POST_TRIGGER_EVENTS;
+                    ucRecorderState = frSTATE_TRIGGERED;
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    void vFlightRecorderRecord( eFlightRecorderEvent eEvent,
+                                const void * pvObject,
+                                uint32_t ulValue )
+    {
+        UBaseType_t uxSavedInterruptStatus;
+
+        uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            prvWriteEvent( eEvent, pvObject, ulValue, pdFALSE );
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+    }
+/*-----------------------------------------------------------*/
+
+    void vFlightRecorderTrigger( eFlightRecorderEvent eEvent,
+                                 const void * pvObject,
+                                 uint32_t ulValue )
+    {
+        UBaseType_t uxSavedInterruptStatus;
+
+        uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            prvWriteEvent( eEvent, pvObject, ulValue, pdTRUE );
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+    }
+/*-----------------------------------------------------------*/
+
+    void vFlightRecorderTaskSwitchedIn( const void * pvTask,
+                                        uint32_t ulReadyCycles )
+    {
+        uint32_t ulLatency = 0UL;
+        BaseType_t xTrigger = pdFALSE;
+        UBaseType_t uxSavedInterruptStatus;
+
+        /* ulReadyCycles is 0 if the task was not unblocked since it last ran,
+         * for example if it was preempted, in which case there is no ready
+         * latency to measure. */
+        if( ulReadyCycles != 0UL )
+        {
+            ulLatency = portGET_CYCLE_COUNTER() - ulReadyCycles;
+
+            if( ( ulReadyLatencyThreshold != 0UL ) && ( ulLatency > ulReadyLatencyThreshold ) )
+            {
+                xTrigger = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            prvWriteEvent( eFlightRecorderTaskSwitchedIn, pvTask, ulLatency, xTrigger );
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+    }
+/*-----------------------------------------------------------*/
+
+    void vFlightRecorderCriticalSection( uint32_t ulCycles )
+    {
+        /* Critical sections are too frequent to record every one, so only
+         * those long enough to trigger the recorder are written. */
+        if( ( ulCriticalSectionThreshold != 0UL ) && ( ulCycles > ulCriticalSectionThreshold ) )
+        {
+            vFlightRecorderTrigger( eFlightRecorderCriticalSection, NULL, ulCycles );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xFlightRecorderIsFrozen( void )
+    {
+        return ( ucRecorderState == frSTATE_FROZEN ) ? pdTRUE : pdFALSE;
+    }
+/*-----------------------------------------------------------*/
+
+    UBaseType_t uxFlightRecorderGetHistory( FlightRecorderEvent_t * pxEvents,
+                                            UBaseType_t uxMaxEvents,
+                                            FlightRecorderEvent_t * pxTriggerEvent )
+    {
+        UBaseType_t uxSavedInterruptStatus;
+        UBaseType_t uxCount;
+        UBaseType_t uxEvent;
+        uint32_t ulFirst;
+
+        configASSERT( ( pxEvents != NULL ) || ( uxMaxEvents == ( UBaseType_t ) 0U ) );
+
+        /* The copy is made with interrupts masked so it is consistent even if
+         * the recorder is not yet frozen.  The history is short, so this does
+         * not mask interrupts for long. */
+        uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            if( ulEventsRecorded < ( uint32_t ) configFLIGHT_RECORDER_LENGTH )
+            {
+                uxCount = ( UBaseType_t ) ulEventsRecorded;
+            }
+            else
+            {
+                uxCount = ( UBaseType_t ) configFLIGHT_RECORDER_LENGTH;
+            }
+
+            if( uxCount > uxMaxEvents )
+            {
+                uxCount = uxMaxEvents;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            ulFirst = ulEventsRecorded - ( uint32_t ) uxCount;
+
+            for( uxEvent = ( UBaseType_t ) 0U; uxEvent < uxCount; uxEvent++ )
+            {
+                pxEvents[ uxEvent ] = xHistory[ ( ulFirst + ( uint32_t ) uxEvent ) & frHISTORY_MASK ];
+            }
+
+            if( pxTriggerEvent != NULL )
+            {
+                *pxTriggerEvent = xTriggerEvent;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+        return uxCount;
+    }
+/*-----------------------------------------------------------*/
+
+    void vFlightRecorderRearm( void )
+    {
+        UBaseType_t uxSavedInterruptStatus;
+
+        uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            ulEventsRecorded = 0UL;
+            uxPostTriggerEventsRemaining = ( UBaseType_t ) 0U;
+            xTriggerEvent.ulCycles = 0UL;
+            xTriggerEvent.ulEvent = ( uint32_t ) eFlightRecorderUser;
+            xTriggerEvent.pvObject = NULL;
+            xTriggerEvent.ulValue = 0UL;
+            ucRecorderState = frSTATE_RECORDING;
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+    }
+/*-----------------------------------------------------------*/
+
+    void vFlightRecorderSetThresholds( uint32_t ulReadyLatencyCycles,
+                                       uint32_t ulCriticalSectionCycles )
+    {
+        ulReadyLatencyThreshold = ulReadyLatencyCycles;
+        ulCriticalSectionThreshold = ulCriticalSectionCycles;
+    }
+
+/* This entire source file will be skipped if the application is not configured
+ * to include flight recorder functionality.  If you want to include the flight
+ * recorder then ensure configUSE_FLIGHT_RECORDER is set to 1 in
+ * FreeRTOSConfig.h. */
+#endif /* configUSE_FLIGHT_RECORDER == 1 */
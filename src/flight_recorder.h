@@ -0,0 +1,275 @@
+/*
+ * FreeRTOS Kernel V10.5.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+#ifndef FLIGHT_RECORDER_H
+#define FLIGHT_RECORDER_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h" must appear in source files before "include flight_recorder.h"
+#endif
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * The flight recorder keeps a short circular history of kernel events in RAM.
+ * It is cheap enough to leave running in production.  When a trigger condition
+ * is met, recording continues for configFLIGHT_RECORDER_POST_TRIGGER_EVENTS
+ * more events and then stops.  The history then holds the events leading up
+ * to the anomaly and the events that followed it, and it stays frozen until
+ * vFlightRecorderRearm() is called.  The application can poll
+ * xFlightRecorderIsFrozen() and read the history with
+ * uxFlightRecorderGetHistory(), for example to write it to flash or send it to
+ * a host, so rare stalls can be diagnosed without a debugger attached.
+ *
+ * The recorder is attached to the kernel through the trace macros, which this
+ * file defines when configUSE_FLIGHT_RECORDER is set to 1 in FreeRTOSConfig.h.
+ * FreeRTOSConfig.h must not then define the same trace macros.  Timestamps are
+ * read from portGET_CYCLE_COUNTER().
+ *
+ * The following conditions can trigger the freeze:
+ *
+ * - A task that was unblocked waited more than
+ *   configFLIGHT_RECORDER_READY_LATENCY_CYCLES cycles before it ran.
+ * - Interrupts were masked by a critical section for more than
+ *   configFLIGHT_RECORDER_CRITICAL_SECTION_CYCLES cycles.
+ * - A queue send failed because the queue was full, if
+ *   configFLIGHT_RECORDER_TRIGGER_ON_QUEUE_FULL is 1.
+ * - A heap allocation failed, if configFLIGHT_RECORDER_TRIGGER_ON_MALLOC_FAILED
+ *   is 1.
+ * - A call to xTaskDelayUntil() found that the wake time had already passed,
+ *   if configFLIGHT_RECORDER_TRIGGER_ON_DEADLINE_MISSED is 1.
+ * - The application calls vFlightRecorderTrigger().
+ *
+ * A threshold of 0 disables the trigger.
+ */
+
+/**
+ * flight_recorder.h
+ *
+ * The kinds of event held in the history.  An event of each kind is recorded
+ * every time it happens, except eFlightRecorderCriticalSection, which is only
+ * recorded when the critical section was long enough to trigger the recorder.
+ */
+typedef enum
+{
+    eFlightRecorderTaskReady = 0,   /* pvObject is the task that became ready. */
+    eFlightRecorderTaskSwitchedIn,  /* pvObject is the task selected to run.  ulValue is its ready latency in cycles, or 0 if it was not unblocked since it last ran. */
+    eFlightRecorderCriticalSection, /* ulValue is the length of the critical section in cycles. */
+    eFlightRecorderQueueFull,       /* pvObject is the queue. */
+    eFlightRecorderMallocFailed,    /* ulValue is the number of bytes requested. */
+    eFlightRecorderDeadlineMissed,  /* pvObject is the task.  ulValue is the wake time that had passed. */
+    eFlightRecorderUser             /* Recorded by the application. */
+} eFlightRecorderEvent;
+
+/**
+ * flight_recorder.h
+ *
+ * An entry in the history.
+ */
+typedef struct xFLIGHT_RECORDER_EVENT
+{
+    uint32_t ulCycles;    /*< portGET_CYCLE_COUNTER() when the event was recorded. */
+    uint32_t ulEvent;     /*< The eFlightRecorderEvent. */
+    const void * pvObject; /*< The task, queue or other object the event relates to, if any. */
+    uint32_t ulValue;     /*< Event specific value. */
+} FlightRecorderEvent_t;
+
+/**
+ * flight_recorder.h
+ * @code{c}
+ * void vFlightRecorderRecord( eFlightRecorderEvent eEvent, const void * pvObject, uint32_t ulValue );
+ * @endcode
+ *
+ * Add an event to the history.  Does nothing while the recorder is frozen.
+ * Can be called from tasks and interrupts.
+ *
+ * \defgroup vFlightRecorderRecord vFlightRecorderRecord
+ * \ingroup FlightRecorder
+ */
+void vFlightRecorderRecord( eFlightRecorderEvent eEvent,
+                            const void * pvObject,
+                            uint32_t ulValue ) PRIVILEGED_FUNCTION;
+
+/**
+ * flight_recorder.h
+ * @code{c}
+ * void vFlightRecorderTrigger( eFlightRecorderEvent eEvent, const void * pvObject, uint32_t ulValue );
+ * @endcode
+ *
+ * Add an event to the history and trigger the recorder, so the history is
+ * frozen configFLIGHT_RECORDER_POST_TRIGGER_EVENTS events later.  The event
+ * is also kept as the trigger event returned by uxFlightRecorderGetHistory().
+ * Does nothing if the recorder has already triggered.  Can be called from tasks
+ * and interrupts.
+ *
+ * \defgroup vFlightRecorderTrigger vFlightRecorderTrigger
+ * \ingroup FlightRecorder
+ */
+void vFlightRecorderTrigger( eFlightRecorderEvent eEvent,
+                             const void * pvObject,
+                             uint32_t ulValue ) PRIVILEGED_FUNCTION;
+
+/**
+ * flight_recorder.h
+ * @code{c}
+ * BaseType_t xFlightRecorderIsFrozen( void );
+ * @endcode
+ *
+ * @return pdTRUE if the recorder has triggered and the post trigger window has
+ * been recorded, otherwise pdFALSE.
+ *
+ * \defgroup xFlightRecorderIsFrozen xFlightRecorderIsFrozen
+ * \ingroup FlightRecorder
+ */
+BaseType_t xFlightRecorderIsFrozen( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * flight_recorder.h
+ * @code{c}
+ * UBaseType_t uxFlightRecorderGetHistory( FlightRecorderEvent_t * pxEvents, UBaseType_t uxMaxEvents, FlightRecorderEvent_t * pxTriggerEvent );
+ * @endcode
+ *
+ * Copy the history, oldest event first.  This can be called at any time, but
+ * the history only stops changing once xFlightRecorderIsFrozen() returns
+ * pdTRUE.
+ *
+ * @param pxEvents The array into which the events are copied.
+ *
+ * @param uxMaxEvents The length of pxEvents.  If the history holds more events
+ * than this, the newest uxMaxEvents events are copied.
+ *
+ * @param pxTriggerEvent If not NULL, the event that triggered the recorder is
+ * copied here.  Its ulEvent member is set to eFlightRecorderUser and its other
+ * members are 0 if the recorder has not triggered.
+ *
+ * @return The number of events copied to pxEvents.
+ *
+ * \defgroup uxFlightRecorderGetHistory uxFlightRecorderGetHistory
+ * \ingroup FlightRecorder
+ */
+UBaseType_t uxFlightRecorderGetHistory( FlightRecorderEvent_t * pxEvents,
+                                        UBaseType_t uxMaxEvents,
+                                        FlightRecorderEvent_t * pxTriggerEvent ) PRIVILEGED_FUNCTION;
+
+/**
+ * flight_recorder.h
+ * @code{c}
+ * void vFlightRecorderRearm( void );
+ * @endcode
+ *
+ * Clear the history and start recording again, ready for the next trigger.
+ *
+ * \defgroup vFlightRecorderRearm vFlightRecorderRearm
+ * \ingroup FlightRecorder
+ */
+void vFlightRecorderRearm( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * flight_recorder.h
+ * @code{c}
+ * void vFlightRecorderSetThresholds( uint32_t ulReadyLatencyCycles, uint32_t ulCriticalSectionCycles );
+ * @endcode
+ *
+ * Change the ready latency and critical section length triggers from the
+ * values set by configFLIGHT_RECORDER_READY_LATENCY_CYCLES and
+ * configFLIGHT_RECORDER_CRITICAL_SECTION_CYCLES.  0 disables a trigger.
+ *
+ * \defgroup vFlightRecorderSetThresholds vFlightRecorderSetThresholds
+ * \ingroup FlightRecorder
+ */
+void vFlightRecorderSetThresholds( uint32_t ulReadyLatencyCycles,
+                                   uint32_t ulCriticalSectionCycles ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called by the kernel and the port through the macros below.  Not part of
+ * the public API.
+ */
+void vFlightRecorderTaskSwitchedIn( const void * pvTask,
+                                    uint32_t ulReadyCycles ) PRIVILEGED_FUNCTION;
+void vFlightRecorderCriticalSection( uint32_t ulCycles ) PRIVILEGED_FUNCTION;
+
+/* The cycle count at which a task became ready is kept in its TCB.  0 means
+ * the task has not been unblocked since it last ran, so the stamp has its
+ * bottom bit forced to 1. */
+#define traceMOVED_TASK_TO_READY_STATE( pxTCB )                                            \
+    do {                                                                                   \
+        ( pxTCB )->ulFlightRecorderReadyCycles = portGET_CYCLE_COUNTER() | 1UL;            \
+        vFlightRecorderRecord( eFlightRecorderTaskReady, ( const void * ) ( pxTCB ), 0UL ); \
+    } while( 0 )
+
+#define traceTASK_SWITCHED_OUT()    ( pxCurrentTCB->ulFlightRecorderReadyCycles = 0UL )
+
+#define traceTASK_SWITCHED_IN()                                                                                    \
+    do {                                                                                                           \
+        vFlightRecorderTaskSwitchedIn( ( const void * ) pxCurrentTCB, pxCurrentTCB->ulFlightRecorderReadyCycles ); \
+        pxCurrentTCB->ulFlightRecorderReadyCycles = 0UL;                                                           \
+    } while( 0 )
+
+#if ( configFLIGHT_RECORDER_TRIGGER_ON_QUEUE_FULL == 1 )
+    #define traceQUEUE_SEND_FAILED( pxQueue )             vFlightRecorderTrigger( eFlightRecorderQueueFull, ( const void * ) ( pxQueue ), 0UL )
+    #define traceQUEUE_SEND_FROM_ISR_FAILED( pxQueue )    vFlightRecorderTrigger( eFlightRecorderQueueFull, ( const void * ) ( pxQueue ), 0UL )
+#else
+    #define traceQUEUE_SEND_FAILED( pxQueue )             vFlightRecorderRecord( eFlightRecorderQueueFull, ( const void * ) ( pxQueue ), 0UL )
+    #define traceQUEUE_SEND_FROM_ISR_FAILED( pxQueue )    vFlightRecorderRecord( eFlightRecorderQueueFull, ( const void * ) ( pxQueue ), 0UL )
+#endif
+
+#if ( configFLIGHT_RECORDER_TRIGGER_ON_MALLOC_FAILED == 1 )
+    #define traceMALLOC( pvAddress, uiSize )                                                     \
+    do {                                                                                         \
+        if( ( pvAddress ) == NULL )                                                              \
+        {                                                                                        \
+            vFlightRecorderTrigger( eFlightRecorderMallocFailed, NULL, ( uint32_t ) ( uiSize ) ); \
+        }                                                                                        \
+    } while( 0 )
+#else
+    #define traceMALLOC( pvAddress, uiSize )                                                    \
+    do {                                                                                        \
+        if( ( pvAddress ) == NULL )                                                             \
+        {                                                                                       \
+            vFlightRecorderRecord( eFlightRecorderMallocFailed, NULL, ( uint32_t ) ( uiSize ) ); \
+        }                                                                                       \
+    } while( 0 )
+#endif
+
+#if ( configFLIGHT_RECORDER_TRIGGER_ON_DEADLINE_MISSED == 1 )
+    #define traceTASK_DELAY_UNTIL_MISSED( xTimeToWake )    vFlightRecorderTrigger( eFlightRecorderDeadlineMissed, ( const void * ) pxCurrentTCB, ( uint32_t ) ( xTimeToWake ) )
+#else
+    #define traceTASK_DELAY_UNTIL_MISSED( xTimeToWake )    vFlightRecorderRecord( eFlightRecorderDeadlineMissed, ( const void * ) pxCurrentTCB, ( uint32_t ) ( xTimeToWake ) )
+#endif
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* FLIGHT_RECORDER_H */
@@ -0,0 +1,345 @@
+/*
+ * FreeRTOS Kernel V10.5.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers.  That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "stream_buffer.h"
+#include "io_ring.h"
+
+/* Lint e961, e750 and e9021 are suppressed as a MISRA exception justified
+ * because the MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750 !e9021 See comment above. */
+
+/* This entire source file will be skipped if the application is not configured
+ * to include I/O ring functionality.  This #if is closed at the very bottom of
+ * this file. */
+#if ( configUSE_IO_RING == 1 )
+
+/* The definition of an I/O ring.  The submission queue entries follow the
+ * structure in the same allocation. */
+    typedef struct IoRingDef_t
+    {
+        IoRingSqe_t * pxSqes;                /*< The submission queue, uxDepth entries long. */
+        UBaseType_t uxDepth;                 /*< The maximum number of operations in flight. */
+        UBaseType_t uxSqHead;                /*< The index of the oldest entry in the submission queue. */
+        UBaseType_t uxSqCount;               /*< The number of entries in the submission queue. */
+        volatile UBaseType_t uxInFlight;     /*< Operations submitted whose completions have not been collected. */
+        StreamBufferHandle_t xCompletions;   /*< The completion queue. */
+        IoRingKickFunction_t pxKick;         /*< The driver function called after operations are submitted. */
+        void * pvDriverContext;              /*< Passed to pxKick. */
+    } IoRing_t;
+
+/*-----------------------------------------------------------*/
+
+    IoRingHandle_t xIoRingCreate( UBaseType_t uxDepth,
+                                  IoRingKickFunction_t pxKick,
+                                  void * pvDriverContext )
+    {
+        IoRing_t * pxRing;
+
+        configASSERT( uxDepth > ( UBaseType_t ) 0U );
+        configASSERT( pxKick );
+
+        pxRing = ( IoRing_t * ) pvPortMalloc( sizeof( IoRing_t ) + ( ( size_t ) uxDepth * sizeof( IoRingSqe_t ) ) ); /*lint !e9087 !e9079 The submission queue follows the structure. */
+
+        if( pxRing != NULL )
+        {
+            /* The completion queue can hold a completion for every operation
+             * in flight, so a driver can always complete. */
+            pxRing->xCompletions = xStreamBufferCreate( ( size_t ) uxDepth * sizeof( IoRingCqe_t ), sizeof( IoRingCqe_t ) );
+
+            if( pxRing->xCompletions != NULL )
+            {
+                pxRing->pxSqes = ( IoRingSqe_t * ) &( pxRing[ 1 ] ); /*lint !e9087 The submission queue follows the structure. */
+                pxRing->uxDepth = uxDepth;
+                pxRing->uxSqHead = ( UBaseType_t ) 0U;
+                pxRing->uxSqCount = ( UBaseType_t ) 0U;
+                pxRing->uxInFlight = ( UBaseType_t ) 0U;
+                pxRing->pxKick = pxKick;
+                pxRing->pvDriverContext = pvDriverContext;
+            }
+            else
+            {
+                vPortFree( pxRing );
+                pxRing = NULL;
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return pxRing;
+    }
+/*-----------------------------------------------------------*/
+
+    void vIoRingDelete( IoRingHandle_t xRing )
+    {
+        IoRing_t * const pxRing = xRing;
+
+        configASSERT( pxRing );
+
+        vStreamBufferDelete( pxRing->xCompletions );
+        vPortFree( pxRing );
+    }
+/*-----------------------------------------------------------*/
+
+    UBaseType_t uxIoRingSubmit( IoRingHandle_t xRing,
+                                const IoRingSqe_t * pxSqes,
+                                UBaseType_t uxCount )
+    {
+        IoRing_t * const pxRing = xRing;
+        UBaseType_t uxSubmitted = ( UBaseType_t ) 0U;
+        UBaseType_t uxTail;
+
+        configASSERT( pxRing );
+        configASSERT( ( pxSqes != NULL ) || ( uxCount == ( UBaseType_t ) 0U ) );
+
+        /* The driver can take entries from an interrupt, so the queue is
+         * protected by a critical section.  Entries are copied one at a time to
+         * keep the critical sections short. */
+        while( uxSubmitted < uxCount )
+        {
+            taskENTER_CRITICAL();
+            {
+                if( pxRing->uxInFlight < pxRing->uxDepth )
+                {
+                    uxTail = pxRing->uxSqHead + pxRing->uxSqCount;
+
+                    if( uxTail >= pxRing->uxDepth )
+                    {
+                        uxTail -= pxRing->uxDepth;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    pxRing->pxSqes[ uxTail ] = pxSqes[ uxSubmitted ];
+                    ( pxRing->uxSqCount )++;
+                    ( pxRing->uxInFlight )++;
+                    uxSubmitted++;
+                }
+                else
+                {
+                    /* The ring is full. */
+                    uxCount = uxSubmitted;
+                }
+            }
+            taskEXIT_CRITICAL();
+        }
+
+        if( uxSubmitted > ( UBaseType_t ) 0U )
+        {
+            pxRing->pxKick( pxRing, pxRing->pvDriverContext );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return uxSubmitted;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xIoRingTakeSqe( IoRingHandle_t xRing,
+                               IoRingSqe_t * pxSqe )
+    {
+        IoRing_t * const pxRing = xRing;
+        BaseType_t xReturn = pdFALSE;
+        UBaseType_t uxSavedInterruptStatus;
+
+        configASSERT( pxRing );
+        configASSERT( pxSqe );
+
+        uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+        {
+            if( pxRing->uxSqCount > ( UBaseType_t ) 0U )
+            {
+                *pxSqe = pxRing->pxSqes[ pxRing->uxSqHead ];
+                ( pxRing->uxSqHead )++;
+
+                if( pxRing->uxSqHead == pxRing->uxDepth )
+                {
+                    pxRing->uxSqHead = ( UBaseType_t ) 0U;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                ( pxRing->uxSqCount )--;
+                xReturn = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    void vIoRingCompleteFromISR( IoRingHandle_t xRing,
+                                 void * pvUserData,
+                                 int32_t lResult,
+                                 BaseType_t * pxHigherPriorityTaskWoken )
+    {
+        IoRing_t * const pxRing = xRing;
+        IoRingCqe_t xCqe;
+        size_t xBytesSent;
+        UBaseType_t uxSavedInterruptStatus;
+
+        configASSERT( pxRing );
+
+        xCqe.pvUserData = pvUserData;
+        xCqe.lResult = lResult;
+
+        /* A stream buffer only supports one writer at a time, and drivers can
+         * complete from interrupts of different priorities. */
+        uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+        {
+            xBytesSent = xStreamBufferSendFromISR( pxRing->xCompletions, &xCqe, sizeof( xCqe ), pxHigherPriorityTaskWoken );
+        }
+        taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+
+        /* There is always room for the completions of the operations in
+         * flight. */
+        configASSERT( xBytesSent == sizeof( xCqe ) );
+        ( void ) xBytesSent;
+    }
+/*-----------------------------------------------------------*/
+
+    void vIoRingComplete( IoRingHandle_t xRing,
+                          void * pvUserData,
+                          int32_t lResult )
+    {
+        BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+        vIoRingCompleteFromISR( xRing, pvUserData, lResult, &xHigherPriorityTaskWoken );
+
+        if( xHigherPriorityTaskWoken != pdFALSE )
+        {
+            taskYIELD();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    UBaseType_t uxIoRingWait( IoRingHandle_t xRing,
+                              IoRingCqe_t * pxCqes,
+                              UBaseType_t uxMaxCompletions,
+                              UBaseType_t uxMinCompletions,
+                              TickType_t xTicksToWait )
+    {
+        IoRing_t * const pxRing = xRing;
+        UBaseType_t uxReceived = ( UBaseType_t ) 0U;
+        size_t xBytesReceived;
+        TimeOut_t xTimeOut;
+
+        configASSERT( pxRing );
+        configASSERT( pxCqes );
+        configASSERT( uxMinCompletions <= uxMaxCompletions );
+        configASSERT( uxMinCompletions <= pxRing->uxDepth );
+
+        if( uxMinCompletions == ( UBaseType_t ) 0U )
+        {
+            xTicksToWait = ( TickType_t ) 0U;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        vTaskSetTimeOutState( &xTimeOut );
+
+        for( ; ; )
+        {
+            /* Only unblock once the rest of the completions asked for have
+             * arrived.  The trigger level is checked by the stream buffer when
+             * the driver writes a completion, so the task is not woken once
+             * per completion. */
+            ( void ) xStreamBufferSetTriggerLevel( pxRing->xCompletions, ( size_t ) ( uxMinCompletions - uxReceived ) * sizeof( IoRingCqe_t ) );
+
+            /* Each completion is written whole, so only whole completions are
+             * ever read. */
+            xBytesReceived = xStreamBufferReceive( pxRing->xCompletions,
+                                                   &( pxCqes[ uxReceived ] ),
+                                                   ( size_t ) ( uxMaxCompletions - uxReceived ) * sizeof( IoRingCqe_t ),
+                                                   xTicksToWait );
+            uxReceived += ( UBaseType_t ) ( xBytesReceived / sizeof( IoRingCqe_t ) );
+
+            if( ( uxReceived >= uxMinCompletions ) || ( uxReceived == uxMaxCompletions ) )
+            {
+                break;
+            }
+            else if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) != pdFALSE )
+            {
+                break;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        taskENTER_CRITICAL();
+        {
+            pxRing->uxInFlight -= uxReceived;
+        }
+        taskEXIT_CRITICAL();
+
+        return uxReceived;
+    }
+/*-----------------------------------------------------------*/
+
+    UBaseType_t uxIoRingGetInFlight( IoRingHandle_t xRing )
+    {
+        configASSERT( xRing );
+
+        return xRing->uxInFlight;
+    }
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+ * to include I/O ring functionality.  If you want to include I/O ring
+ * functionality then ensure configUSE_IO_RING is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_IO_RING == 1 */
@@ -0,0 +1,337 @@
+/*
+ * FreeRTOS Kernel V10.5.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+#ifndef IO_RING_H
+#define IO_RING_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h" must appear in source files before "include io_ring.h"
+#endif
+
+/* FreeRTOS includes. */
+#include "stream_buffer.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * An I/O ring lets one task keep many driver operations in flight without a
+ * helper task per operation.  The task places operation descriptors (SQEs) in
+ * the ring's submission queue with uxIoRingSubmit().  The driver takes them
+ * with xIoRingTakeSqe(), starts the transfer, and reports the result from its
+ * interrupt with vIoRingCompleteFromISR(), which writes a completion (CQE) to
+ * a stream buffer.  The task then collects any number of completions with a
+ * single call to uxIoRingWait(), blocking until at least the number it asks
+ * for have arrived.
+ *
+ * A ring accepts at most the depth it was created with of operations that have
+ * been submitted but whose completions have not yet been collected, so the
+ * completion stream buffer always has room and a driver never has to handle a
+ * full ring.  Only one task may call uxIoRingWait() on a ring.
+ *
+ * configUSE_IO_RING must be set to 1 in FreeRTOSConfig.h for I/O rings to be
+ * available.
+ */
+
+/**
+ * io_ring.h
+ *
+ * Type by which I/O rings are referenced.
+ *
+ * \defgroup IoRingHandle_t IoRingHandle_t
+ * \ingroup IoRing
+ */
+struct IoRingDef_t;
+typedef struct IoRingDef_t * IoRingHandle_t;
+
+/**
+ * io_ring.h
+ *
+ * A submission queue entry, describing one operation.  The meaning of
+ * ulOpcode, ulOffset, pvBuffer and xLength is defined by the driver.
+ *
+ * \defgroup IoRingSqe_t IoRingSqe_t
+ * \ingroup IoRing
+ */
+typedef struct xIO_RING_SQE
+{
+    uint32_t ulOpcode;  /*< The operation, for example read or write. */
+    uint32_t ulOffset;  /*< Where in the device to transfer, for example a flash address or I2C register. */
+    void * pvBuffer;    /*< The data to write, or where to place the data read. */
+    size_t xLength;     /*< The number of bytes to transfer. */
+    void * pvUserData;  /*< Returned unchanged in the completion, to identify the operation. */
+} IoRingSqe_t;
+
+/**
+ * io_ring.h
+ *
+ * A completion queue entry, reporting the result of one operation.
+ *
+ * \defgroup IoRingCqe_t IoRingCqe_t
+ * \ingroup IoRing
+ */
+typedef struct xIO_RING_CQE
+{
+    void * pvUserData; /*< The pvUserData member of the completed operation. */
+    int32_t lResult;   /*< Defined by the driver.  By convention the number of bytes transferred, or a negative error code. */
+} IoRingCqe_t;
+
+/**
+ * io_ring.h
+ *
+ * Defines the prototype to which driver kick functions must conform.  The kick
+ * function is called from uxIoRingSubmit(), in the context of the submitting
+ * task, after new operations were added to the submission queue.  If the
+ * driver is idle it should take an operation with xIoRingTakeSqe() and start
+ * it.  A busy driver can ignore the call, as it takes the next operation when
+ * the current one completes.
+ *
+ * \defgroup IoRingKickFunction_t IoRingKickFunction_t
+ * \ingroup IoRing
+ */
+typedef void (* IoRingKickFunction_t)( IoRingHandle_t xRing,
+                                       void * pvDriverContext );
+
+/**
+ * io_ring.h
+ * @code{c}
+ * IoRingHandle_t xIoRingCreate( UBaseType_t uxDepth, IoRingKickFunction_t pxKick, void * pvDriverContext );
+ * @endcode
+ *
+ * Create an I/O ring served by one driver.
+ *
+ * Example usage:
+ * @code{c}
+ * static IoRingHandle_t xFlashRing;
+ *
+ * static void prvFlashKick( IoRingHandle_t xRing, void * pvContext )
+ * {
+ *     IoRingSqe_t xSqe;
+ *
+ *     if( ( xFlashBusy == pdFALSE ) && ( xIoRingTakeSqe( xRing, &xSqe ) != pdFALSE ) )
+ *     {
+ *         xFlashBusy = pdTRUE;
+ *         vFlashStartDma( &xSqe );
+ *     }
+ * }
+ *
+ * void FLASH_DMA_IRQHandler( void )
+ * {
+ *     BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+ *     IoRingSqe_t xSqe;
+ *
+ *     vIoRingCompleteFromISR( xFlashRing, pvCurrentUserData, lCurrentResult, &xHigherPriorityTaskWoken );
+ *
+ *     // Start the next operation straight away.
+ *     if( xIoRingTakeSqe( xFlashRing, &xSqe ) != pdFALSE )
+ *     {
+ *         vFlashStartDma( &xSqe );
+ *     }
+ *     else
+ *     {
+ *         xFlashBusy = pdFALSE;
+ *     }
+ *
+ *     portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+ * }
+ *
+ * void vReaderTask( void * pvParameters )
+ * {
+ *     IoRingSqe_t xReads[ 3 ];
+ *     IoRingCqe_t xDone[ 3 ];
+ *
+ *     xFlashRing = xIoRingCreate( 8, prvFlashKick, NULL );
+ *
+ *     // ... fill in xReads ...
+ *     uxIoRingSubmit( xFlashRing, xReads, 3 );
+ *
+ *     // Block once for all three reads.
+ *     uxIoRingWait( xFlashRing, xDone, 3, 3, portMAX_DELAY );
+ * }
+ * @endcode
+ *
+ * @param uxDepth The maximum number of operations that can be in flight - that
+ * is submitted but not yet collected with uxIoRingWait().
+ *
+ * @param pxKick The driver function called when operations are submitted.
+ *
+ * @param pvDriverContext Passed to pxKick.
+ *
+ * @return The handle of the ring, or NULL if there was not enough heap.
+ *
+ * \defgroup xIoRingCreate xIoRingCreate
+ * \ingroup IoRing
+ */
+IoRingHandle_t xIoRingCreate( UBaseType_t uxDepth,
+                              IoRingKickFunction_t pxKick,
+                              void * pvDriverContext ) PRIVILEGED_FUNCTION;
+
+/**
+ * io_ring.h
+ * @code{c}
+ * void vIoRingDelete( IoRingHandle_t xRing );
+ * @endcode
+ *
+ * Delete a ring.  The driver must not be using the ring, and no task may be
+ * waiting on it.
+ *
+ * \defgroup vIoRingDelete vIoRingDelete
+ * \ingroup IoRing
+ */
+void vIoRingDelete( IoRingHandle_t xRing ) PRIVILEGED_FUNCTION;
+
+/**
+ * io_ring.h
+ * @code{c}
+ * UBaseType_t uxIoRingSubmit( IoRingHandle_t xRing, const IoRingSqe_t * pxSqes, UBaseType_t uxCount );
+ * @endcode
+ *
+ * Copy operations into the submission queue, then call the driver's kick
+ * function.  Must be called from a task.
+ *
+ * @param pxSqes The operations to submit.
+ *
+ * @param uxCount The number of operations in pxSqes.
+ *
+ * @return The number of operations submitted, which is less than uxCount if
+ * the ring is full.  Operations are submitted in order, so the ones that were
+ * not submitted are at the end of pxSqes.
+ *
+ * \defgroup uxIoRingSubmit uxIoRingSubmit
+ * \ingroup IoRing
+ */
+UBaseType_t uxIoRingSubmit( IoRingHandle_t xRing,
+                            const IoRingSqe_t * pxSqes,
+                            UBaseType_t uxCount ) PRIVILEGED_FUNCTION;
+
+/**
+ * io_ring.h
+ * @code{c}
+ * BaseType_t xIoRingTakeSqe( IoRingHandle_t xRing, IoRingSqe_t * pxSqe );
+ * @endcode
+ *
+ * Used by the driver to take the oldest submitted operation.  Can be called
+ * from tasks and from interrupts.
+ *
+ * @param pxSqe Where to copy the operation.
+ *
+ * @return pdTRUE if an operation was taken, pdFALSE if the submission queue is
+ * empty.
+ *
+ * \defgroup xIoRingTakeSqe xIoRingTakeSqe
+ * \ingroup IoRing
+ */
+BaseType_t xIoRingTakeSqe( IoRingHandle_t xRing,
+                           IoRingSqe_t * pxSqe ) PRIVILEGED_FUNCTION;
+
+/**
+ * io_ring.h
+ * @code{c}
+ * void vIoRingCompleteFromISR( IoRingHandle_t xRing, void * pvUserData, int32_t lResult, BaseType_t * pxHigherPriorityTaskWoken );
+ * void vIoRingComplete( IoRingHandle_t xRing, void * pvUserData, int32_t lResult );
+ * @endcode
+ *
+ * Used by the driver to report that an operation taken with xIoRingTakeSqe()
+ * has finished.  vIoRingCompleteFromISR() is used from interrupts, and
+ * vIoRingComplete() from tasks, for example by a driver that completes some
+ * operations without a transfer.
+ *
+ * @param pvUserData The pvUserData member of the operation.
+ *
+ * @param lResult The result of the operation.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if the completion unblocked a
+ * task with a priority above the interrupted task.
+ *
+ * \defgroup vIoRingCompleteFromISR vIoRingCompleteFromISR
+ * \ingroup IoRing
+ */
+void vIoRingCompleteFromISR( IoRingHandle_t xRing,
+                             void * pvUserData,
+                             int32_t lResult,
+                             BaseType_t * pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+void vIoRingComplete( IoRingHandle_t xRing,
+                      void * pvUserData,
+                      int32_t lResult ) PRIVILEGED_FUNCTION;
+
+/**
+ * io_ring.h
+ * @code{c}
+ * UBaseType_t uxIoRingWait( IoRingHandle_t xRing, IoRingCqe_t * pxCqes, UBaseType_t uxMaxCompletions, UBaseType_t uxMinCompletions, TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Collect completions, blocking until at least uxMinCompletions are available
+ * or xTicksToWait expires.  The stream buffer trigger level is set so the task
+ * is only unblocked once enough completions have arrived.  Completions are
+ * returned in the order the driver reported them.
+ *
+ * @param pxCqes Where to copy the completions.
+ *
+ * @param uxMaxCompletions The number of completions pxCqes can hold.
+ *
+ * @param uxMinCompletions The number of completions to wait for.  Must not be
+ * greater than uxMaxCompletions or the ring depth.  If 0, the function does not
+ * block.
+ *
+ * @param xTicksToWait The maximum time to wait.
+ *
+ * @return The number of completions copied to pxCqes.
+ *
+ * \defgroup uxIoRingWait uxIoRingWait
+ * \ingroup IoRing
+ */
+UBaseType_t uxIoRingWait( IoRingHandle_t xRing,
+                          IoRingCqe_t * pxCqes,
+                          UBaseType_t uxMaxCompletions,
+                          UBaseType_t uxMinCompletions,
+                          TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * io_ring.h
+ * @code{c}
+ * UBaseType_t uxIoRingGetInFlight( IoRingHandle_t xRing );
+ * @endcode
+ *
+ * @return The number of operations submitted to the ring whose completions
+ * have not yet been collected.
+ *
+ * \defgroup uxIoRingGetInFlight uxIoRingGetInFlight
+ * \ingroup IoRing
+ */
+UBaseType_t uxIoRingGetInFlight( IoRingHandle_t xRing ) PRIVILEGED_FUNCTION;
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* IO_RING_H */
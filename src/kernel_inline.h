@@ -0,0 +1,198 @@
+/*
+ * FreeRTOS Kernel V10.5.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+#ifndef KERNEL_INLINE_H
+#define KERNEL_INLINE_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h" must appear in source files before "include kernel_inline.h"
+#endif
+
+#include "task.h"
+#include "queue.h"
+#include "stream_buffer.h"
+
+#if ( configUSE_INLINE_KERNEL_QUERIES != 1 )
+    #error configUSE_INLINE_KERNEL_QUERIES must be set to 1 in FreeRTOSConfig.h to use kernel_inline.h
+#endif
+
+#if ( portUSING_MPU_WRAPPERS == 1 )
+    #error kernel_inline.h reads kernel data directly, so cannot be used by unprivileged MPU tasks
+#endif
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * Inline versions of frequently called read only kernel queries, for code that
+ * calls them often enough for the function call and critical section to
+ * matter, such as control loops.  Each reads a single word that the port reads
+ * and writes atomically, so no critical section is needed.  The result is the
+ * same as the out of line function would have returned at some point during
+ * the call, which is all the out of line functions guarantee.
+ *
+ * The out of line functions remain available and unchanged.  This header is
+ * not included by any kernel header, so it is only used by source files that
+ * include it explicitly.  Including it makes the kernel variables it reads
+ * part of the kernel's interface, so code that uses it must be rebuilt along
+ * with the kernel.
+ */
+
+/* Kernel data read by the inline queries.  tasks.c only gives these external
+ * linkage when configUSE_INLINE_KERNEL_QUERIES is 1. */
+extern struct tskTaskControlBlock * volatile pxCurrentTCB;
+extern volatile TickType_t xTickCount;
+extern volatile BaseType_t xSchedulerRunning;
+extern volatile UBaseType_t uxSchedulerSuspended;
+
+/**
+ * kernel_inline.h
+ *
+ * Inline equivalent of xTaskGetTickCount().  Only inlined where the port reads
+ * TickType_t atomically, otherwise xTaskGetTickCount() is called.  Never
+ * inlined with configUSE_ADAPTIVE_TICK, as xTickCount lags while the tick is
+ * deferred.
+ *
+ * \ingroup TaskUtils
+ */
+portFORCE_INLINE static TickType_t xTaskGetTickCountInline( void )
+{
+    #if ( ( portTICK_TYPE_IS_ATOMIC == 1 ) && ( configUSE_ADAPTIVE_TICK == 0 ) )
+        return xTickCount;
+    #else
+        return xTaskGetTickCount();
+    #endif
+}
+
+/**
+ * kernel_inline.h
+ *
+ * Inline equivalent of xTaskGetCurrentTaskHandle().
+ *
+ * \ingroup TaskUtils
+ */
+portFORCE_INLINE static TaskHandle_t xTaskGetCurrentTaskHandleInline( void )
+{
+    return pxCurrentTCB;
+}
+
+/**
+ * kernel_inline.h
+ *
+ * Inline equivalent of xTaskGetSchedulerState().
+ *
+ * \ingroup TaskUtils
+ */
+portFORCE_INLINE static BaseType_t xTaskGetSchedulerStateInline( void )
+{
+    BaseType_t xReturn;
+
+    if( xSchedulerRunning == pdFALSE )
+    {
+        xReturn = taskSCHEDULER_NOT_STARTED;
+    }
+    else if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+    {
+        xReturn = taskSCHEDULER_RUNNING;
+    }
+    else
+    {
+        xReturn = taskSCHEDULER_SUSPENDED;
+    }
+
+    return xReturn;
+}
+
+/**
+ * kernel_inline.h
+ *
+ * Inline equivalent of uxQueueMessagesWaiting().  Reads the queue through the
+ * layout of StaticQueue_t, which matches the real queue structure.
+ *
+ * \ingroup QueueManagement
+ */
+portFORCE_INLINE static UBaseType_t uxQueueMessagesWaitingInline( const QueueHandle_t xQueue )
+{
+    /* uxDummy4[ 0 ] is uxMessagesWaiting. */
+    return ( ( const volatile StaticQueue_t * ) xQueue )->uxDummy4[ 0 ];
+}
+
+/**
+ * kernel_inline.h
+ *
+ * Inline equivalent of uxQueueSpacesAvailable().  The queue length never
+ * changes, so only the number of items waiting needs to be read atomically.
+ *
+ * \ingroup QueueManagement
+ */
+portFORCE_INLINE static UBaseType_t uxQueueSpacesAvailableInline( const QueueHandle_t xQueue )
+{
+    const volatile StaticQueue_t * const pxQueue = ( const volatile StaticQueue_t * ) xQueue;
+
+    /* uxDummy4[ 1 ] is uxLength. */
+    return pxQueue->uxDummy4[ 1 ] - pxQueue->uxDummy4[ 0 ];
+}
+
+/**
+ * kernel_inline.h
+ *
+ * Inline equivalent of xStreamBufferBytesAvailable().  Reads the stream
+ * buffer through the layout of StaticStreamBuffer_t, which matches the real
+ * stream buffer structure.
+ *
+ * \ingroup StreamBufferManagement
+ */
+portFORCE_INLINE static size_t xStreamBufferBytesAvailableInline( StreamBufferHandle_t xStreamBuffer )
+{
+    const volatile StaticStreamBuffer_t * const pxStreamBuffer = ( const volatile StaticStreamBuffer_t * ) xStreamBuffer;
+    size_t xLength = pxStreamBuffer->uxDummy1[ 2 ];
+    size_t xCount;
+
+    /* uxDummy1[ 0 ] is xTail, uxDummy1[ 1 ] is xHead and uxDummy1[ 2 ] is
+     * xLength. */
+    xCount = xLength + pxStreamBuffer->uxDummy1[ 1 ];
+    xCount -= pxStreamBuffer->uxDummy1[ 0 ];
+
+    if( xCount >= xLength )
+    {
+        xCount -= xLength;
+    }
+
+    return xCount;
+}
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* KERNEL_INLINE_H */
@@ -0,0 +1,537 @@
+/*
+ * FreeRTOS Kernel V10.5.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Standard includes. */
+#include <stdio.h>
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers.  That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "latency_search.h"
+
+/* Lint e961, e750 and e9021 are suppressed as a MISRA exception justified
+ * because the MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750 !e9021 See comment above. */
+
+/* This entire source file will be skipped if the application is not configured
+ * to include the latency search.  This #if is closed at the very bottom of this
+ * file. */
+#if ( configUSE_LATENCY_SEARCH == 1 )
+
+/* The number of latencysoakLOAD_ bits. */
+    #define latencysearchLOAD_COUNT            ( 5U )
+
+/* The number of kinds of mutation prvMutate() chooses from, and the most
+ * mutations it applies to one scenario. */
+    #define latencysearchMUTATION_KINDS        ( 7UL )
+    #define latencysearchMAX_MUTATIONS         ( 3UL )
+
+/* The number of simplifications prvSimplify() knows: clearing each load bit,
+ * then the four below. */
+    #define latencysearchSIMPLIFY_PERIOD_STEP  ( latencysearchLOAD_COUNT )
+    #define latencysearchSIMPLIFY_SPACING      ( latencysearchLOAD_COUNT + 1U )
+    #define latencysearchSIMPLIFY_TIMERS       ( latencysearchLOAD_COUNT + 2U )
+    #define latencysearchSIMPLIFY_WAITERS      ( latencysearchLOAD_COUNT + 3U )
+    #define latencysearchSIMPLIFY_STEPS        ( latencysearchLOAD_COUNT + 4U )
+
+/* A simplification is kept if the scenario still reaches this percentage of
+ * the worst latency.  Latency varies from run to run, so requiring the whole
+ * of it would keep loads that do not matter. */
+    #define latencysearchMINIMISE_PERCENT      ( 90ULL )
+
+/* The most characters in one line written by vLatencySearchPrintReproducer(). */
+    #define latencysearchLINE_LENGTH           ( 192U )
+
+/*-----------------------------------------------------------*/
+
+/*
+ * A scenario and the latencies it produced.
+ */
+    typedef struct xLATENCY_SEARCH_ENTRY
+    {
+        LatencySoakConfig_t xScenario;
+        uint32_t ulReadyCycles;
+        uint32_t ulCriticalCycles;
+    } LatencySearchEntry_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Advance the pseudo random generator and return its next value.
+ */
+    static uint32_t prvRandom( uint32_t * pulState ) PRIVILEGED_FUNCTION;
+
+/*
+ * Run a scenario as a soak for xRunTicks and record the worst latencies it
+ * produced in pxEntry.  Returns pdFAIL if the soak could not start.
+ */
+    static BaseType_t prvRunScenario( LatencySearchEntry_t * pxEntry,
+                                      TickType_t xRunTicks ) PRIVILEGED_FUNCTION;
+
+/*
+ * Apply between one and latencysearchMAX_MUTATIONS random mutations to a
+ * scenario, within the bounds set by pxConfig.
+ */
+    static void prvMutate( LatencySoakConfig_t * pxScenario,
+                           const LatencySearchConfig_t * pxConfig,
+                           uint32_t * pulState ) PRIVILEGED_FUNCTION;
+
+/*
+ * Apply simplification uxStep to a scenario.  Returns pdFALSE if the step
+ * would not change anything that affects the run.
+ */
+    static BaseType_t prvSimplify( LatencySoakConfig_t * pxScenario,
+                                   UBaseType_t uxStep ) PRIVILEGED_FUNCTION;
+
+/*
+ * Add a scenario to the corpus, replacing the entry with the lowest latency
+ * once the corpus is full.
+ */
+    static void prvAddToCorpus( const LatencySearchEntry_t * pxEntry ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+/* The scenarios that raised a worst latency, which later scenarios are
+ * mutated from. */
+    PRIVILEGED_DATA static LatencySearchEntry_t xCorpus[ configLATENCY_SEARCH_CORPUS_SIZE ];
+    PRIVILEGED_DATA static UBaseType_t uxCorpusCount = ( UBaseType_t ) 0U;
+
+/* The names of the latencysoakLOAD_ bits, in bit order, for the reproducer. */
+    static const char * const pcLoadNames[ latencysearchLOAD_COUNT ] =
+    {
+        "latencysoakLOAD_QUEUE_STORM",
+        "latencysoakLOAD_HEAP_CHURN",
+        "latencysoakLOAD_TIMER_BURST",
+        "latencysoakLOAD_ISR_FLOOD",
+        "latencysoakLOAD_EVENT_GROUP"
+    };
+
+/*-----------------------------------------------------------*/
+
+    BaseType_t xLatencySearchRun( const LatencySearchConfig_t * pxConfig,
+                                  LatencySearchResult_t * pxResult )
+    {
+        LatencySearchEntry_t xWorst;
+        LatencySearchEntry_t xCandidate;
+        uint32_t ulWorstCritical = 0UL;
+        uint32_t ulThreshold;
+        uint32_t ulState;
+        uint32_t ulIteration;
+        UBaseType_t uxStep;
+        BaseType_t xFound = pdFALSE;
+
+        configASSERT( pxConfig );
+        configASSERT( pxResult );
+        configASSERT( pxConfig->xMaxPeriod != ( TickType_t ) 0U );
+        configASSERT( pxConfig->uxMaxBurstTimers != ( UBaseType_t ) 0U );
+        configASSERT( pxConfig->uxMaxEventWaiters != ( UBaseType_t ) 0U );
+
+        ( void ) memset( pxResult, 0x00, sizeof( LatencySearchResult_t ) );
+        ( void ) memset( &xWorst, 0x00, sizeof( xWorst ) );
+        ulState = pxConfig->ulSeed;
+        uxCorpusCount = ( UBaseType_t ) 0U;
+
+        /* Give the counts a valid value even if the first scenario does not
+         * use them, so that switching a load on makes a valid scenario. */
+        xCandidate.xScenario = pxConfig->xBase;
+        xCandidate.xScenario.ulLoads &= pxConfig->ulAllowedLoads;
+
+        if( xCandidate.xScenario.uxBurstTimers == ( UBaseType_t ) 0U )
+        {
+            xCandidate.xScenario.uxBurstTimers = ( UBaseType_t ) 1U;
+        }
+
+        if( xCandidate.xScenario.xBurstPeriod == ( TickType_t ) 0U )
+        {
+            xCandidate.xScenario.xBurstPeriod = ( TickType_t ) 1U;
+        }
+
+        if( xCandidate.xScenario.uxEventWaiters == ( UBaseType_t ) 0U )
+        {
+            xCandidate.xScenario.uxEventWaiters = ( UBaseType_t ) 1U;
+        }
+
+        for( ulIteration = 0UL; ulIteration <= pxConfig->ulIterations; ulIteration++ )
+        {
+            /* The first pass runs the base scenario unchanged. */
+            if( ulIteration != 0UL )
+            {
+                if( uxCorpusCount != ( UBaseType_t ) 0U )
+                {
+                    xCandidate.xScenario = xCorpus[ prvRandom( &ulState ) % uxCorpusCount ].xScenario;
+                }
+
+                prvMutate( &( xCandidate.xScenario ), pxConfig, &ulState );
+            }
+
+            ( pxResult->ulScenariosRun )++;
+
+            if( prvRunScenario( &xCandidate, pxConfig->xRunTicks ) != pdFAIL )
+            {
+                /* Like new coverage in a fuzzer, a new maximum on either
+                 * measure makes the scenario worth mutating further. */
+                if( ( xFound == pdFALSE ) ||
+                    ( xCandidate.ulReadyCycles > xWorst.ulReadyCycles ) ||
+                    ( xCandidate.ulCriticalCycles > ulWorstCritical ) )
+                {
+                    prvAddToCorpus( &xCandidate );
+                    ( pxResult->ulScenariosKept )++;
+
+                    if( ( xFound == pdFALSE ) || ( xCandidate.ulReadyCycles > xWorst.ulReadyCycles ) )
+                    {
+                        xWorst = xCandidate;
+                    }
+
+                    if( xCandidate.ulCriticalCycles > ulWorstCritical )
+                    {
+                        ulWorstCritical = xCandidate.ulCriticalCycles;
+                    }
+
+                    xFound = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        if( xFound != pdFALSE )
+        {
+            pxResult->ulWorstReadyCycles = xWorst.ulReadyCycles;
+            ulThreshold = ( uint32_t ) ( ( ( uint64_t ) xWorst.ulReadyCycles * latencysearchMINIMISE_PERCENT ) / 100ULL );
+
+            /* Remove what the worst case does not need, one step at a time,
+             * keeping each step that still reproduces it. */
+            for( uxStep = ( UBaseType_t ) 0U; uxStep < ( UBaseType_t ) latencysearchSIMPLIFY_STEPS; uxStep++ )
+            {
+                xCandidate.xScenario = xWorst.xScenario;
+
+                if( prvSimplify( &( xCandidate.xScenario ), uxStep ) != pdFALSE )
+                {
+                    ( pxResult->ulScenariosRun )++;
+
+                    if( ( prvRunScenario( &xCandidate, pxConfig->xRunTicks ) != pdFAIL ) &&
+                        ( xCandidate.ulReadyCycles >= ulThreshold ) )
+                    {
+                        xWorst = xCandidate;
+                    }
+                }
+            }
+
+            pxResult->xScenario = xWorst.xScenario;
+            pxResult->ulReadyCycles = xWorst.ulReadyCycles;
+            pxResult->ulCriticalCycles = xWorst.ulCriticalCycles;
+        }
+
+        return ( xFound != pdFALSE ) ? pdPASS : pdFAIL;
+    }
+/*-----------------------------------------------------------*/
+
+    void vLatencySearchPrintReproducer( const LatencySearchResult_t * pxResult,
+                                        void ( * pxWriteLine )( const char * pcLine ) )
+    {
+        const LatencySoakConfig_t * const pxScenario = &( pxResult->xScenario );
+        char cLine[ latencysearchLINE_LENGTH ];
+        char cLoads[ latencysearchLINE_LENGTH - 32U ];
+        size_t xLength;
+        UBaseType_t uxLoad;
+
+        configASSERT( pxResult );
+        configASSERT( pxWriteLine );
+
+        ( void ) snprintf( cLine, sizeof( cLine ), "/* Worst wake-up latency %lu cycles, worst critical section %lu cycles. */",
+                           ( unsigned long ) pxResult->ulReadyCycles,
+                           ( unsigned long ) pxResult->ulCriticalCycles );
+        pxWriteLine( cLine );
+        pxWriteLine( "LatencySoakConfig_t xConfig =" );
+        pxWriteLine( "{" );
+        ( void ) snprintf( cLine, sizeof( cLine ), "    .uxMeasurementTasks       = %u,", ( unsigned int ) pxScenario->uxMeasurementTasks );
+        pxWriteLine( cLine );
+        ( void ) snprintf( cLine, sizeof( cLine ), "    .uxHighestPriority        = %u,", ( unsigned int ) pxScenario->uxHighestPriority );
+        pxWriteLine( cLine );
+        ( void ) snprintf( cLine, sizeof( cLine ), "    .xPeriod                  = %u,", ( unsigned int ) pxScenario->xPeriod );
+        pxWriteLine( cLine );
+        ( void ) snprintf( cLine, sizeof( cLine ), "    .xPeriodStep              = %u,", ( unsigned int ) pxScenario->xPeriodStep );
+        pxWriteLine( cLine );
+        ( void ) snprintf( cLine, sizeof( cLine ), "    .ulBinWidthCycles         = %lu,", ( unsigned long ) pxScenario->ulBinWidthCycles );
+        pxWriteLine( cLine );
+
+        /* The loads are written by name, so the reproducer reads as it would
+         * be written by hand. */
+        ( void ) strcpy( cLoads, "0" );
+        xLength = ( size_t ) 0U;
+
+        for( uxLoad = ( UBaseType_t ) 0U; uxLoad < ( UBaseType_t ) latencysearchLOAD_COUNT; uxLoad++ )
+        {
+            if( ( ( pxScenario->ulLoads & ( ( uint32_t ) 1UL << uxLoad ) ) != 0UL ) && ( xLength < sizeof( cLoads ) ) )
+            {
+                xLength += ( size_t ) snprintf( &( cLoads[ xLength ] ), sizeof( cLoads ) - xLength, "%s%s",
+                                                ( xLength != ( size_t ) 0U ) ? " | " : "",
+                                                pcLoadNames[ uxLoad ] );
+            }
+        }
+
+        ( void ) snprintf( cLine, sizeof( cLine ), "    .ulLoads                  = %s,", cLoads );
+        pxWriteLine( cLine );
+        ( void ) snprintf( cLine, sizeof( cLine ), "    .uxLoadPriority           = %u,", ( unsigned int ) pxScenario->uxLoadPriority );
+        pxWriteLine( cLine );
+
+        if( ( pxScenario->ulLoads & latencysoakLOAD_TIMER_BURST ) != 0UL )
+        {
+            ( void ) snprintf( cLine, sizeof( cLine ), "    .uxBurstTimers            = %u,", ( unsigned int ) pxScenario->uxBurstTimers );
+            pxWriteLine( cLine );
+            ( void ) snprintf( cLine, sizeof( cLine ), "    .xBurstPeriod             = %u,", ( unsigned int ) pxScenario->xBurstPeriod );
+            pxWriteLine( cLine );
+        }
+
+        if( ( pxScenario->ulLoads & latencysoakLOAD_ISR_FLOOD ) != 0UL )
+        {
+            pxWriteLine( "    .pxTriggerInterrupt       = pxTriggerInterrupt, /* The application's trigger. */" );
+            ( void ) snprintf( cLine, sizeof( cLine ), "    .ulInterruptSpacingCycles = %lu,", ( unsigned long ) pxScenario->ulInterruptSpacingCycles );
+            pxWriteLine( cLine );
+        }
+
+        if( ( pxScenario->ulLoads & latencysoakLOAD_EVENT_GROUP ) != 0UL )
+        {
+            ( void ) snprintf( cLine, sizeof( cLine ), "    .uxEventWaiters           = %u,", ( unsigned int ) pxScenario->uxEventWaiters );
+            pxWriteLine( cLine );
+        }
+
+        pxWriteLine( "};" );
+    }
+/*-----------------------------------------------------------*/
+
+    static uint32_t prvRandom( uint32_t * pulState )
+    {
+        /* A linear congruential generator, with the weak low bits dropped. */
+        *pulState = ( *pulState * 1664525UL ) + 1013904223UL;
+
+        return *pulState >> 8;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvRunScenario( LatencySearchEntry_t * pxEntry,
+                                      TickType_t xRunTicks )
+    {
+        /* Static to keep the histogram off the calling task's stack. */
+        PRIVILEGED_DATA static LatencySoakResult_t xSoakResult;
+        UBaseType_t uxTask;
+        BaseType_t xReturn;
+
+        #if ( configGENERATE_PORT_PROFILE == 1 )
+            PortProfile_t xProfile;
+        #endif
+
+        pxEntry->ulReadyCycles = 0UL;
+        pxEntry->ulCriticalCycles = 0UL;
+
+        #if ( configGENERATE_PORT_PROFILE == 1 )
+        {
+            vPortResetProfile();
+        }
+        #endif
+
+        xReturn = xLatencySoakStart( &( pxEntry->xScenario ) );
+
+        if( xReturn != pdFAIL )
+        {
+            vTaskDelay( xRunTicks );
+
+            /* Read the profile before stopping, so that tearing the soak down
+             * is not counted. */
+            #if ( configGENERATE_PORT_PROFILE == 1 )
+            {
+                vPortGetProfile( &xProfile );
+                pxEntry->ulCriticalCycles = xProfile.xCriticalSection.ulMaxCycles;
+            }
+            #endif
+
+            vLatencySoakStop();
+
+            for( uxTask = ( UBaseType_t ) 0U; xLatencySoakGetResult( uxTask, &xSoakResult ) != pdFAIL; uxTask++ )
+            {
+                if( xSoakResult.ulMaxCycles > pxEntry->ulReadyCycles )
+                {
+                    pxEntry->ulReadyCycles = xSoakResult.ulMaxCycles;
+                }
+            }
+        }
+
+        /* Let the soak tasks delete themselves, and the idle task free them,
+         * before the next scenario needs the heap. */
+        do
+        {
+            vTaskDelay( ( TickType_t ) 1U );
+        } while( xLatencySoakIsRunning() != pdFALSE );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvMutate( LatencySoakConfig_t * pxScenario,
+                           const LatencySearchConfig_t * pxConfig,
+                           uint32_t * pulState )
+    {
+        uint32_t ulMutations = ( prvRandom( pulState ) % latencysearchMAX_MUTATIONS ) + 1UL;
+
+        while( ulMutations > 0UL )
+        {
+            switch( prvRandom( pulState ) % latencysearchMUTATION_KINDS )
+            {
+                case 0UL:
+                    pxScenario->ulLoads ^= ( ( uint32_t ) 1UL << ( prvRandom( pulState ) % latencysearchLOAD_COUNT ) ) & pxConfig->ulAllowedLoads;
+                    break;
+
+                case 1UL:
+                    pxScenario->xPeriod = ( TickType_t ) ( prvRandom( pulState ) % ( uint32_t ) pxConfig->xMaxPeriod ) + ( TickType_t ) 1U;
+                    break;
+
+                case 2UL:
+                    pxScenario->xPeriodStep = ( TickType_t ) ( prvRandom( pulState ) % ( uint32_t ) pxConfig->xMaxPeriod );
+                    break;
+
+                case 3UL:
+                    pxScenario->uxBurstTimers = ( UBaseType_t ) ( prvRandom( pulState ) % ( uint32_t ) pxConfig->uxMaxBurstTimers ) + ( UBaseType_t ) 1U;
+                    break;
+
+                case 4UL:
+                    pxScenario->xBurstPeriod = ( TickType_t ) ( prvRandom( pulState ) % ( uint32_t ) pxConfig->xMaxPeriod ) + ( TickType_t ) 1U;
+                    break;
+
+                case 5UL:
+
+                    /* Moves the interrupts relative to the tick. */
+                    if( pxConfig->ulMaxInterruptSpacingCycles != 0UL )
+                    {
+                        pxScenario->ulInterruptSpacingCycles = prvRandom( pulState ) % pxConfig->ulMaxInterruptSpacingCycles;
+                    }
+
+                    break;
+
+                default:
+                    pxScenario->uxEventWaiters = ( UBaseType_t ) ( prvRandom( pulState ) % ( uint32_t ) pxConfig->uxMaxEventWaiters ) + ( UBaseType_t ) 1U;
+                    break;
+            }
+
+            ulMutations--;
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvSimplify( LatencySoakConfig_t * pxScenario,
+                                   UBaseType_t uxStep )
+    {
+        BaseType_t xChanged = pdFALSE;
+
+        if( uxStep < ( UBaseType_t ) latencysearchLOAD_COUNT )
+        {
+            if( ( pxScenario->ulLoads & ( ( uint32_t ) 1UL << uxStep ) ) != 0UL )
+            {
+                pxScenario->ulLoads &= ~( ( uint32_t ) 1UL << uxStep );
+                xChanged = pdTRUE;
+            }
+        }
+        else if( uxStep == ( UBaseType_t ) latencysearchSIMPLIFY_PERIOD_STEP )
+        {
+            if( ( pxScenario->uxMeasurementTasks > ( UBaseType_t ) 1U ) && ( pxScenario->xPeriodStep != ( TickType_t ) 0U ) )
+            {
+                pxScenario->xPeriodStep = ( TickType_t ) 0U;
+                xChanged = pdTRUE;
+            }
+        }
+        else if( uxStep == ( UBaseType_t ) latencysearchSIMPLIFY_SPACING )
+        {
+            if( ( ( pxScenario->ulLoads & latencysoakLOAD_ISR_FLOOD ) != 0UL ) && ( pxScenario->ulInterruptSpacingCycles != 0UL ) )
+            {
+                pxScenario->ulInterruptSpacingCycles = 0UL;
+                xChanged = pdTRUE;
+            }
+        }
+        else if( uxStep == ( UBaseType_t ) latencysearchSIMPLIFY_TIMERS )
+        {
+            if( ( ( pxScenario->ulLoads & latencysoakLOAD_TIMER_BURST ) != 0UL ) && ( pxScenario->uxBurstTimers > ( UBaseType_t ) 1U ) )
+            {
+                pxScenario->uxBurstTimers /= ( UBaseType_t ) 2U;
+                xChanged = pdTRUE;
+            }
+        }
+        else
+        {
+            if( ( ( pxScenario->ulLoads & latencysoakLOAD_EVENT_GROUP ) != 0UL ) && ( pxScenario->uxEventWaiters > ( UBaseType_t ) 1U ) )
+            {
+                pxScenario->uxEventWaiters /= ( UBaseType_t ) 2U;
+                xChanged = pdTRUE;
+            }
+        }
+
+        return xChanged;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvAddToCorpus( const LatencySearchEntry_t * pxEntry )
+    {
+        UBaseType_t uxEntry;
+        UBaseType_t uxLowest = ( UBaseType_t ) 0U;
+
+        if( uxCorpusCount < ( UBaseType_t ) configLATENCY_SEARCH_CORPUS_SIZE )
+        {
+            xCorpus[ uxCorpusCount ] = *pxEntry;
+            uxCorpusCount++;
+        }
+        else
+        {
+            for( uxEntry = ( UBaseType_t ) 1U; uxEntry < uxCorpusCount; uxEntry++ )
+            {
+                if( xCorpus[ uxEntry ].ulReadyCycles < xCorpus[ uxLowest ].ulReadyCycles )
+                {
+                    uxLowest = uxEntry;
+                }
+            }
+
+            xCorpus[ uxLowest ] = *pxEntry;
+        }
+    }
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+ * to include the latency search.  If you want to include the latency search
+ * then ensure configUSE_LATENCY_SEARCH is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_LATENCY_SEARCH == 1 */
@@ -0,0 +1,195 @@
+/*
+ * FreeRTOS Kernel V10.5.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+#ifndef LATENCY_SEARCH_H
+#define LATENCY_SEARCH_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h" must appear in source files before "include latency_search.h"
+#endif
+
+#include "latency_soak.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * The latency search looks for the combination of background load that gives
+ * the worst wake-up latency, in the style of a coverage guided fuzzer.  The
+ * worst cases come from rare overlaps - a heap allocation holding the
+ * scheduler suspended while a tick expires many timers, or while an event
+ * group broadcast walks its waiters - that a fixed soak may take hours to hit.
+ *
+ * Each scenario is a LatencySoakConfig_t run for a fixed number of ticks.  The
+ * search keeps a corpus of scenarios, and repeatedly picks one, mutates its
+ * loads, periods, timer and waiter counts and interrupt spacing with a seeded
+ * pseudo random generator, and runs the result.  A scenario that raises the
+ * worst wake-up latency seen so far, or the worst kernel critical section
+ * when configGENERATE_PORT_PROFILE is 1, is added to the corpus.  Once the
+ * iterations are used up the worst scenario is minimised, by removing each
+ * load and shrinking each count in turn while it still reproduces most of the
+ * latency, and can be printed as a reproducer that xLatencySoakStart() runs
+ * again.
+ *
+ * The search runs on the target, in the task that calls xLatencySearchRun(),
+ * so the results include the real interrupt and memory timing.  A seed that
+ * found a worst case finds the same scenarios again, although the latencies
+ * measured for them vary from run to run.
+ *
+ * configUSE_LATENCY_SEARCH must be set to 1 in FreeRTOSConfig.h for the search
+ * to be available.  It requires configUSE_LATENCY_SOAK.
+ */
+
+/**
+ * latency_search.h
+ *
+ * The parameters of a search, passed to xLatencySearchRun().
+ *
+ * \defgroup LatencySearchConfig_t LatencySearchConfig_t
+ * \ingroup LatencySearch
+ */
+typedef struct xLATENCY_SEARCH_CONFIG
+{
+    LatencySoakConfig_t xBase;            /*< The first scenario.  Its measurement tasks, priorities, bin width and interrupt hook are never mutated. */
+    uint32_t ulAllowedLoads;              /*< The latencysoakLOAD_ values the search may switch on. */
+    TickType_t xMaxPeriod;                /*< The longest measurement and timer burst period tried. */
+    UBaseType_t uxMaxBurstTimers;         /*< The most timers tried in a timer burst. */
+    UBaseType_t uxMaxEventWaiters;        /*< The most tasks tried waiting on an event group broadcast. */
+    uint32_t ulMaxInterruptSpacingCycles; /*< The longest interrupt spacing tried. */
+    TickType_t xRunTicks;                 /*< How long each scenario runs. */
+    uint32_t ulIterations;                /*< The number of mutated scenarios to run. */
+    uint32_t ulSeed;                      /*< Seeds the pseudo random generator. */
+} LatencySearchConfig_t;
+
+/**
+ * latency_search.h
+ *
+ * The outcome of a search.  All times are in cycles.
+ *
+ * \defgroup LatencySearchResult_t LatencySearchResult_t
+ * \ingroup LatencySearch
+ */
+typedef struct xLATENCY_SEARCH_RESULT
+{
+    LatencySoakConfig_t xScenario; /*< The minimised worst scenario. */
+    uint32_t ulReadyCycles;        /*< The worst wake-up latency xScenario produced. */
+    uint32_t ulCriticalCycles;     /*< The worst critical section xScenario produced, 0 without the port profile. */
+    uint32_t ulWorstReadyCycles;   /*< The worst wake-up latency seen by any scenario. */
+    uint32_t ulScenariosRun;       /*< The number of scenarios run, including the minimisation. */
+    uint32_t ulScenariosKept;      /*< The number of scenarios added to the corpus. */
+} LatencySearchResult_t;
+
+/**
+ * latency_search.h
+ * @code{c}
+ * BaseType_t xLatencySearchRun( const LatencySearchConfig_t * pxConfig, LatencySearchResult_t * pxResult );
+ * @endcode
+ *
+ * Run the search to completion, which takes about
+ * ( ulIterations + the minimisation steps ) * xRunTicks.  Must be called from a
+ * task that runs above pxConfig->xBase.uxLoadPriority, and no soak may be
+ * running.
+ *
+ * Example usage:
+ * @code{c}
+ * static void prvWriteLine( const char * pcLine )
+ * {
+ *     printf( "%s\n", pcLine );
+ * }
+ *
+ * void vSearch( void )
+ * {
+ *     static LatencySearchResult_t xResult;
+ *     LatencySearchConfig_t xConfig =
+ *     {
+ *         .xBase =
+ *         {
+ *             .uxMeasurementTasks = 2,
+ *             .uxHighestPriority  = configMAX_PRIORITIES - 1,
+ *             .xPeriod            = 1,
+ *             .ulBinWidthCycles   = 100,
+ *             .uxLoadPriority     = 1,
+ *         },
+ *         .ulAllowedLoads    = latencysoakLOAD_HEAP_CHURN | latencysoakLOAD_TIMER_BURST | latencysoakLOAD_EVENT_GROUP,
+ *         .xMaxPeriod        = 10,
+ *         .uxMaxBurstTimers  = 16,
+ *         .uxMaxEventWaiters = 8,
+ *         .xRunTicks         = pdMS_TO_TICKS( 2000 ),
+ *         .ulIterations      = 500,
+ *         .ulSeed            = 1,
+ *     };
+ *
+ *     if( xLatencySearchRun( &xConfig, &xResult ) == pdPASS )
+ *     {
+ *         vLatencySearchPrintReproducer( &xResult, prvWriteLine );
+ *     }
+ * }
+ * @endcode
+ *
+ * @param pxConfig The parameters of the search.
+ *
+ * @param pxResult Where to write the outcome.
+ *
+ * @return pdPASS if at least one scenario ran, otherwise pdFAIL.
+ *
+ * \defgroup xLatencySearchRun xLatencySearchRun
+ * \ingroup LatencySearch
+ */
+BaseType_t xLatencySearchRun( const LatencySearchConfig_t * pxConfig,
+                              LatencySearchResult_t * pxResult ) PRIVILEGED_FUNCTION;
+
+/**
+ * latency_search.h
+ * @code{c}
+ * void vLatencySearchPrintReproducer( const LatencySearchResult_t * pxResult, void ( * pxWriteLine )( const char * pcLine ) );
+ * @endcode
+ *
+ * Format the minimised worst scenario as a LatencySoakConfig_t initialiser,
+ * one line at a time, preceded by a comment with the latencies it produced.
+ * The lines have no line ending.
+ *
+ * @param pxResult The outcome of xLatencySearchRun().
+ *
+ * @param pxWriteLine Called with each line.
+ *
+ * \defgroup vLatencySearchPrintReproducer vLatencySearchPrintReproducer
+ * \ingroup LatencySearch
+ */
+void vLatencySearchPrintReproducer( const LatencySearchResult_t * pxResult,
+                                    void ( * pxWriteLine )( const char * pcLine ) ) PRIVILEGED_FUNCTION;
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* LATENCY_SEARCH_H */
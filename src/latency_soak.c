@@ -0,0 +1,739 @@
+/*
+ * FreeRTOS Kernel V10.5.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Standard includes. */
+#include <stdio.h>
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers.  That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "timers.h"
+#include "event_groups.h"
+#include "latency_soak.h"
+
+/* Lint e961, e750 and e9021 are suppressed as a MISRA exception justified
+ * because the MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750 !e9021 See comment above. */
+
+/* This entire source file will be skipped if the application is not configured
+ * to include the latency soak.  This #if is closed at the very bottom of this
+ * file. */
+#if ( configUSE_LATENCY_SOAK == 1 )
+
+/* The number of tick boundaries a measurement task observes to calibrate the
+ * cycle count of a tick boundary.  The earliest observation is kept. */
+    #define latencysoakCALIBRATION_TICKS       ( 8U )
+
+/* The bit the event group broadcasts set. */
+    #define latencysoakEVENT_BIT               ( ( EventBits_t ) 0x01U )
+
+/* The length of the queue used by the queue storm. */
+    #define latencysoakQUEUE_LENGTH            ( 8U )
+
+/* The number of blocks the heap churn task holds at most, and the largest
+ * block it allocates. */
+    #define latencysoakHEAP_CHURN_BLOCKS       ( 16U )
+    #define latencysoakHEAP_CHURN_MAX_BYTES    ( 512U )
+
+/* The most characters in one line written by vLatencySoakPrintResults(). */
+    #define latencysoakLINE_LENGTH             ( 96U )
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The measurement task, and the tasks and timer callback that generate the
+ * background load.
+ */
+    static void prvMeasurementTask( void * pvParameters ) PRIVILEGED_FUNCTION;
+    static void prvQueueStormSendTask( void * pvParameters ) PRIVILEGED_FUNCTION;
+    static void prvQueueStormReceiveTask( void * pvParameters ) PRIVILEGED_FUNCTION;
+    static void prvHeapChurnTask( void * pvParameters ) PRIVILEGED_FUNCTION;
+    static void prvInterruptFloodTask( void * pvParameters ) PRIVILEGED_FUNCTION;
+    static void prvEventSetTask( void * pvParameters ) PRIVILEGED_FUNCTION;
+    static void prvEventWaitTask( void * pvParameters ) PRIVILEGED_FUNCTION;
+
+    #if ( configUSE_TIMERS == 1 )
+        static void prvBurstTimerCallback( TimerHandle_t xTimer ) PRIVILEGED_FUNCTION;
+    #endif
+
+/*
+ * Create one of the soak tasks, counting it in uxRunningTasks.
+ */
+    static BaseType_t prvCreateTask( TaskFunction_t pxTaskCode,
+                                     const char * const pcName,
+                                     void * pvParameters,
+                                     UBaseType_t uxPriority,
+                                     TaskHandle_t * pxCreatedTask ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called by each soak task once a stop has been requested.  Deletes the
+ * calling task, and the storm queue and event group once no task can be using
+ * them.
+ */
+    static void prvExitTask( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * Deletes the storm queue and event group if no soak task remains to use them
+ * and they have not already been deleted.
+ */
+    static void prvDeleteSharedObjects( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the cycle count of the boundary of tick *pxBaseTick.
+ */
+    static uint32_t prvCalibrateTickCycles( TickType_t * pxBaseTick ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+    PRIVILEGED_DATA static LatencySoakConfig_t xSoakConfig;
+    PRIVILEGED_DATA static LatencySoakResult_t xResults[ configLATENCY_SOAK_MAX_TASKS ];
+    PRIVILEGED_DATA static UBaseType_t uxResultCount = ( UBaseType_t ) 0U;
+    PRIVILEGED_DATA static uint32_t ulCyclesPerTick = 0UL;
+
+    PRIVILEGED_DATA static volatile BaseType_t xStopRequested = pdFALSE;
+    PRIVILEGED_DATA static volatile UBaseType_t uxRunningTasks = ( UBaseType_t ) 0U;
+
+    PRIVILEGED_DATA static QueueHandle_t xStormQueue = NULL;
+    PRIVILEGED_DATA static TaskHandle_t xFloodTask = NULL;
+    PRIVILEGED_DATA static EventGroupHandle_t xEventGroup = NULL;
+
+    #if ( configUSE_TIMERS == 1 )
+        PRIVILEGED_DATA static TimerHandle_t * pxBurstTimers = NULL;
+        PRIVILEGED_DATA static volatile uint32_t ulBurstTimerCallbacks = 0UL;
+    #endif
+
+/*-----------------------------------------------------------*/
+
+    BaseType_t xLatencySoakStart( const LatencySoakConfig_t * pxConfig )
+    {
+        BaseType_t xReturn = pdPASS;
+        UBaseType_t uxTask;
+
+        configASSERT( pxConfig );
+
+        if( ( uxRunningTasks != ( UBaseType_t ) 0U ) ||
+            ( pxConfig->uxMeasurementTasks == ( UBaseType_t ) 0U ) ||
+            ( pxConfig->uxMeasurementTasks > ( UBaseType_t ) configLATENCY_SOAK_MAX_TASKS ) ||
+            ( pxConfig->uxHighestPriority >= ( UBaseType_t ) configMAX_PRIORITIES ) ||
+            ( pxConfig->uxHighestPriority < pxConfig->uxMeasurementTasks ) ||
+            ( ( pxConfig->uxHighestPriority - pxConfig->uxMeasurementTasks ) < pxConfig->uxLoadPriority ) ||
+            ( pxConfig->xPeriod == ( TickType_t ) 0U ) ||
+            ( pxConfig->ulBinWidthCycles == 0UL ) ||
+            ( ( ( pxConfig->ulLoads & latencysoakLOAD_EVENT_GROUP ) != 0UL ) && ( pxConfig->uxEventWaiters == ( UBaseType_t ) 0U ) ) )
+        {
+            xReturn = pdFAIL;
+        }
+        else if( ( ( pxConfig->ulLoads & latencysoakLOAD_ISR_FLOOD ) != 0UL ) && ( pxConfig->pxTriggerInterrupt == NULL ) )
+        {
+            xReturn = pdFAIL;
+        }
+        else if( ( pxConfig->ulLoads & latencysoakLOAD_TIMER_BURST ) != 0UL )
+        {
+            #if ( configUSE_TIMERS == 1 )
+                if( ( pxConfig->uxBurstTimers == ( UBaseType_t ) 0U ) || ( pxConfig->xBurstPeriod == ( TickType_t ) 0U ) )
+                {
+                    xReturn = pdFAIL;
+                }
+            #else
+                xReturn = pdFAIL;
+            #endif
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( xReturn == pdPASS )
+        {
+            xSoakConfig = *pxConfig;
+            xStopRequested = pdFALSE;
+            ulCyclesPerTick = ( uint32_t ) ( configCPU_CLOCK_HZ / configTICK_RATE_HZ );
+
+            /* Clear the results before any measurement task can run. */
+            vTaskSuspendAll();
+            {
+                for( uxTask = ( UBaseType_t ) 0U; uxTask < pxConfig->uxMeasurementTasks; uxTask++ )
+                {
+                    ( void ) memset( &( xResults[ uxTask ] ), 0x00, sizeof( LatencySoakResult_t ) );
+                    xResults[ uxTask ].uxPriority = pxConfig->uxHighestPriority - uxTask;
+                    xResults[ uxTask ].xPeriod = pxConfig->xPeriod + ( ( TickType_t ) uxTask * pxConfig->xPeriodStep );
+                    xResults[ uxTask ].ulMinCycles = UINT32_MAX;
+                }
+
+                uxResultCount = pxConfig->uxMeasurementTasks;
+            }
+            ( void ) xTaskResumeAll();
+
+            for( uxTask = ( UBaseType_t ) 0U; ( uxTask < pxConfig->uxMeasurementTasks ) && ( xReturn == pdPASS ); uxTask++ )
+            {
+                xReturn = prvCreateTask( prvMeasurementTask, "SoakM", ( void * ) ( portPOINTER_SIZE_TYPE ) uxTask, xResults[ uxTask ].uxPriority, NULL );
+            }
+
+            if( ( xReturn == pdPASS ) && ( ( pxConfig->ulLoads & latencysoakLOAD_QUEUE_STORM ) != 0UL ) )
+            {
+                xStormQueue = xQueueCreate( latencysoakQUEUE_LENGTH, sizeof( uint32_t ) );
+
+                if( xStormQueue != NULL )
+                {
+                    xReturn = prvCreateTask( prvQueueStormSendTask, "SoakQS", NULL, pxConfig->uxLoadPriority, NULL );
+
+                    if( xReturn == pdPASS )
+                    {
+                        xReturn = prvCreateTask( prvQueueStormReceiveTask, "SoakQR", NULL, pxConfig->uxLoadPriority, NULL );
+                    }
+                }
+                else
+                {
+                    xReturn = pdFAIL;
+                }
+            }
+
+            if( ( xReturn == pdPASS ) && ( ( pxConfig->ulLoads & latencysoakLOAD_HEAP_CHURN ) != 0UL ) )
+            {
+                xReturn = prvCreateTask( prvHeapChurnTask, "SoakH", NULL, pxConfig->uxLoadPriority, NULL );
+            }
+
+            if( ( xReturn == pdPASS ) && ( ( pxConfig->ulLoads & latencysoakLOAD_ISR_FLOOD ) != 0UL ) )
+            {
+                xReturn = prvCreateTask( prvInterruptFloodTask, "SoakI", NULL, pxConfig->uxLoadPriority, &xFloodTask );
+            }
+
+            if( ( xReturn == pdPASS ) && ( ( pxConfig->ulLoads & latencysoakLOAD_EVENT_GROUP ) != 0UL ) )
+            {
+                xEventGroup = xEventGroupCreate();
+
+                if( xEventGroup != NULL )
+                {
+                    for( uxTask = ( UBaseType_t ) 0U; ( uxTask < pxConfig->uxEventWaiters ) && ( xReturn == pdPASS ); uxTask++ )
+                    {
+                        xReturn = prvCreateTask( prvEventWaitTask, "SoakEW", NULL, pxConfig->uxLoadPriority, NULL );
+                    }
+
+                    if( xReturn == pdPASS )
+                    {
+                        xReturn = prvCreateTask( prvEventSetTask, "SoakES", NULL, pxConfig->uxLoadPriority, NULL );
+                    }
+                }
+                else
+                {
+                    xReturn = pdFAIL;
+                }
+            }
+
+            #if ( configUSE_TIMERS == 1 )
+            {
+                if( ( xReturn == pdPASS ) && ( ( pxConfig->ulLoads & latencysoakLOAD_TIMER_BURST ) != 0UL ) )
+                {
+                    pxBurstTimers = ( TimerHandle_t * ) pvPortMalloc( ( size_t ) pxConfig->uxBurstTimers * sizeof( TimerHandle_t ) );
+
+                    if( pxBurstTimers != NULL )
+                    {
+                        ( void ) memset( pxBurstTimers, 0x00, ( size_t ) pxConfig->uxBurstTimers * sizeof( TimerHandle_t ) );
+
+                        for( uxTask = ( UBaseType_t ) 0U; ( uxTask < pxConfig->uxBurstTimers ) && ( xReturn == pdPASS ); uxTask++ )
+                        {
+                            pxBurstTimers[ uxTask ] = xTimerCreate( "SoakT", pxConfig->xBurstPeriod, pdTRUE, NULL, prvBurstTimerCallback );
+
+                            if( pxBurstTimers[ uxTask ] == NULL )
+                            {
+                                xReturn = pdFAIL;
+                            }
+                        }
+
+                        /* The timers are started in a tight loop, so they
+                         * normally all expire on the same tick. */
+                        for( uxTask = ( UBaseType_t ) 0U; ( uxTask < pxConfig->uxBurstTimers ) && ( xReturn == pdPASS ); uxTask++ )
+                        {
+                            ( void ) xTimerStart( pxBurstTimers[ uxTask ], portMAX_DELAY );
+                        }
+                    }
+                    else
+                    {
+                        xReturn = pdFAIL;
+                    }
+                }
+            }
+            #endif /* configUSE_TIMERS */
+
+            if( xReturn != pdPASS )
+            {
+                /* Stop whatever was created.  If no task was created, or
+                 * they have all exited already, no task will delete the
+                 * shared objects on its way out. */
+                vLatencySoakStop();
+                prvDeleteSharedObjects();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    void vLatencySoakStop( void )
+    {
+        xStopRequested = pdTRUE;
+
+        #if ( configUSE_TIMERS == 1 )
+        {
+            UBaseType_t uxTimer;
+            TimerHandle_t * pxTimersToDelete;
+
+            /* Taken under a critical section so the timers are only deleted
+             * once if the soak is stopped from more than one place. */
+            taskENTER_CRITICAL();
+            {
+                pxTimersToDelete = pxBurstTimers;
+                pxBurstTimers = NULL;
+            }
+            taskEXIT_CRITICAL();
+
+            if( pxTimersToDelete != NULL )
+            {
+                for( uxTimer = ( UBaseType_t ) 0U; uxTimer < xSoakConfig.uxBurstTimers; uxTimer++ )
+                {
+                    if( pxTimersToDelete[ uxTimer ] != NULL )
+                    {
+                        ( void ) xTimerDelete( pxTimersToDelete[ uxTimer ], portMAX_DELAY );
+                    }
+                }
+
+                vPortFree( pxTimersToDelete );
+            }
+        }
+        #endif /* configUSE_TIMERS */
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xLatencySoakIsRunning( void )
+    {
+        return ( uxRunningTasks != ( UBaseType_t ) 0U ) ? pdTRUE : pdFALSE;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xLatencySoakGetResult( UBaseType_t uxTask,
+                                      LatencySoakResult_t * pxResult )
+    {
+        BaseType_t xReturn = pdFAIL;
+
+        configASSERT( pxResult );
+
+        /* Measurement tasks cannot run while the scheduler is suspended, and
+         * they update their results in a critical section, so the copy is
+         * consistent without masking interrupts for the whole copy. */
+        vTaskSuspendAll();
+        {
+            if( uxTask < uxResultCount )
+            {
+                *pxResult = xResults[ uxTask ];
+                xReturn = pdPASS;
+            }
+        }
+        ( void ) xTaskResumeAll();
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    void vLatencySoakPrintResults( void ( * pxWriteLine )( const char * pcLine ) )
+    {
+        static LatencySoakResult_t xResult;
+        char cLine[ latencysoakLINE_LENGTH ];
+        UBaseType_t uxTask;
+        UBaseType_t uxBin;
+
+        configASSERT( pxWriteLine );
+
+        for( uxTask = ( UBaseType_t ) 0U; xLatencySoakGetResult( uxTask, &xResult ) != pdFAIL; uxTask++ )
+        {
+            ( void ) snprintf( cLine, sizeof( cLine ), "task %u prio %u period %u: samples %lu min %lu avg %lu max %lu overflows %lu",
+                               ( unsigned int ) uxTask,
+                               ( unsigned int ) xResult.uxPriority,
+                               ( unsigned int ) xResult.xPeriod,
+                               ( unsigned long ) xResult.ulSamples,
+                               ( unsigned long ) ( ( xResult.ulSamples != 0UL ) ? xResult.ulMinCycles : 0UL ),
+                               ( unsigned long ) ( ( xResult.ulSamples != 0UL ) ? ( xResult.ullTotalCycles / xResult.ulSamples ) : 0ULL ),
+                               ( unsigned long ) xResult.ulMaxCycles,
+                               ( unsigned long ) xResult.ulOverflows );
+            pxWriteLine( cLine );
+
+            for( uxBin = ( UBaseType_t ) 0U; uxBin < ( UBaseType_t ) configLATENCY_SOAK_HISTOGRAM_BINS; uxBin++ )
+            {
+                if( xResult.ulHistogram[ uxBin ] != 0UL )
+                {
+                    ( void ) snprintf( cLine, sizeof( cLine ), "task %u bin %lu %lu",
+                                       ( unsigned int ) uxTask,
+                                       ( unsigned long ) ( ( uint32_t ) uxBin * xSoakConfig.ulBinWidthCycles ),
+                                       ( unsigned long ) xResult.ulHistogram[ uxBin ] );
+                    pxWriteLine( cLine );
+                }
+            }
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    void vLatencySoakInterruptHandler( void )
+    {
+        BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+        if( xFloodTask != NULL )
+        {
+            vTaskNotifyGiveFromISR( xFloodTask, &xHigherPriorityTaskWoken );
+        }
+
+        portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+    }
+/*-----------------------------------------------------------*/
+
+    static uint32_t prvCalibrateTickCycles( TickType_t * pxBaseTick )
+    {
+        TickType_t xTick;
+        TickType_t xNow;
+        uint32_t ulCycles;
+        uint32_t ulCandidate;
+        uint32_t ulBoundary = 0UL;
+        UBaseType_t uxObservation;
+
+        *pxBaseTick = xTaskGetTickCount();
+
+        for( uxObservation = ( UBaseType_t ) 0U; uxObservation < ( UBaseType_t ) latencysoakCALIBRATION_TICKS; uxObservation++ )
+        {
+            /* Spin until the tick count changes, then read the cycle counter.
+             * The tick count is read first, so if the task is delayed between
+             * the two reads the observation is late, never early. */
+            xTick = xTaskGetTickCount();
+
+            do
+            {
+                xNow = xTaskGetTickCount();
+            } while( xNow == xTick );
+
+            ulCycles = portGET_CYCLE_COUNTER();
+
+            /* Project the observation back to the boundary of the base tick,
+             * and keep the earliest. */
+            ulCandidate = ulCycles - ( ( uint32_t ) ( xNow - *pxBaseTick ) * ulCyclesPerTick );
+
+            if( ( uxObservation == ( UBaseType_t ) 0U ) || ( ( int32_t ) ( ulCandidate - ulBoundary ) < 0 ) )
+            {
+                ulBoundary = ulCandidate;
+            }
+        }
+
+        return ulBoundary;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvMeasurementTask( void * pvParameters )
+    {
+        LatencySoakResult_t * const pxResult = &( xResults[ ( UBaseType_t ) ( portPOINTER_SIZE_TYPE ) pvParameters ] );
+        TickType_t xBaseTick;
+        TickType_t xWakeTime;
+        uint32_t ulBaseCycles;
+        uint32_t ulLatency;
+        UBaseType_t uxBin;
+
+        ulBaseCycles = prvCalibrateTickCycles( &xBaseTick );
+        xWakeTime = xTaskGetTickCount();
+
+        while( xStopRequested == pdFALSE )
+        {
+            ( void ) xTaskDelayUntil( &xWakeTime, pxResult->xPeriod );
+
+            /* The cycles since the boundary of the tick the task was due on.
+             * The arithmetic is modulo 2^32, which is correct as long as the
+             * latency itself fits. */
+            ulLatency = portGET_CYCLE_COUNTER() - ( ulBaseCycles + ( ( uint32_t ) ( xWakeTime - xBaseTick ) * ulCyclesPerTick ) );
+            uxBin = ( UBaseType_t ) ( ulLatency / xSoakConfig.ulBinWidthCycles );
+
+            taskENTER_CRITICAL();
+            {
+                ( pxResult->ulSamples )++;
+                pxResult->ullTotalCycles += ulLatency;
+
+                if( ulLatency < pxResult->ulMinCycles )
+                {
+                    pxResult->ulMinCycles = ulLatency;
+                }
+
+                if( ulLatency > pxResult->ulMaxCycles )
+                {
+                    pxResult->ulMaxCycles = ulLatency;
+                }
+
+                if( uxBin < ( UBaseType_t ) configLATENCY_SOAK_HISTOGRAM_BINS )
+                {
+                    ( pxResult->ulHistogram[ uxBin ] )++;
+                }
+                else
+                {
+                    ( pxResult->ulOverflows )++;
+                }
+            }
+            taskEXIT_CRITICAL();
+        }
+
+        prvExitTask();
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvQueueStormSendTask( void * pvParameters )
+    {
+        uint32_t ulValue = 0UL;
+
+        ( void ) pvParameters;
+
+        while( xStopRequested == pdFALSE )
+        {
+            /* Block for at most a tick, so a stop is seen even if the other
+             * task has already left. */
+            if( xQueueSend( xStormQueue, &ulValue, ( TickType_t ) 1U ) != pdFALSE )
+            {
+                ulValue++;
+            }
+        }
+
+        prvExitTask();
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvQueueStormReceiveTask( void * pvParameters )
+    {
+        uint32_t ulValue;
+
+        ( void ) pvParameters;
+
+        while( xStopRequested == pdFALSE )
+        {
+            ( void ) xQueueReceive( xStormQueue, &ulValue, ( TickType_t ) 1U );
+        }
+
+        prvExitTask();
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvHeapChurnTask( void * pvParameters )
+    {
+        void * pvBlocks[ latencysoakHEAP_CHURN_BLOCKS ] = { NULL };
+        uint32_t ulRandom = 0x12345678UL;
+        UBaseType_t uxBlock;
+        size_t xBytes;
+
+        ( void ) pvParameters;
+
+        while( xStopRequested == pdFALSE )
+        {
+            /* A linear congruential generator is enough to vary the block
+             * sizes and the order they are freed in. */
+            ulRandom = ( ulRandom * 1664525UL ) + 1013904223UL;
+            uxBlock = ( UBaseType_t ) ( ( ulRandom >> 16 ) % latencysoakHEAP_CHURN_BLOCKS );
+
+            if( pvBlocks[ uxBlock ] != NULL )
+            {
+                vPortFree( pvBlocks[ uxBlock ] );
+                pvBlocks[ uxBlock ] = NULL;
+            }
+            else
+            {
+                xBytes = ( size_t ) ( ( ulRandom >> 8 ) % latencysoakHEAP_CHURN_MAX_BYTES ) + ( size_t ) 1U;
+                pvBlocks[ uxBlock ] = pvPortMalloc( xBytes );
+
+                if( pvBlocks[ uxBlock ] != NULL )
+                {
+                    ( void ) memset( pvBlocks[ uxBlock ], 0xa5, xBytes );
+                }
+            }
+        }
+
+        for( uxBlock = ( UBaseType_t ) 0U; uxBlock < ( UBaseType_t ) latencysoakHEAP_CHURN_BLOCKS; uxBlock++ )
+        {
+            vPortFree( pvBlocks[ uxBlock ] );
+        }
+
+        prvExitTask();
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvInterruptFloodTask( void * pvParameters )
+    {
+        ( void ) pvParameters;
+
+        while( xStopRequested == pdFALSE )
+        {
+            /* The handler notifies this task, so clear the notifications as
+             * they arrive to exercise the task side as well. */
+            xSoakConfig.pxTriggerInterrupt();
+            ( void ) ulTaskNotifyTake( pdTRUE, ( TickType_t ) 0U );
+
+            if( xSoakConfig.ulInterruptSpacingCycles != 0UL )
+            {
+                const uint32_t ulStart = portGET_CYCLE_COUNTER();
+
+                while( ( portGET_CYCLE_COUNTER() - ulStart ) < xSoakConfig.ulInterruptSpacingCycles )
+                {
+                }
+            }
+        }
+
+        xFloodTask = NULL;
+        prvExitTask();
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvEventSetTask( void * pvParameters )
+    {
+        ( void ) pvParameters;
+
+        while( xStopRequested == pdFALSE )
+        {
+            /* The waiters clear the bit as they leave, so every set finds them
+             * all blocked again unless they have not yet run. */
+            ( void ) xEventGroupSetBits( xEventGroup, latencysoakEVENT_BIT );
+            taskYIELD();
+        }
+
+        prvExitTask();
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvEventWaitTask( void * pvParameters )
+    {
+        ( void ) pvParameters;
+
+        while( xStopRequested == pdFALSE )
+        {
+            ( void ) xEventGroupWaitBits( xEventGroup, latencysoakEVENT_BIT, pdTRUE, pdTRUE, ( TickType_t ) 1U );
+        }
+
+        prvExitTask();
+    }
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_TIMERS == 1 )
+
+        static void prvBurstTimerCallback( TimerHandle_t xTimer )
+        {
+            ( void ) xTimer;
+            ulBurstTimerCallbacks++;
+        }
+
+    #endif /* configUSE_TIMERS */
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvCreateTask( TaskFunction_t pxTaskCode,
+                                     const char * const pcName,
+                                     void * pvParameters,
+                                     UBaseType_t uxPriority,
+                                     TaskHandle_t * pxCreatedTask )
+    {
+        BaseType_t xReturn;
+
+        /* Count the task first, as it can run and exit before xTaskCreate()
+         * returns. */
+        taskENTER_CRITICAL();
+        {
+            uxRunningTasks++;
+        }
+        taskEXIT_CRITICAL();
+
+        xReturn = xTaskCreate( pxTaskCode, pcName, configLATENCY_SOAK_STACK_DEPTH, pvParameters, uxPriority, pxCreatedTask );
+
+        if( xReturn != pdPASS )
+        {
+            taskENTER_CRITICAL();
+            {
+                uxRunningTasks--;
+            }
+            taskEXIT_CRITICAL();
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvExitTask( void )
+    {
+        taskENTER_CRITICAL();
+        {
+            uxRunningTasks--;
+        }
+        taskEXIT_CRITICAL();
+
+        prvDeleteSharedObjects();
+
+        vTaskDelete( NULL );
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvDeleteSharedObjects( void )
+    {
+        QueueHandle_t xQueueToDelete = NULL;
+        EventGroupHandle_t xEventGroupToDelete = NULL;
+
+        /* Both the last task to exit and a failed xLatencySoakStart() can get
+         * here, so whichever takes the handles first deletes the objects. */
+        taskENTER_CRITICAL();
+        {
+            if( uxRunningTasks == ( UBaseType_t ) 0U )
+            {
+                xQueueToDelete = xStormQueue;
+                xStormQueue = NULL;
+                xEventGroupToDelete = xEventGroup;
+                xEventGroup = NULL;
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        if( xQueueToDelete != NULL )
+        {
+            vQueueDelete( xQueueToDelete );
+        }
+
+        if( xEventGroupToDelete != NULL )
+        {
+            vEventGroupDelete( xEventGroupToDelete );
+        }
+    }
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+ * to include the latency soak.  If you want to include the latency soak then
+ * ensure configUSE_LATENCY_SOAK is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_LATENCY_SOAK == 1 */
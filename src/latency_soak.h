@@ -0,0 +1,263 @@
+/*
+ * FreeRTOS Kernel V10.5.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+#ifndef LATENCY_SOAK_H
+#define LATENCY_SOAK_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h" must appear in source files before "include latency_soak.h"
+#endif
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * The latency soak measures how late periodic tasks wake, in the style of
+ * cyclictest, while synthetic background load runs alongside them.  It is
+ * meant to be left running for hours, so that rare worst cases show up in the
+ * results rather than just the average.
+ *
+ * Each measurement task runs at its own priority and wakes with
+ * xTaskDelayUntil().  On every wake it reads portGET_CYCLE_COUNTER() and
+ * records how many cycles have passed since the tick on which it was due.
+ * The cycle count of a tick boundary is calibrated when the task starts, so
+ * the counter must run at configCPU_CLOCK_HZ, in step with the tick.  Tickless
+ * idle must not be used while the soak runs, as it moves tick boundaries.
+ *
+ * The background load runs below the measurement tasks and is any mix of:
+ *
+ * - A queue storm: two tasks passing items through a short queue as fast as
+ *   they can.
+ * - Heap churn: a task allocating and freeing blocks of pseudo random size.
+ * - Timer bursts: software timers that all expire on the same tick.
+ * - An interrupt flood: a task that keeps triggering an interrupt, supplied by
+ *   the application, whose handler calls vLatencySoakInterruptHandler().  The
+ *   handler sends a task notification, so each interrupt takes a kernel
+ *   critical section.  The triggers can be spaced by a number of cycles, to
+ *   move the interrupts relative to the tick.
+ * - Event group broadcasts: a task setting a bit that a number of waiting
+ *   tasks are blocked on, so each xEventGroupSetBits() walks the waiters with
+ *   the scheduler suspended.
+ *
+ * configUSE_LATENCY_SOAK must be set to 1 in FreeRTOSConfig.h for the soak to
+ * be available.  The tasks, queue and timers are allocated from the heap.
+ */
+
+/* Load bits for the ulLoads member of LatencySoakConfig_t. */
+#define latencysoakLOAD_QUEUE_STORM    ( ( uint32_t ) 0x01UL )
+#define latencysoakLOAD_HEAP_CHURN     ( ( uint32_t ) 0x02UL )
+#define latencysoakLOAD_TIMER_BURST    ( ( uint32_t ) 0x04UL )
+#define latencysoakLOAD_ISR_FLOOD      ( ( uint32_t ) 0x08UL )
+#define latencysoakLOAD_EVENT_GROUP    ( ( uint32_t ) 0x10UL )
+
+/**
+ * latency_soak.h
+ *
+ * The parameters of a soak run, passed to xLatencySoakStart().
+ *
+ * \defgroup LatencySoakConfig_t LatencySoakConfig_t
+ * \ingroup LatencySoak
+ */
+typedef struct xLATENCY_SOAK_CONFIG
+{
+    UBaseType_t uxMeasurementTasks;      /*< The number of measurement tasks, up to configLATENCY_SOAK_MAX_TASKS. */
+    UBaseType_t uxHighestPriority;       /*< Measurement task n runs at uxHighestPriority - n. */
+    TickType_t xPeriod;                  /*< The period of measurement task 0. */
+    TickType_t xPeriodStep;              /*< Measurement task n has a period of xPeriod + ( n * xPeriodStep ). */
+    uint32_t ulBinWidthCycles;           /*< The width of each histogram bin in cycles.  Must not be 0. */
+    uint32_t ulLoads;                    /*< Bitwise OR of the latencysoakLOAD_ values to run. */
+    UBaseType_t uxLoadPriority;          /*< The priority of the load tasks.  Must be below every measurement task. */
+    UBaseType_t uxBurstTimers;           /*< The number of timers in a timer burst. */
+    TickType_t xBurstPeriod;             /*< The time between timer bursts. */
+    void ( * pxTriggerInterrupt )( void ); /*< Pends the interrupt used for the interrupt flood. */
+    uint32_t ulInterruptSpacingCycles;   /*< The cycles the interrupt flood waits after each trigger. */
+    UBaseType_t uxEventWaiters;          /*< The number of tasks waiting on the event group broadcasts. */
+} LatencySoakConfig_t;
+
+/**
+ * latency_soak.h
+ *
+ * The wake-up latency measured by one measurement task.  All times are in
+ * cycles.  Bin n of ulHistogram counts the wakes with a latency from
+ * n * ulBinWidthCycles up to, but not including, ( n + 1 ) * ulBinWidthCycles.
+ *
+ * \defgroup LatencySoakResult_t LatencySoakResult_t
+ * \ingroup LatencySoak
+ */
+typedef struct xLATENCY_SOAK_RESULT
+{
+    UBaseType_t uxPriority;                                    /*< The priority of the task. */
+    TickType_t xPeriod;                                        /*< The period of the task. */
+    uint32_t ulSamples;                                        /*< The number of wakes measured. */
+    uint32_t ulMinCycles;                                      /*< The lowest latency. */
+    uint32_t ulMaxCycles;                                      /*< The highest latency. */
+    uint64_t ullTotalCycles;                                   /*< The sum of all latencies, for the mean. */
+    uint32_t ulOverflows;                                      /*< Wakes too late for the last bin. */
+    uint32_t ulHistogram[ configLATENCY_SOAK_HISTOGRAM_BINS ]; /*< The latency histogram. */
+} LatencySoakResult_t;
+
+/**
+ * latency_soak.h
+ * @code{c}
+ * BaseType_t xLatencySoakStart( const LatencySoakConfig_t * pxConfig );
+ * @endcode
+ *
+ * Clear the results and create the measurement and load tasks.  Must be called
+ * from a task.
+ *
+ * Example usage:
+ * @code{c}
+ * static void prvWriteLine( const char * pcLine )
+ * {
+ *     printf( "%s\n", pcLine );
+ * }
+ *
+ * void vRunSoak( void )
+ * {
+ *     LatencySoakConfig_t xConfig =
+ *     {
+ *         .uxMeasurementTasks = 3,
+ *         .uxHighestPriority  = configMAX_PRIORITIES - 1,
+ *         .xPeriod            = 1,
+ *         .xPeriodStep        = 1,
+ *         .ulBinWidthCycles   = 100,
+ *         .ulLoads            = latencysoakLOAD_QUEUE_STORM | latencysoakLOAD_HEAP_CHURN,
+ *         .uxLoadPriority     = 1,
+ *     };
+ *
+ *     xLatencySoakStart( &xConfig );
+ *     vTaskDelay( pdMS_TO_TICKS( 8UL * 60UL * 60UL * 1000UL ) );
+ *     vLatencySoakStop();
+ *     vLatencySoakPrintResults( prvWriteLine );
+ * }
+ * @endcode
+ *
+ * @param pxConfig The parameters of the run.  Copied, so it need not remain
+ * valid.
+ *
+ * @return pdPASS if the soak started.  pdFAIL if a soak is still running or
+ * stopping, if pxConfig is invalid, if a load was requested that is not
+ * available, or if there was not enough heap - in which case anything that was
+ * created is stopped again.
+ *
+ * \defgroup xLatencySoakStart xLatencySoakStart
+ * \ingroup LatencySoak
+ */
+BaseType_t xLatencySoakStart( const LatencySoakConfig_t * pxConfig ) PRIVILEGED_FUNCTION;
+
+/**
+ * latency_soak.h
+ * @code{c}
+ * void vLatencySoakStop( void );
+ * @endcode
+ *
+ * Ask the soak to stop.  The timers are deleted at once, and each task frees
+ * what it allocated and deletes itself the next time it runs, so a new soak
+ * cannot be started until xLatencySoakIsRunning() returns pdFALSE.  The
+ * results remain readable.
+ *
+ * \defgroup vLatencySoakStop vLatencySoakStop
+ * \ingroup LatencySoak
+ */
+void vLatencySoakStop( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * latency_soak.h
+ * @code{c}
+ * BaseType_t xLatencySoakIsRunning( void );
+ * @endcode
+ *
+ * @return pdTRUE while any task created by xLatencySoakStart() still exists.
+ *
+ * \defgroup xLatencySoakIsRunning xLatencySoakIsRunning
+ * \ingroup LatencySoak
+ */
+BaseType_t xLatencySoakIsRunning( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * latency_soak.h
+ * @code{c}
+ * BaseType_t xLatencySoakGetResult( UBaseType_t uxTask, LatencySoakResult_t * pxResult );
+ * @endcode
+ *
+ * Copy the results of a measurement task.  Can be called while the soak runs.
+ *
+ * @param uxTask The index of the measurement task.
+ *
+ * @param pxResult Where to copy the results.
+ *
+ * @return pdPASS if uxTask was used by the last soak, otherwise pdFAIL.
+ *
+ * \defgroup xLatencySoakGetResult xLatencySoakGetResult
+ * \ingroup LatencySoak
+ */
+BaseType_t xLatencySoakGetResult( UBaseType_t uxTask,
+                                  LatencySoakResult_t * pxResult ) PRIVILEGED_FUNCTION;
+
+/**
+ * latency_soak.h
+ * @code{c}
+ * void vLatencySoakPrintResults( void ( * pxWriteLine )( const char * pcLine ) );
+ * @endcode
+ *
+ * Format the results of every measurement task as text, one line at a time:
+ * a summary line per task with the minimum, mean and maximum latency, followed
+ * by a line for each non-empty histogram bin.  The lines have no line ending.
+ *
+ * @param pxWriteLine Called with each line.
+ *
+ * \defgroup vLatencySoakPrintResults vLatencySoakPrintResults
+ * \ingroup LatencySoak
+ */
+void vLatencySoakPrintResults( void ( * pxWriteLine )( const char * pcLine ) ) PRIVILEGED_FUNCTION;
+
+/**
+ * latency_soak.h
+ * @code{c}
+ * void vLatencySoakInterruptHandler( void );
+ * @endcode
+ *
+ * Called by the application from the handler of the interrupt that
+ * pxTriggerInterrupt pends.  The interrupt priority must be at or below
+ * configMAX_SYSCALL_INTERRUPT_PRIORITY.
+ *
+ * \defgroup vLatencySoakInterruptHandler vLatencySoakInterruptHandler
+ * \ingroup LatencySoak
+ */
+void vLatencySoakInterruptHandler( void ) PRIVILEGED_FUNCTION;
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* LATENCY_SOAK_H */
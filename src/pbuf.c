@@ -0,0 +1,566 @@
+/*
+ * FreeRTOS Kernel V10.5.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Standard includes. */
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers.  That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "pbuf.h"
+
+/* Lint e961, e750 and e9021 are suppressed as a MISRA exception justified
+ * because the MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750 !e9021 See comment above. */
+
+/* This entire source file will be skipped if the application is not configured
+ * to include packet buffer functionality.  This #if is closed at the very
+ * bottom of this file. */
+#if ( configUSE_PACKET_BUFFERS == 1 )
+
+/* A single segment of a packet buffer chain.  The data of the segment occupies
+ * ucStorage[ usOffset ] to ucStorage[ usOffset + usLength - 1 ], leaving
+ * usOffset bytes of headroom in front of it and the rest of ucStorage as
+ * tailroom after it. */
+    typedef struct PacketBufferDef_t
+    {
+        struct PacketBufferDef_t * pxNext;                      /*< The next segment of the chain, or the next free segment while in the pool. */
+        uint16_t usOffset;                                      /*< Offset of the data into ucStorage. */
+        uint16_t usLength;                                      /*< Number of bytes of data held in the segment. */
+        uint16_t usRefCount;                                    /*< Number of references to the segment.  0 while the segment is in the pool. */
+        uint8_t ucStorage[ configPACKET_BUFFER_SEGMENT_SIZE ]; /*< Headroom, data and tailroom. */
+    } PacketBuffer_t;
+
+/* The pool of segments, and the list of segments not currently part of any
+ * chain.  The list is only accessed with interrupts masked, so segments can be
+ * allocated and freed from tasks and interrupts alike. */
+    PRIVILEGED_DATA static PacketBuffer_t xPacketBufferPool[ configPACKET_BUFFER_POOL_SEGMENTS ];
+    PRIVILEGED_DATA static PacketBuffer_t * pxFreePacketBuffers = NULL;
+    PRIVILEGED_DATA static UBaseType_t uxFreePacketBuffers = ( UBaseType_t ) 0U;
+    PRIVILEGED_DATA static UBaseType_t uxMinimumEverFreePacketBuffers = ( UBaseType_t ) 0U;
+    PRIVILEGED_DATA static BaseType_t xPacketBufferPoolInitialised = pdFALSE;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Place every segment in the pool on the free list.  Called with interrupts
+ * masked the first time a segment is allocated.
+ */
+    static void prvInitialisePacketBufferPool( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * Return the last segment of the chain that starts with pxPacketBuffer.
+ */
+    static PacketBuffer_t * prvGetLastSegment( PacketBuffer_t * pxPacketBuffer ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+    static void prvInitialisePacketBufferPool( void )
+    {
+        UBaseType_t uxSegment;
+
+        for( uxSegment = ( UBaseType_t ) 0U; uxSegment < ( UBaseType_t ) configPACKET_BUFFER_POOL_SEGMENTS; uxSegment++ )
+        {
+            xPacketBufferPool[ uxSegment ].pxNext = pxFreePacketBuffers;
+            xPacketBufferPool[ uxSegment ].usRefCount = ( uint16_t ) 0U;
+            pxFreePacketBuffers = &( xPacketBufferPool[ uxSegment ] );
+        }
+
+        uxFreePacketBuffers = ( UBaseType_t ) configPACKET_BUFFER_POOL_SEGMENTS;
+        uxMinimumEverFreePacketBuffers = uxFreePacketBuffers;
+        xPacketBufferPoolInitialised = pdTRUE;
+    }
+/*-----------------------------------------------------------*/
+
+    static PacketBuffer_t * prvGetLastSegment( PacketBuffer_t * pxPacketBuffer )
+    {
+        while( pxPacketBuffer->pxNext != NULL )
+        {
+            pxPacketBuffer = pxPacketBuffer->pxNext;
+        }
+
+        return pxPacketBuffer;
+    }
+/*-----------------------------------------------------------*/
+
+    PacketBufferHandle_t xPacketBufferAlloc( size_t xLength,
+                                             size_t xHeadroom )
+    {
+        PacketBuffer_t * pxHead = NULL;
+        PacketBuffer_t * pxSegment;
+        UBaseType_t uxSegmentsNeeded = ( UBaseType_t ) 1U;
+        UBaseType_t uxSegment;
+        UBaseType_t uxSavedInterruptStatus;
+        size_t xRemaining = xLength;
+        size_t xSpace;
+
+        configASSERT( xHeadroom <= ( size_t ) configPACKET_BUFFER_SEGMENT_SIZE );
+
+        /* The first segment holds whatever data fits after the headroom, and
+         * each further segment holds a full segment of data. */
+        xSpace = ( size_t ) configPACKET_BUFFER_SEGMENT_SIZE - xHeadroom;
+
+        if( xRemaining > xSpace )
+        {
+            uxSegmentsNeeded += ( UBaseType_t ) ( ( ( xRemaining - xSpace ) + ( ( size_t ) configPACKET_BUFFER_SEGMENT_SIZE - 1U ) ) / ( size_t ) configPACKET_BUFFER_SEGMENT_SIZE );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+        {
+            if( xPacketBufferPoolInitialised == pdFALSE )
+            {
+                prvInitialisePacketBufferPool();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            /* Either all the segments the chain needs are taken or none are,
+             * so a failed allocation never leaves a partial chain behind. */
+            if( uxFreePacketBuffers >= uxSegmentsNeeded )
+            {
+                pxHead = pxFreePacketBuffers;
+                pxSegment = pxHead;
+
+                for( uxSegment = ( UBaseType_t ) 1U; uxSegment < uxSegmentsNeeded; uxSegment++ )
+                {
+                    pxSegment = pxSegment->pxNext;
+                }
+
+                pxFreePacketBuffers = pxSegment->pxNext;
+                pxSegment->pxNext = NULL;
+                uxFreePacketBuffers -= uxSegmentsNeeded;
+
+                if( uxFreePacketBuffers < uxMinimumEverFreePacketBuffers )
+                {
+                    uxMinimumEverFreePacketBuffers = uxFreePacketBuffers;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+
+        /* The segments now belong to the caller alone, so can be set up
+         * without interrupts masked. */
+        for( pxSegment = pxHead; pxSegment != NULL; pxSegment = pxSegment->pxNext )
+        {
+            pxSegment->usOffset = ( uint16_t ) ( ( pxSegment == pxHead ) ? xHeadroom : 0U );
+            pxSegment->usLength = ( uint16_t ) ( ( xRemaining < xSpace ) ? xRemaining : xSpace );
+            pxSegment->usRefCount = ( uint16_t ) 1U;
+
+            xRemaining -= ( size_t ) pxSegment->usLength;
+            xSpace = ( size_t ) configPACKET_BUFFER_SEGMENT_SIZE;
+        }
+
+        return pxHead;
+    }
+/*-----------------------------------------------------------*/
+
+    void vPacketBufferFree( PacketBufferHandle_t xPacketBuffer )
+    {
+        PacketBuffer_t * pxSegment = xPacketBuffer;
+        PacketBuffer_t * pxNext;
+        UBaseType_t uxSavedInterruptStatus;
+
+        /* Each segment is released in its own critical section, so freeing a
+         * long chain does not hold interrupts off for the whole walk.  The walk
+         * stops at the first segment that is still referenced, as the rest of
+         * the chain belongs to that reference. */
+        while( pxSegment != NULL )
+        {
+            uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+            {
+                configASSERT( pxSegment->usRefCount > ( uint16_t ) 0U );
+                pxSegment->usRefCount--;
+
+                if( pxSegment->usRefCount == ( uint16_t ) 0U )
+                {
+                    pxNext = pxSegment->pxNext;
+                    pxSegment->pxNext = pxFreePacketBuffers;
+                    pxFreePacketBuffers = pxSegment;
+                    uxFreePacketBuffers++;
+                }
+                else
+                {
+                    pxNext = NULL;
+                }
+            }
+            taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+
+            pxSegment = pxNext;
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    void vPacketBufferRef( PacketBufferHandle_t xPacketBuffer )
+    {
+        UBaseType_t uxSavedInterruptStatus;
+
+        configASSERT( xPacketBuffer );
+
+        uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+        {
+            configASSERT( xPacketBuffer->usRefCount < ( uint16_t ) 0xffffU );
+            xPacketBuffer->usRefCount++;
+        }
+        taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+    }
+/*-----------------------------------------------------------*/
+
+    void vPacketBufferChain( PacketBufferHandle_t xHead,
+                             PacketBufferHandle_t xTail )
+    {
+        configASSERT( xHead );
+        configASSERT( xTail );
+        configASSERT( xHead != xTail );
+
+        prvGetLastSegment( xHead )->pxNext = xTail;
+    }
+/*-----------------------------------------------------------*/
+
+    void * pvPacketBufferPush( PacketBufferHandle_t xPacketBuffer,
+                               size_t xBytes )
+    {
+        void * pvReturn = NULL;
+
+        configASSERT( xPacketBuffer );
+
+        if( xBytes <= ( size_t ) xPacketBuffer->usOffset )
+        {
+            xPacketBuffer->usOffset -= ( uint16_t ) xBytes;
+            xPacketBuffer->usLength += ( uint16_t ) xBytes;
+            pvReturn = &( xPacketBuffer->ucStorage[ xPacketBuffer->usOffset ] );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return pvReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    void * pvPacketBufferPull( PacketBufferHandle_t xPacketBuffer,
+                               size_t xBytes )
+    {
+        void * pvReturn = NULL;
+
+        configASSERT( xPacketBuffer );
+
+        if( xBytes <= ( size_t ) xPacketBuffer->usLength )
+        {
+            xPacketBuffer->usOffset += ( uint16_t ) xBytes;
+            xPacketBuffer->usLength -= ( uint16_t ) xBytes;
+            pvReturn = &( xPacketBuffer->ucStorage[ xPacketBuffer->usOffset ] );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return pvReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    void * pvPacketBufferPut( PacketBufferHandle_t xPacketBuffer,
+                              size_t xBytes )
+    {
+        PacketBuffer_t * pxLast;
+        void * pvReturn = NULL;
+
+        configASSERT( xPacketBuffer );
+
+        pxLast = prvGetLastSegment( xPacketBuffer );
+
+        if( xBytes <= xPacketBufferTailroom( pxLast ) )
+        {
+            pvReturn = &( pxLast->ucStorage[ pxLast->usOffset + pxLast->usLength ] );
+            pxLast->usLength += ( uint16_t ) xBytes;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return pvReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    PacketBufferHandle_t xPacketBufferNext( PacketBufferHandle_t xPacketBuffer )
+    {
+        configASSERT( xPacketBuffer );
+
+        return xPacketBuffer->pxNext;
+    }
+/*-----------------------------------------------------------*/
+
+    void * pvPacketBufferData( PacketBufferHandle_t xPacketBuffer )
+    {
+        configASSERT( xPacketBuffer );
+
+        return &( xPacketBuffer->ucStorage[ xPacketBuffer->usOffset ] );
+    }
+/*-----------------------------------------------------------*/
+
+    size_t xPacketBufferLength( PacketBufferHandle_t xPacketBuffer )
+    {
+        configASSERT( xPacketBuffer );
+
+        return ( size_t ) xPacketBuffer->usLength;
+    }
+/*-----------------------------------------------------------*/
+
+    size_t xPacketBufferHeadroom( PacketBufferHandle_t xPacketBuffer )
+    {
+        configASSERT( xPacketBuffer );
+
+        return ( size_t ) xPacketBuffer->usOffset;
+    }
+/*-----------------------------------------------------------*/
+
+    size_t xPacketBufferTailroom( PacketBufferHandle_t xPacketBuffer )
+    {
+        configASSERT( xPacketBuffer );
+
+        return ( size_t ) configPACKET_BUFFER_SEGMENT_SIZE - ( size_t ) xPacketBuffer->usOffset - ( size_t ) xPacketBuffer->usLength;
+    }
+/*-----------------------------------------------------------*/
+
+    size_t xPacketBufferTotalLength( PacketBufferHandle_t xPacketBuffer )
+    {
+        size_t xTotal = 0;
+
+        for( ; xPacketBuffer != NULL; xPacketBuffer = xPacketBuffer->pxNext )
+        {
+            xTotal += ( size_t ) xPacketBuffer->usLength;
+        }
+
+        return xTotal;
+    }
+/*-----------------------------------------------------------*/
+
+    size_t xPacketBufferCopyOut( PacketBufferHandle_t xPacketBuffer,
+                                 size_t xOffset,
+                                 void * pvDestination,
+                                 size_t xLength )
+    {
+        uint8_t * pucDestination = ( uint8_t * ) pvDestination;
+        size_t xCopied = 0;
+        size_t xBytes;
+
+        configASSERT( pvDestination );
+
+        for( ; ( xPacketBuffer != NULL ) && ( xCopied < xLength ); xPacketBuffer = xPacketBuffer->pxNext )
+        {
+            if( xOffset >= ( size_t ) xPacketBuffer->usLength )
+            {
+                /* The copy starts in a later segment. */
+                xOffset -= ( size_t ) xPacketBuffer->usLength;
+            }
+            else
+            {
+                xBytes = ( size_t ) xPacketBuffer->usLength - xOffset;
+
+                if( xBytes > ( xLength - xCopied ) )
+                {
+                    xBytes = xLength - xCopied;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                portMEMCPY( &( pucDestination[ xCopied ] ), &( xPacketBuffer->ucStorage[ xPacketBuffer->usOffset + xOffset ] ), xBytes );
+                xCopied += xBytes;
+                xOffset = 0;
+            }
+        }
+
+        return xCopied;
+    }
+/*-----------------------------------------------------------*/
+
+    UBaseType_t uxPacketBufferGetFreeCount( void )
+    {
+        UBaseType_t uxReturn;
+
+        /* The pool is only set up on first use, before which every segment is
+         * free. */
+        if( xPacketBufferPoolInitialised == pdFALSE )
+        {
+            uxReturn = ( UBaseType_t ) configPACKET_BUFFER_POOL_SEGMENTS;
+        }
+        else
+        {
+            uxReturn = uxFreePacketBuffers;
+        }
+
+        return uxReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    UBaseType_t uxPacketBufferGetMinimumEverFreeCount( void )
+    {
+        UBaseType_t uxReturn;
+
+        if( xPacketBufferPoolInitialised == pdFALSE )
+        {
+            uxReturn = ( UBaseType_t ) configPACKET_BUFFER_POOL_SEGMENTS;
+        }
+        else
+        {
+            uxReturn = uxMinimumEverFreePacketBuffers;
+        }
+
+        return uxReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xPacketBufferSendToQueue( QueueHandle_t xQueue,
+                                         PacketBufferHandle_t xPacketBuffer,
+                                         TickType_t xTicksToWait )
+    {
+        configASSERT( xPacketBuffer );
+
+        /* Only the handle is copied into the queue. */
+        return xQueueSendToBack( xQueue, &xPacketBuffer, xTicksToWait );
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xPacketBufferSendToQueueFromISR( QueueHandle_t xQueue,
+                                                PacketBufferHandle_t xPacketBuffer,
+                                                BaseType_t * const pxHigherPriorityTaskWoken )
+    {
+        configASSERT( xPacketBuffer );
+
+        return xQueueSendToBackFromISR( xQueue, &xPacketBuffer, pxHigherPriorityTaskWoken );
+    }
+/*-----------------------------------------------------------*/
+
+    PacketBufferHandle_t xPacketBufferReceiveFromQueue( QueueHandle_t xQueue,
+                                                        TickType_t xTicksToWait )
+    {
+        PacketBufferHandle_t xPacketBuffer = NULL;
+
+        if( xQueueReceive( xQueue, &xPacketBuffer, xTicksToWait ) != pdPASS )
+        {
+            xPacketBuffer = NULL;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xPacketBuffer;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xPacketBufferSendToMessageBuffer( MessageBufferHandle_t xMessageBuffer,
+                                                 PacketBufferHandle_t xPacketBuffer,
+                                                 TickType_t xTicksToWait )
+    {
+        BaseType_t xReturn = pdFAIL;
+
+        configASSERT( xPacketBuffer );
+
+        /* Only the handle is copied into the message buffer. */
+        if( xMessageBufferSend( xMessageBuffer, &xPacketBuffer, sizeof( xPacketBuffer ), xTicksToWait ) == sizeof( xPacketBuffer ) )
+        {
+            xReturn = pdPASS;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xPacketBufferSendToMessageBufferFromISR( MessageBufferHandle_t xMessageBuffer,
+                                                        PacketBufferHandle_t xPacketBuffer,
+                                                        BaseType_t * const pxHigherPriorityTaskWoken )
+    {
+        BaseType_t xReturn = pdFAIL;
+
+        configASSERT( xPacketBuffer );
+
+        if( xMessageBufferSendFromISR( xMessageBuffer, &xPacketBuffer, sizeof( xPacketBuffer ), pxHigherPriorityTaskWoken ) == sizeof( xPacketBuffer ) )
+        {
+            xReturn = pdPASS;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    PacketBufferHandle_t xPacketBufferReceiveFromMessageBuffer( MessageBufferHandle_t xMessageBuffer,
+                                                                TickType_t xTicksToWait )
+    {
+        PacketBufferHandle_t xPacketBuffer = NULL;
+
+        if( xMessageBufferReceive( xMessageBuffer, &xPacketBuffer, sizeof( xPacketBuffer ), xTicksToWait ) != sizeof( xPacketBuffer ) )
+        {
+            xPacketBuffer = NULL;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xPacketBuffer;
+    }
+
+/* This entire source file will be skipped if the application is not configured
+ * to include packet buffer functionality.  If you want to include packet buffer
+ * functionality then ensure configUSE_PACKET_BUFFERS is set to 1 in
+ * FreeRTOSConfig.h. */
+#endif /* configUSE_PACKET_BUFFERS == 1 */
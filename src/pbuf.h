@@ -0,0 +1,397 @@
+/*
+ * FreeRTOS Kernel V10.5.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+#ifndef PBUF_H
+#define PBUF_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h" must appear in source files before "include pbuf.h"
+#endif
+
+/* FreeRTOS includes. */
+#include "queue.h"
+#include "message_buffer.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * Packet buffers hold data, such as network frames, in chains of fixed size
+ * segments taken from a pool that is allocated at compile time.  Each segment
+ * reserves space in front of and behind its data, so a protocol layer can add
+ * a header with pvPacketBufferPush(), strip one with pvPacketBufferPull(), or
+ * add a trailer with pvPacketBufferPut(), all without moving the payload.  A
+ * chain is passed between tasks and interrupts by its handle, using the queue
+ * and message buffer functions at the end of this file, so a frame can travel
+ * from a driver to the application without being copied.
+ *
+ * The pool is protected by masking interrupts, so every function in this file
+ * can be called from both tasks and interrupts, other than the functions that
+ * block on a queue or message buffer.  configUSE_PACKET_BUFFERS must be set to
+ * 1 in FreeRTOSConfig.h for packet buffers to be available.  The size and
+ * number of segments are set by configPACKET_BUFFER_SEGMENT_SIZE and
+ * configPACKET_BUFFER_POOL_SEGMENTS.
+ */
+
+/**
+ * pbuf.h
+ *
+ * Type by which packet buffers are referenced.  A handle references the first
+ * segment of a chain, and xPacketBufferNext() returns the handle of the segment
+ * that follows it.
+ *
+ * \defgroup PacketBufferHandle_t PacketBufferHandle_t
+ * \ingroup PacketBuffer
+ */
+struct PacketBufferDef_t;
+typedef struct PacketBufferDef_t * PacketBufferHandle_t;
+
+/**
+ * pbuf.h
+ * @code{c}
+ * PacketBufferHandle_t xPacketBufferAlloc( size_t xLength, size_t xHeadroom );
+ * @endcode
+ *
+ * Take a chain of segments from the pool that is large enough to hold xLength
+ * bytes, after reserving xHeadroom bytes at the start of the first segment for
+ * headers that are added later.  The data length of the chain is set to
+ * xLength, and the reference count of each segment is set to 1.
+ *
+ * @param xLength The number of bytes of data the chain must hold.
+ *
+ * @param xHeadroom The number of bytes to reserve in front of the data.  Must
+ * not be greater than configPACKET_BUFFER_SEGMENT_SIZE.
+ *
+ * @return The handle of the chain, or NULL if the pool does not have enough
+ * free segments.  Segments are never partially allocated.
+ *
+ * \defgroup xPacketBufferAlloc xPacketBufferAlloc
+ * \ingroup PacketBuffer
+ */
+PacketBufferHandle_t xPacketBufferAlloc( size_t xLength,
+                                         size_t xHeadroom ) PRIVILEGED_FUNCTION;
+
+/**
+ * pbuf.h
+ * @code{c}
+ * void vPacketBufferFree( PacketBufferHandle_t xPacketBuffer );
+ * @endcode
+ *
+ * Release a reference to a chain.  The reference count of the first segment is
+ * decremented, and if it reaches 0 the segment is returned to the pool and the
+ * same is done for the next segment, until a segment that is still referenced
+ * elsewhere or the end of the chain is reached.
+ *
+ * @param xPacketBuffer The chain being released.
+ *
+ * \defgroup vPacketBufferFree vPacketBufferFree
+ * \ingroup PacketBuffer
+ */
+void vPacketBufferFree( PacketBufferHandle_t xPacketBuffer ) PRIVILEGED_FUNCTION;
+
+/**
+ * pbuf.h
+ * @code{c}
+ * void vPacketBufferRef( PacketBufferHandle_t xPacketBuffer );
+ * @endcode
+ *
+ * Increment the reference count of the first segment of a chain, so the chain
+ * can be held in more than one place - for example in a retransmit list and a
+ * driver transmit ring at the same time.  Each reference is released with a
+ * call to vPacketBufferFree().  A chain that is referenced more than once must
+ * be treated as read only.
+ *
+ * @param xPacketBuffer The chain being referenced.
+ *
+ * \defgroup vPacketBufferRef vPacketBufferRef
+ * \ingroup PacketBuffer
+ */
+void vPacketBufferRef( PacketBufferHandle_t xPacketBuffer ) PRIVILEGED_FUNCTION;
+
+/**
+ * pbuf.h
+ * @code{c}
+ * void vPacketBufferChain( PacketBufferHandle_t xHead, PacketBufferHandle_t xTail );
+ * @endcode
+ *
+ * Append the chain xTail to the end of the chain xHead.  The reference the
+ * caller held to xTail is transferred to xHead, so xTail must not be freed
+ * separately afterwards.
+ *
+ * @param xHead The chain being extended.
+ *
+ * @param xTail The chain being appended.
+ *
+ * \defgroup vPacketBufferChain vPacketBufferChain
+ * \ingroup PacketBuffer
+ */
+void vPacketBufferChain( PacketBufferHandle_t xHead,
+                         PacketBufferHandle_t xTail ) PRIVILEGED_FUNCTION;
+
+/**
+ * pbuf.h
+ * @code{c}
+ * void * pvPacketBufferPush( PacketBufferHandle_t xPacketBuffer, size_t xBytes );
+ * @endcode
+ *
+ * Grow the data of the first segment of a chain into its headroom, for example
+ * to add a protocol header in front of the payload.
+ *
+ * @param xPacketBuffer The chain to which the header is being added.
+ *
+ * @param xBytes The size of the header.
+ *
+ * @return A pointer to the new start of the data, at which the header should be
+ * written, or NULL if the first segment has less than xBytes of headroom.
+ *
+ * \defgroup pvPacketBufferPush pvPacketBufferPush
+ * \ingroup PacketBuffer
+ */
+void * pvPacketBufferPush( PacketBufferHandle_t xPacketBuffer,
+                           size_t xBytes ) PRIVILEGED_FUNCTION;
+
+/**
+ * pbuf.h
+ * @code{c}
+ * void * pvPacketBufferPull( PacketBufferHandle_t xPacketBuffer, size_t xBytes );
+ * @endcode
+ *
+ * Remove xBytes from the start of the data of the first segment of a chain,
+ * for example to strip a protocol header that has been processed.  The space
+ * becomes headroom again.
+ *
+ * @param xPacketBuffer The chain from which the header is being removed.
+ *
+ * @param xBytes The size of the header.
+ *
+ * @return A pointer to the new start of the data, or NULL if the first segment
+ * holds less than xBytes of data.
+ *
+ * \defgroup pvPacketBufferPull pvPacketBufferPull
+ * \ingroup PacketBuffer
+ */
+void * pvPacketBufferPull( PacketBufferHandle_t xPacketBuffer,
+                           size_t xBytes ) PRIVILEGED_FUNCTION;
+
+/**
+ * pbuf.h
+ * @code{c}
+ * void * pvPacketBufferPut( PacketBufferHandle_t xPacketBuffer, size_t xBytes );
+ * @endcode
+ *
+ * Grow the data of the last segment of a chain into its tailroom, for example
+ * to add a protocol trailer after the payload.
+ *
+ * @param xPacketBuffer The chain to which the trailer is being added.
+ *
+ * @param xBytes The size of the trailer.
+ *
+ * @return A pointer to the added bytes, or NULL if the last segment has less
+ * than xBytes of tailroom.
+ *
+ * \defgroup pvPacketBufferPut pvPacketBufferPut
+ * \ingroup PacketBuffer
+ */
+void * pvPacketBufferPut( PacketBufferHandle_t xPacketBuffer,
+                          size_t xBytes ) PRIVILEGED_FUNCTION;
+
+/**
+ * pbuf.h
+ * @code{c}
+ * PacketBufferHandle_t xPacketBufferNext( PacketBufferHandle_t xPacketBuffer );
+ * void * pvPacketBufferData( PacketBufferHandle_t xPacketBuffer );
+ * size_t xPacketBufferLength( PacketBufferHandle_t xPacketBuffer );
+ * size_t xPacketBufferHeadroom( PacketBufferHandle_t xPacketBuffer );
+ * size_t xPacketBufferTailroom( PacketBufferHandle_t xPacketBuffer );
+ * @endcode
+ *
+ * Access a single segment of a chain.  xPacketBufferNext() returns the segment
+ * that follows xPacketBuffer, or NULL at the end of the chain.
+ * pvPacketBufferData() returns the start of the segment's data, and
+ * xPacketBufferLength() its length in bytes.  xPacketBufferHeadroom() and
+ * xPacketBufferTailroom() return the unused space before and after the data.
+ *
+ * \defgroup xPacketBufferNext xPacketBufferNext
+ * \ingroup PacketBuffer
+ */
+PacketBufferHandle_t xPacketBufferNext( PacketBufferHandle_t xPacketBuffer ) PRIVILEGED_FUNCTION;
+void * pvPacketBufferData( PacketBufferHandle_t xPacketBuffer ) PRIVILEGED_FUNCTION;
+size_t xPacketBufferLength( PacketBufferHandle_t xPacketBuffer ) PRIVILEGED_FUNCTION;
+size_t xPacketBufferHeadroom( PacketBufferHandle_t xPacketBuffer ) PRIVILEGED_FUNCTION;
+size_t xPacketBufferTailroom( PacketBufferHandle_t xPacketBuffer ) PRIVILEGED_FUNCTION;
+
+/**
+ * pbuf.h
+ * @code{c}
+ * size_t xPacketBufferTotalLength( PacketBufferHandle_t xPacketBuffer );
+ * @endcode
+ *
+ * @return The sum of the data lengths of all the segments in a chain.
+ *
+ * \defgroup xPacketBufferTotalLength xPacketBufferTotalLength
+ * \ingroup PacketBuffer
+ */
+size_t xPacketBufferTotalLength( PacketBufferHandle_t xPacketBuffer ) PRIVILEGED_FUNCTION;
+
+/**
+ * pbuf.h
+ * @code{c}
+ * size_t xPacketBufferCopyOut( PacketBufferHandle_t xPacketBuffer, size_t xOffset, void * pvDestination, size_t xLength );
+ * @endcode
+ *
+ * Copy data out of a chain into a flat buffer, for the final consumer of data
+ * that cannot work on segments directly.
+ *
+ * @param xPacketBuffer The chain being read.
+ *
+ * @param xOffset The offset into the data of the chain at which to start.
+ *
+ * @param pvDestination The buffer into which the data is copied.
+ *
+ * @param xLength The maximum number of bytes to copy.
+ *
+ * @return The number of bytes copied, which is less than xLength if the chain
+ * holds fewer than xOffset + xLength bytes.
+ *
+ * \defgroup xPacketBufferCopyOut xPacketBufferCopyOut
+ * \ingroup PacketBuffer
+ */
+size_t xPacketBufferCopyOut( PacketBufferHandle_t xPacketBuffer,
+                             size_t xOffset,
+                             void * pvDestination,
+                             size_t xLength ) PRIVILEGED_FUNCTION;
+
+/**
+ * pbuf.h
+ * @code{c}
+ * UBaseType_t uxPacketBufferGetFreeCount( void );
+ * UBaseType_t uxPacketBufferGetMinimumEverFreeCount( void );
+ * @endcode
+ *
+ * @return The number of segments currently free in the pool, and the lowest
+ * number that have been free at any time since the pool was first used.
+ *
+ * \defgroup uxPacketBufferGetFreeCount uxPacketBufferGetFreeCount
+ * \ingroup PacketBuffer
+ */
+UBaseType_t uxPacketBufferGetFreeCount( void ) PRIVILEGED_FUNCTION;
+UBaseType_t uxPacketBufferGetMinimumEverFreeCount( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * pbuf.h
+ * @code{c}
+ * QueueHandle_t xPacketBufferQueueCreate( UBaseType_t uxQueueLength );
+ * @endcode
+ *
+ * Create a queue that holds packet buffer handles, for use with
+ * xPacketBufferSendToQueue() and xPacketBufferReceiveFromQueue().  Only the
+ * handle is copied into and out of the queue, never the data.
+ *
+ * \defgroup xPacketBufferQueueCreate xPacketBufferQueueCreate
+ * \ingroup PacketBuffer
+ */
+#define xPacketBufferQueueCreate( uxQueueLength )    xQueueCreate( ( uxQueueLength ), sizeof( PacketBufferHandle_t ) )
+
+/**
+ * pbuf.h
+ * @code{c}
+ * BaseType_t xPacketBufferSendToQueue( QueueHandle_t xQueue, PacketBufferHandle_t xPacketBuffer, TickType_t xTicksToWait );
+ * BaseType_t xPacketBufferSendToQueueFromISR( QueueHandle_t xQueue, PacketBufferHandle_t xPacketBuffer, BaseType_t * pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * Pass a chain to the back of a queue created by xPacketBufferQueueCreate().
+ * If the send succeeds the caller's reference to the chain passes to the
+ * receiver, so the caller must not use or free the chain afterwards.  If the
+ * send fails the caller still holds the reference.
+ *
+ * @return pdPASS if the handle was queued, otherwise errQUEUE_FULL.
+ *
+ * \defgroup xPacketBufferSendToQueue xPacketBufferSendToQueue
+ * \ingroup PacketBuffer
+ */
+BaseType_t xPacketBufferSendToQueue( QueueHandle_t xQueue,
+                                     PacketBufferHandle_t xPacketBuffer,
+                                     TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+BaseType_t xPacketBufferSendToQueueFromISR( QueueHandle_t xQueue,
+                                            PacketBufferHandle_t xPacketBuffer,
+                                            BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * pbuf.h
+ * @code{c}
+ * PacketBufferHandle_t xPacketBufferReceiveFromQueue( QueueHandle_t xQueue, TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Receive a chain from a queue created by xPacketBufferQueueCreate().  The
+ * caller becomes responsible for the reference the sender passed.
+ *
+ * @return The handle of the chain, or NULL if no chain was received before
+ * xTicksToWait expired.
+ *
+ * \defgroup xPacketBufferReceiveFromQueue xPacketBufferReceiveFromQueue
+ * \ingroup PacketBuffer
+ */
+PacketBufferHandle_t xPacketBufferReceiveFromQueue( QueueHandle_t xQueue,
+                                                    TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * pbuf.h
+ * @code{c}
+ * BaseType_t xPacketBufferSendToMessageBuffer( MessageBufferHandle_t xMessageBuffer, PacketBufferHandle_t xPacketBuffer, TickType_t xTicksToWait );
+ * BaseType_t xPacketBufferSendToMessageBufferFromISR( MessageBufferHandle_t xMessageBuffer, PacketBufferHandle_t xPacketBuffer, BaseType_t * pxHigherPriorityTaskWoken );
+ * PacketBufferHandle_t xPacketBufferReceiveFromMessageBuffer( MessageBufferHandle_t xMessageBuffer, TickType_t xTicksToWait );
+ * @endcode
+ *
+ * As the queue functions above, but for a message buffer.  Each message is the
+ * handle of one chain, so the message buffer must be able to hold at least
+ * sizeof( PacketBufferHandle_t ) + sizeof( size_t ) bytes per chain.  The
+ * usual single writer and single reader restrictions of message buffers
+ * apply.
+ *
+ * \defgroup xPacketBufferSendToMessageBuffer xPacketBufferSendToMessageBuffer
+ * \ingroup PacketBuffer
+ */
+BaseType_t xPacketBufferSendToMessageBuffer( MessageBufferHandle_t xMessageBuffer,
+                                             PacketBufferHandle_t xPacketBuffer,
+                                             TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+BaseType_t xPacketBufferSendToMessageBufferFromISR( MessageBufferHandle_t xMessageBuffer,
+                                                    PacketBufferHandle_t xPacketBuffer,
+                                                    BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+PacketBufferHandle_t xPacketBufferReceiveFromMessageBuffer( MessageBufferHandle_t xMessageBuffer,
+                                                            TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* PBUF_H */
@@ -34,6 +34,14 @@
 #include "FreeRTOS.h"
 #include "task.h"
 
+#if (configCOPY_OFFLOAD_THRESHOLD > 0)
+#include "semphr.h"
+#endif
+
+#if (configUSE_SWI == 1)
+#include "swi.h"
+#endif
+
 #ifndef __VFP_FP__
 #error This port can only be used when the project options are configured to enable hardware floating point support.
 #endif
@@ -65,6 +73,12 @@
 #define portPRIORITY_GROUP_MASK (0x07UL << 8UL)
 #define portPRIGROUP_SHIFT (8UL)
 
+/* Constants required to start the DWT cycle counter. */
+#define portDEMCR_REG (*((volatile uint32_t *)0xe000edfc))
+#define portDWT_CTRL_REG (*((volatile uint32_t *)0xe0001000))
+#define portDEMCR_TRCENA_BIT (1UL << 24UL)
+#define portDWT_CTRL_CYCCNTENA_BIT (1UL << 0UL)
+
 /* Masks off all bits but the VECTACTIVE bits in the ICSR register. */
 #define portVECTACTIVE_MASK (0xFFUL)
 
@@ -123,6 +137,26 @@ void xPortPendSVHandler(void) __attribute__((naked));
 void xPortSysTickHandler(void);
 void vPortSVCHandler(void) __attribute__((naked));
 
+/*
+ * Work the PendSV handler does, with interrupts enabled and on the main stack,
+ * before it switches context.  Called from the PendSV handler only.
+ */
+#if ((configUSE_DEFERRED_TICK_PROCESSING == 1) || (configUSE_SWI == 1))
+#define portPENDSV_DEFERRED_WORK 1
+void vPortPendSVDeferredWork(void);
+#else
+#define portPENDSV_DEFERRED_WORK 0
+#endif
+
+/*
+ * Restart the SysTick from the partial tick period in portNVIC_SYSTICK_LOAD_REG,
+ * then set the reload value back to one tick period.  Used when the tick has
+ * been suppressed.
+ */
+#if ((configUSE_TICKLESS_IDLE == 1) || (configUSE_ADAPTIVE_TICK == 1))
+static void prvRestartTickPeriod(void);
+#endif
+
 /*
  * Start first task is a separate function so it can be tested in isolation.
  */
@@ -147,25 +181,34 @@ static UBaseType_t uxCriticalNesting = 0xaaaaaaaa;
 /*
  * The number of SysTick increments that make up one tick period.
  */
-#if (configUSE_TICKLESS_IDLE == 1)
+#if ((configUSE_TICKLESS_IDLE == 1) || (configUSE_ADAPTIVE_TICK == 1))
 static uint32_t ulTimerCountsForOneTick = 0;
-#endif /* configUSE_TICKLESS_IDLE */
+#endif /* configUSE_TICKLESS_IDLE || configUSE_ADAPTIVE_TICK */
 
 /*
  * The maximum number of tick periods that can be suppressed is limited by the
  * 24 bit resolution of the SysTick timer.
  */
-#if (configUSE_TICKLESS_IDLE == 1)
+#if ((configUSE_TICKLESS_IDLE == 1) || (configUSE_ADAPTIVE_TICK == 1))
 static uint32_t xMaximumPossibleSuppressedTicks = 0;
-#endif /* configUSE_TICKLESS_IDLE */
+#endif /* configUSE_TICKLESS_IDLE || configUSE_ADAPTIVE_TICK */
 
 /*
  * Compensate for the CPU cycles that pass while the SysTick is stopped (low
- * power functionality only.
+ * power and adaptive tick functionality only).
  */
-#if (configUSE_TICKLESS_IDLE == 1)
+#if ((configUSE_TICKLESS_IDLE == 1) || (configUSE_ADAPTIVE_TICK == 1))
 static uint32_t ulStoppedTimerCompensation = 0;
-#endif /* configUSE_TICKLESS_IDLE */
+#endif /* configUSE_TICKLESS_IDLE || configUSE_ADAPTIVE_TICK */
+
+/*
+ * The SysTick reload value and the number of tick periods programmed by
+ * xPortAdaptiveTickStart() for the tick currently being deferred.
+ */
+#if (configUSE_ADAPTIVE_TICK == 1)
+static uint32_t ulAdaptiveReloadValue = 0;
+static TickType_t xAdaptiveTicks = 0;
+#endif /* configUSE_ADAPTIVE_TICK */
 
 /*
  * Used by the portASSERT_IF_INTERRUPT_PRIORITY_INVALID() macro to ensure
@@ -178,6 +221,105 @@ static uint32_t ulMaxPRIGROUPValue = 0;
 static uint8_t const volatile *const pcInterruptPriorityRegisters = (uint8_t const volatile *const)portNVIC_IP_REGISTERS_OFFSET_16;
 #endif /* configASSERT_DEFINED */
 
+#if (configUSE_PORT_OPTIMISED_COPY == 1)
+
+/*
+ * Accesses used by the copy routines.  The aligned(4) double word lets the
+ * compiler use LDRD/STRD, which only require word alignment, and the Cortex-M7
+ * performs the unaligned word accesses used when the buffers are not word
+ * aligned.  All of them may alias the objects being copied or filled.
+ */
+typedef uint64_t portALIGNED_DOUBLE_WORD __attribute__((aligned(4), may_alias));
+typedef uint32_t portALIGNED_WORD __attribute__((aligned(4), may_alias));
+typedef uint32_t portUNALIGNED_WORD __attribute__((aligned(1), may_alias));
+#endif /* configUSE_PORT_OPTIMISED_COPY */
+
+/*
+ * Copy statistics, updated with interrupts masked as copies are made from
+ * tasks and interrupts alike.
+ */
+#if (configGENERATE_COPY_STATS == 1)
+static PortCopyStats_t xCopyStats = {0};
+static void prvRecordCopy(size_t xBytes);
+#define portRECORD_COPY(xBytes) prvRecordCopy(xBytes)
+#else
+#define portRECORD_COPY(xBytes)
+#endif /* configGENERATE_COPY_STATS */
+
+/*
+ * The task waiting for an offloaded copy to complete blocks on
+ * xCopyOffloadComplete.  Only one copy is offloaded at a time.
+ */
+#if (configCOPY_OFFLOAD_THRESHOLD > 0)
+static SemaphoreHandle_t xCopyOffloadComplete = NULL;
+static BaseType_t xCopyOffloadInProgress = pdFALSE;
+#endif /* configCOPY_OFFLOAD_THRESHOLD */
+
+/*
+ * Cycle count at which the outermost critical section was entered, kept when
+ * the port profile or the flight recorder needs critical section lengths.
+ */
+#if ((configGENERATE_PORT_PROFILE == 1) || (configUSE_FLIGHT_RECORDER == 1))
+#define portTIME_CRITICAL_SECTIONS 1
+static uint32_t ulCriticalSectionEntryCycles = 0;
+#else
+#define portTIME_CRITICAL_SECTIONS 0
+#endif
+
+/*
+ * Port profile.  xPortProfile and ulPendSVEntryCycles are also accessed by the
+ * PendSV handler, which records the context switch path in assembly.
+ */
+#if (configGENERATE_PORT_PROFILE == 1)
+static PortProfile_t xPortProfile __attribute__((used)) = {0};
+static uint32_t ulPendSVEntryCycles __attribute__((used)) = 0;
+static void prvRecordPathProfile(PortPathProfile_t *pxPath, uint32_t ulCycles);
+
+#define portPROFILE_PENDSV_ENTRY                                        \
+    "	ldr r1, ulCycleCounterConst			\n"                         \
+    "	ldr r1, [r1]						\n"                         \
+    "	ldr r2, ulPendSVEntryCyclesConst	\n"                         \
+    "	str r1, [r2]						\n"
+
+#define portPROFILE_PENDSV_EXIT                                         \
+    "	ldr r1, ulCycleCounterConst			\n"                         \
+    "	ldr r1, [r1]						\n"                         \
+    "	ldr r2, ulPendSVEntryCyclesConst	\n"                         \
+    "	ldr r2, [r2]						\n"                         \
+    "	sub r1, r1, r2						\n" /* Cycles since PendSV entry. */ \
+    "	ldr r2, xContextSwitchProfileConst	\n"                         \
+    "	ldr r3, [r2]						\n" /* ulCount. */          \
+    "	add r3, r3, #1						\n"                         \
+    "	str r3, [r2]						\n"                         \
+    "	str r1, [r2, #4]					\n" /* ulLastCycles. */     \
+    "	ldr r3, [r2, #8]					\n" /* ulMaxCycles. */      \
+    "	cmp r1, r3							\n"                         \
+    "	it hi								\n"                         \
+    "	strhi r1, [r2, #8]					\n"
+
+#define portPROFILE_PENDSV_CONSTS                                       \
+    "ulCycleCounterConst: .word 0xe0001004			\n"                 \
+    "ulPendSVEntryCyclesConst: .word ulPendSVEntryCycles	\n"         \
+    "xContextSwitchProfileConst: .word xPortProfile		\n"
+#else
+#define portPROFILE_PENDSV_ENTRY ""
+#define portPROFILE_PENDSV_EXIT ""
+#define portPROFILE_PENDSV_CONSTS ""
+#endif /* configGENERATE_PORT_PROFILE */
+
+/*
+ * Call vPortPendSVDeferredWork() on entry to the PendSV handler.  EXC_RETURN
+ * is preserved across the call, r0 keeps the stack 8 byte aligned.
+ */
+#if (portPENDSV_DEFERRED_WORK == 1)
+#define portPENDSV_RUN_DEFERRED_WORK                                    \
+    "	push {r0, r14}						\n"                         \
+    "	bl vPortPendSVDeferredWork			\n"                         \
+    "	pop {r0, r14}						\n"
+#else
+#define portPENDSV_RUN_DEFERRED_WORK ""
+#endif /* portPENDSV_DEFERRED_WORK */
+
 /*-----------------------------------------------------------*/
 
 /*
@@ -366,6 +508,25 @@ BaseType_t xPortStartScheduler(void)
      * here already. */
     vPortSetupTimerInterrupt();
 
+#if (configUSE_CYCLE_COUNTER == 1)
+    {
+        /* Start the DWT cycle counter read by portGET_CYCLE_COUNTER().  Trace
+         * must be enabled in the DEMCR before the DWT can be used. */
+        portDEMCR_REG |= portDEMCR_TRCENA_BIT;
+        portDWT_CYCCNT_REG = 0UL;
+        portDWT_CTRL_REG |= portDWT_CTRL_CYCCNTENA_BIT;
+    }
+#endif
+
+#if (configCOPY_OFFLOAD_THRESHOLD > 0)
+    {
+        /* Created before the first task runs so it exists before any copy can
+         * be offloaded. */
+        xCopyOffloadComplete = xSemaphoreCreateBinary();
+        configASSERT(xCopyOffloadComplete);
+    }
+#endif
+
     /* Initialise the critical nesting count ready for the first task. */
     uxCriticalNesting = 0;
 
@@ -385,6 +546,9 @@ BaseType_t xPortStartScheduler(void)
      * vTaskSwitchContext() so link time optimisation does not remove the
      * symbol. */
     vTaskSwitchContext();
+#if (portPENDSV_DEFERRED_WORK == 1)
+    vPortPendSVDeferredWork();
+#endif
     prvTaskExitError();
 
     /* Should not get here! */
@@ -407,6 +571,13 @@ void vPortEnterCritical(void)
     portDISABLE_INTERRUPTS();
     uxCriticalNesting++;
 
+#if (portTIME_CRITICAL_SECTIONS == 1)
+    if (uxCriticalNesting == 1)
+    {
+        ulCriticalSectionEntryCycles = portGET_CYCLE_COUNTER();
+    }
+#endif
+
     /* This is not the interrupt safe version of the enter critical function so
      * assert() if it is being called from an interrupt context.  Only API
      * functions that end in "FromISR" can be used in an interrupt.  Only assert if
@@ -427,17 +598,48 @@ void vPortExitCritical(void)
 
     if (uxCriticalNesting == 0)
     {
+#if (portTIME_CRITICAL_SECTIONS == 1)
+        uint32_t ulCriticalSectionCycles = portGET_CYCLE_COUNTER() - ulCriticalSectionEntryCycles;
+#endif
+
+#if (configGENERATE_PORT_PROFILE == 1)
+        prvRecordPathProfile(&(xPortProfile.xCriticalSection), ulCriticalSectionCycles);
+#endif
+
+#if (configUSE_FLIGHT_RECORDER == 1)
+        vFlightRecorderCriticalSection(ulCriticalSectionCycles);
+#endif
+
         portENABLE_INTERRUPTS();
     }
 }
 
 /*-----------------------------------------------------------*/
 
+#if (portPENDSV_DEFERRED_WORK == 1)
+
+void vPortPendSVDeferredWork(void)
+{
+#if (configUSE_DEFERRED_TICK_PROCESSING == 1)
+    vTaskProcessDeferredTicks();
+#endif
+
+#if (configUSE_SWI == 1)
+    vSwiDispatch();
+#endif
+}
+
+/*-----------------------------------------------------------*/
+
+#endif /* portPENDSV_DEFERRED_WORK */
+
 void xPortPendSVHandler(void)
 {
     /* This is a naked function. */
 
     __asm volatile(
+        portPENDSV_RUN_DEFERRED_WORK
+        portPROFILE_PENDSV_ENTRY
         "	mrs r0, psp							\n"
         "	isb									\n"
         "										\n"
@@ -475,6 +677,7 @@ void xPortPendSVHandler(void)
         "	msr psp, r0							\n"
         "	isb									\n"
         "										\n"
+        portPROFILE_PENDSV_EXIT
 #ifdef WORKAROUND_PMU_CM001 /* XMC4000 specific errata workaround. */
 #if WORKAROUND_PMU_CM001 == 1
         "			push { r14 }				\n"
@@ -485,19 +688,37 @@ void xPortPendSVHandler(void)
         "	bx r14								\n"
         "										\n"
         "	.align 4							\n"
-        "pxCurrentTCBConst: .word pxCurrentTCB	\n" ::"i"(configMAX_SYSCALL_INTERRUPT_PRIORITY));
+        "pxCurrentTCBConst: .word pxCurrentTCB	\n"
+        portPROFILE_PENDSV_CONSTS ::"i"(configMAX_SYSCALL_INTERRUPT_PRIORITY));
 }
 
 /*-----------------------------------------------------------*/
 
 void xPortSysTickHandler(void)
 {
+#if (configGENERATE_PORT_PROFILE == 1)
+    uint32_t ulTickEntryCycles = portGET_CYCLE_COUNTER();
+#endif
+
     /* The SysTick runs at the lowest interrupt priority, so when this interrupt
      * executes all interrupts must be unmasked.  There is therefore no need to
      * save and then restore the interrupt mask value as its value is already
      * known. */
     portDISABLE_INTERRUPTS();
     {
+#if (configUSE_DEFERRED_TICK_PROCESSING == 1)
+        /* Only count the tick.  The delayed lists are processed by the PendSV
+         * handler, with interrupts enabled between batches of unblocked tasks,
+         * before it switches context. */
+        vTaskDeferTickFromISR();
+        portNVIC_INT_CTRL_REG = portNVIC_PENDSVSET_BIT;
+#else
+#if (configUSE_ADAPTIVE_TICK == 1)
+        /* If the tick was deferred, count the tick periods that passed before
+         * this one. */
+        vTaskExitAdaptiveTick();
+#endif
+
         /* Increment the RTOS tick. */
         if (xTaskIncrementTick() != pdFALSE)
         {
@@ -505,12 +726,63 @@ void xPortSysTickHandler(void)
              * the PendSV interrupt.  Pend the PendSV interrupt. */
             portNVIC_INT_CTRL_REG = portNVIC_PENDSVSET_BIT;
         }
+#if (configUSE_ADAPTIVE_TICK == 1)
+        else
+        {
+            /* Defer the next tick if nothing can happen on it. */
+            vTaskEnterAdaptiveTick();
+        }
+#endif
+#endif
+
+#if (configGENERATE_PORT_PROFILE == 1)
+        prvRecordPathProfile(&(xPortProfile.xTick), portGET_CYCLE_COUNTER() - ulTickEntryCycles);
+#endif
     }
     portENABLE_INTERRUPTS();
 }
 
 /*-----------------------------------------------------------*/
 
+#if ((configUSE_TICKLESS_IDLE == 1) || (configUSE_ADAPTIVE_TICK == 1))
+
+static void prvRestartTickPeriod(void)
+{
+    /* Restart SysTick so it runs from portNVIC_SYSTICK_LOAD_REG again,
+     * then set portNVIC_SYSTICK_LOAD_REG back to its standard value.  If
+     * the SysTick is not using the core clock, temporarily configure it to
+     * use the core clock.  This configuration forces the SysTick to load
+     * from portNVIC_SYSTICK_LOAD_REG immediately instead of at the next
+     * cycle of the other clock.  Then portNVIC_SYSTICK_LOAD_REG is ready
+     * to receive the standard value immediately. */
+    portNVIC_SYSTICK_CURRENT_VALUE_REG = 0UL;
+    portNVIC_SYSTICK_CTRL_REG = portNVIC_SYSTICK_CLK_BIT | portNVIC_SYSTICK_INT_BIT | portNVIC_SYSTICK_ENABLE_BIT;
+#if (portNVIC_SYSTICK_CLK_BIT_CONFIG == portNVIC_SYSTICK_CLK_BIT)
+    {
+        portNVIC_SYSTICK_LOAD_REG = ulTimerCountsForOneTick - 1UL;
+    }
+#else
+    {
+        /* The temporary usage of the core clock has served its purpose,
+         * as described above.  Resume usage of the other clock. */
+        portNVIC_SYSTICK_CTRL_REG = portNVIC_SYSTICK_CLK_BIT | portNVIC_SYSTICK_INT_BIT;
+
+        if ((portNVIC_SYSTICK_CTRL_REG & portNVIC_SYSTICK_COUNT_FLAG_BIT) != 0)
+        {
+            /* The partial tick period already ended.  Be sure the SysTick
+             * counts it only once. */
+            portNVIC_SYSTICK_CURRENT_VALUE_REG = 0;
+        }
+
+        portNVIC_SYSTICK_LOAD_REG = ulTimerCountsForOneTick - 1UL;
+        portNVIC_SYSTICK_CTRL_REG = portNVIC_SYSTICK_CLK_BIT_CONFIG | portNVIC_SYSTICK_INT_BIT | portNVIC_SYSTICK_ENABLE_BIT;
+    }
+#endif /* portNVIC_SYSTICK_CLK_BIT_CONFIG */
+}
+
+#endif /* configUSE_TICKLESS_IDLE || configUSE_ADAPTIVE_TICK */
+/*-----------------------------------------------------------*/
+
 #if (configUSE_TICKLESS_IDLE == 1)
 
 __attribute__((weak)) void vPortSuppressTicksAndSleep(TickType_t xExpectedIdleTime)
@@ -690,46 +962,142 @@ __attribute__((weak)) void vPortSuppressTicksAndSleep(TickType_t xExpectedIdleTi
             portNVIC_SYSTICK_LOAD_REG = ((ulCompleteTickPeriods + 1UL) * ulTimerCountsForOneTick) - ulCompletedSysTickDecrements;
         }
 
-        /* Restart SysTick so it runs from portNVIC_SYSTICK_LOAD_REG again,
-         * then set portNVIC_SYSTICK_LOAD_REG back to its standard value.  If
-         * the SysTick is not using the core clock, temporarily configure it to
-         * use the core clock.  This configuration forces the SysTick to load
-         * from portNVIC_SYSTICK_LOAD_REG immediately instead of at the next
-         * cycle of the other clock.  Then portNVIC_SYSTICK_LOAD_REG is ready
-         * to receive the standard value immediately. */
-        portNVIC_SYSTICK_CURRENT_VALUE_REG = 0UL;
-        portNVIC_SYSTICK_CTRL_REG = portNVIC_SYSTICK_CLK_BIT | portNVIC_SYSTICK_INT_BIT | portNVIC_SYSTICK_ENABLE_BIT;
-#if (portNVIC_SYSTICK_CLK_BIT_CONFIG == portNVIC_SYSTICK_CLK_BIT)
+        /* Restart SysTick so it runs from portNVIC_SYSTICK_LOAD_REG again. */
+        prvRestartTickPeriod();
+
+        /* Step the tick to account for any tick periods that elapsed. */
+        vTaskStepTick(ulCompleteTickPeriods);
+
+        /* Exit with interrupts enabled. */
+        __asm volatile("cpsie i" ::: "memory");
+    }
+}
+
+#endif /* #if configUSE_TICKLESS_IDLE */
+/*-----------------------------------------------------------*/
+
+#if (configUSE_ADAPTIVE_TICK == 1)
+
+TickType_t xPortAdaptiveTickStart(TickType_t xExpectedTicks)
+{
+    uint32_t ulSysTickDecrementsLeft;
+
+    /* Called from the tick interrupt with interrupts masked.  Make sure the
+     * SysTick reload value does not overflow the counter. */
+    if (xExpectedTicks > xMaximumPossibleSuppressedTicks)
+    {
+        xExpectedTicks = xMaximumPossibleSuppressedTicks;
+    }
+
+    /* If the next tick is already pending it cannot be deferred. */
+    if ((xExpectedTicks < 2) || ((portNVIC_INT_CTRL_REG & portNVIC_PEND_SYSTICK_SET_BIT) != 0))
+    {
+        return 0;
+    }
+
+    /* Stop the SysTick momentarily and program it to expire at the end of
+     * the last deferred tick period, exactly as vPortSuppressTicksAndSleep()
+     * does for the expected idle time. */
+    portNVIC_SYSTICK_CTRL_REG = (portNVIC_SYSTICK_CLK_BIT_CONFIG | portNVIC_SYSTICK_INT_BIT);
+
+    ulSysTickDecrementsLeft = portNVIC_SYSTICK_CURRENT_VALUE_REG;
+
+    if (ulSysTickDecrementsLeft == 0)
+    {
+        ulSysTickDecrementsLeft = ulTimerCountsForOneTick;
+    }
+
+    ulAdaptiveReloadValue = ulSysTickDecrementsLeft + (ulTimerCountsForOneTick * (xExpectedTicks - 1UL));
+
+    if (ulAdaptiveReloadValue > ulStoppedTimerCompensation)
+    {
+        ulAdaptiveReloadValue -= ulStoppedTimerCompensation;
+    }
+
+    portNVIC_SYSTICK_LOAD_REG = ulAdaptiveReloadValue;
+    portNVIC_SYSTICK_CURRENT_VALUE_REG = 0UL;
+    portNVIC_SYSTICK_CTRL_REG |= portNVIC_SYSTICK_ENABLE_BIT;
+
+    xAdaptiveTicks = xExpectedTicks;
+
+    return xExpectedTicks;
+}
+
+/*-----------------------------------------------------------*/
+
+TickType_t xPortAdaptiveTickStop(void)
+{
+    uint32_t ulCalculatedLoadValue, ulCompletedSysTickDecrements, ulSysTickDecrementsLeft;
+    TickType_t xCompleteTickPeriods;
+
+    /* Called with interrupts masked.  Stop the SysTick without reading
+     * portNVIC_SYSTICK_CTRL_REG, so the count flag is not cleared if it is
+     * set. */
+    portNVIC_SYSTICK_CTRL_REG = (portNVIC_SYSTICK_CLK_BIT_CONFIG | portNVIC_SYSTICK_INT_BIT);
+
+    if ((portNVIC_SYSTICK_CTRL_REG & portNVIC_SYSTICK_COUNT_FLAG_BIT) != 0)
+    {
+        /* The deadline has passed.  Its tick interrupt is either pending or
+         * is the caller, and counts the last period itself.  Reload with
+         * whatever remains of the tick period that has started. */
+        ulCalculatedLoadValue = (ulTimerCountsForOneTick - 1UL) - (ulAdaptiveReloadValue - portNVIC_SYSTICK_CURRENT_VALUE_REG);
+
+        if ((ulCalculatedLoadValue <= ulStoppedTimerCompensation) || (ulCalculatedLoadValue > ulTimerCountsForOneTick))
         {
-            portNVIC_SYSTICK_LOAD_REG = ulTimerCountsForOneTick - 1UL;
+            ulCalculatedLoadValue = (ulTimerCountsForOneTick - 1UL);
         }
-#else
-        {
-            /* The temporary usage of the core clock has served its purpose,
-             * as described above.  Resume usage of the other clock. */
-            portNVIC_SYSTICK_CTRL_REG = portNVIC_SYSTICK_CLK_BIT | portNVIC_SYSTICK_INT_BIT;
 
-            if ((portNVIC_SYSTICK_CTRL_REG & portNVIC_SYSTICK_COUNT_FLAG_BIT) != 0)
+        portNVIC_SYSTICK_LOAD_REG = ulCalculatedLoadValue;
+        xCompleteTickPeriods = xAdaptiveTicks - 1UL;
+    }
+    else
+    {
+        /* Ended early.  Count the complete tick periods and reload with the
+         * fraction of the current one that remains. */
+        ulSysTickDecrementsLeft = portNVIC_SYSTICK_CURRENT_VALUE_REG;
+#if (portNVIC_SYSTICK_CLK_BIT_CONFIG != portNVIC_SYSTICK_CLK_BIT)
+        {
+            /* See vPortSuppressTicksAndSleep(). */
+            if (ulSysTickDecrementsLeft == 0)
             {
-                /* The partial tick period already ended.  Be sure the SysTick
-                 * counts it only once. */
-                portNVIC_SYSTICK_CURRENT_VALUE_REG = 0;
+                ulSysTickDecrementsLeft = ulAdaptiveReloadValue;
             }
-
-            portNVIC_SYSTICK_LOAD_REG = ulTimerCountsForOneTick - 1UL;
-            portNVIC_SYSTICK_CTRL_REG = portNVIC_SYSTICK_CLK_BIT_CONFIG | portNVIC_SYSTICK_INT_BIT | portNVIC_SYSTICK_ENABLE_BIT;
         }
 #endif /* portNVIC_SYSTICK_CLK_BIT_CONFIG */
 
-        /* Step the tick to account for any tick periods that elapsed. */
-        vTaskStepTick(ulCompleteTickPeriods);
+        ulCompletedSysTickDecrements = (xAdaptiveTicks * ulTimerCountsForOneTick) - ulSysTickDecrementsLeft;
+        xCompleteTickPeriods = ulCompletedSysTickDecrements / ulTimerCountsForOneTick;
+        portNVIC_SYSTICK_LOAD_REG = ((xCompleteTickPeriods + 1UL) * ulTimerCountsForOneTick) - ulCompletedSysTickDecrements;
+    }
 
-        /* Exit with interrupts enabled. */
-        __asm volatile("cpsie i" ::: "memory");
+    prvRestartTickPeriod();
+
+    return xCompleteTickPeriods;
+}
+
+/*-----------------------------------------------------------*/
+
+TickType_t xPortAdaptiveTickElapsed(void)
+{
+    TickType_t xCompleteTickPeriods;
+
+    /* Called with interrupts masked.  The count flag is left for
+     * xPortAdaptiveTickStop(), so a pending tick interrupt is what shows the
+     * deadline has passed. */
+    if ((portNVIC_INT_CTRL_REG & portNVIC_PEND_SYSTICK_SET_BIT) != 0)
+    {
+        xCompleteTickPeriods = xAdaptiveTicks - 1UL;
     }
+    else
+    {
+        xCompleteTickPeriods =
+            ((xAdaptiveTicks * ulTimerCountsForOneTick) - portNVIC_SYSTICK_CURRENT_VALUE_REG) / ulTimerCountsForOneTick;
+    }
+
+    return xCompleteTickPeriods;
 }
 
-#endif /* #if configUSE_TICKLESS_IDLE */
+#endif /* configUSE_ADAPTIVE_TICK */
 /*-----------------------------------------------------------*/
 
 /*
@@ -739,13 +1107,13 @@ __attribute__((weak)) void vPortSuppressTicksAndSleep(TickType_t xExpectedIdleTi
 __attribute__((weak)) void vPortSetupTimerInterrupt(void)
 {
 /* Calculate the constants required to configure the tick interrupt. */
-#if (configUSE_TICKLESS_IDLE == 1)
+#if ((configUSE_TICKLESS_IDLE == 1) || (configUSE_ADAPTIVE_TICK == 1))
     {
         ulTimerCountsForOneTick = (configSYSTICK_CLOCK_HZ / configTICK_RATE_HZ);
         xMaximumPossibleSuppressedTicks = portMAX_24_BIT_NUMBER / ulTimerCountsForOneTick;
         ulStoppedTimerCompensation = portMISSED_COUNTS_FACTOR / (configCPU_CLOCK_HZ / configSYSTICK_CLOCK_HZ);
     }
-#endif /* configUSE_TICKLESS_IDLE */
+#endif /* configUSE_TICKLESS_IDLE || configUSE_ADAPTIVE_TICK */
 
     /* Stop and clear the SysTick. */
     portNVIC_SYSTICK_CTRL_REG = 0UL;
@@ -832,3 +1200,299 @@ void vPortValidateInterruptPriority(void)
 }
 
 #endif /* configASSERT_DEFINED */
+
+#if (configUSE_PORT_OPTIMISED_COPY == 1)
+
+/* The loops below must not be turned back into calls to memcpy() and memset()
+ * by the compiler. */
+__attribute__((optimize("no-tree-loop-distribute-patterns"))) void vPortMemcpy(void *pvDestination,
+                                                                                const void *pvSource,
+                                                                                size_t xBytes)
+{
+    uint8_t *pucDestination = (uint8_t *)pvDestination;
+    const uint8_t *pucSource = (const uint8_t *)pvSource;
+    uint64_t ullA, ullB, ullC, ullD;
+
+    portRECORD_COPY(xBytes);
+
+    if ((((uint32_t)pucDestination | (uint32_t)pucSource) & 3UL) == 0UL)
+    {
+        /* Move 32 bytes, one cache line, per iteration.  All four loads are
+         * issued before the stores so the loads can be dual issued. */
+        while (xBytes >= 32U)
+        {
+            ullA = ((const portALIGNED_DOUBLE_WORD *)pucSource)[0];
+            ullB = ((const portALIGNED_DOUBLE_WORD *)pucSource)[1];
+            ullC = ((const portALIGNED_DOUBLE_WORD *)pucSource)[2];
+            ullD = ((const portALIGNED_DOUBLE_WORD *)pucSource)[3];
+            ((portALIGNED_DOUBLE_WORD *)pucDestination)[0] = ullA;
+            ((portALIGNED_DOUBLE_WORD *)pucDestination)[1] = ullB;
+            ((portALIGNED_DOUBLE_WORD *)pucDestination)[2] = ullC;
+            ((portALIGNED_DOUBLE_WORD *)pucDestination)[3] = ullD;
+
+            pucSource += 32U;
+            pucDestination += 32U;
+            xBytes -= 32U;
+        }
+
+        while (xBytes >= 8U)
+        {
+            *((portALIGNED_DOUBLE_WORD *)pucDestination) = *((const portALIGNED_DOUBLE_WORD *)pucSource);
+
+            pucSource += 8U;
+            pucDestination += 8U;
+            xBytes -= 8U;
+        }
+    }
+
+    while (xBytes >= 4U)
+    {
+        *((portUNALIGNED_WORD *)pucDestination) = *((const portUNALIGNED_WORD *)pucSource);
+
+        pucSource += 4U;
+        pucDestination += 4U;
+        xBytes -= 4U;
+    }
+
+    while (xBytes > 0U)
+    {
+        *pucDestination = *pucSource;
+
+        pucSource++;
+        pucDestination++;
+        xBytes--;
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+__attribute__((optimize("no-tree-loop-distribute-patterns"))) void vPortMemset(void *pvDestination,
+                                                                                int iValue,
+                                                                                size_t xBytes)
+{
+    uint8_t *pucDestination = (uint8_t *)pvDestination;
+    uint32_t ulPattern = ((uint32_t)iValue & 0xffUL) * 0x01010101UL;
+    uint64_t ullPattern = ((uint64_t)ulPattern << 32U) | ulPattern;
+
+    portRECORD_COPY(xBytes);
+
+    /* Fill single bytes until the destination is word aligned. */
+    while ((xBytes > 0U) && (((uint32_t)pucDestination & 3UL) != 0UL))
+    {
+        *pucDestination = (uint8_t)ulPattern;
+
+        pucDestination++;
+        xBytes--;
+    }
+
+    while (xBytes >= 32U)
+    {
+        ((portALIGNED_DOUBLE_WORD *)pucDestination)[0] = ullPattern;
+        ((portALIGNED_DOUBLE_WORD *)pucDestination)[1] = ullPattern;
+        ((portALIGNED_DOUBLE_WORD *)pucDestination)[2] = ullPattern;
+        ((portALIGNED_DOUBLE_WORD *)pucDestination)[3] = ullPattern;
+
+        pucDestination += 32U;
+        xBytes -= 32U;
+    }
+
+    while (xBytes >= 4U)
+    {
+        *((portALIGNED_WORD *)pucDestination) = ulPattern;
+
+        pucDestination += 4U;
+        xBytes -= 4U;
+    }
+
+    while (xBytes > 0U)
+    {
+        *pucDestination = (uint8_t)ulPattern;
+
+        pucDestination++;
+        xBytes--;
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+void vPortMemcpyDeferrable(void *pvDestination, const void *pvSource, size_t xBytes)
+{
+#if (configCOPY_OFFLOAD_THRESHOLD > 0)
+    BaseType_t xOffload = pdFALSE;
+
+    /* Only a task can block waiting for the transfer, and then only while the
+     * scheduler is running and the task is not in a critical section. */
+    if ((xBytes >= (size_t)configCOPY_OFFLOAD_THRESHOLD) &&
+        (xPortIsInsideInterrupt() == pdFALSE) &&
+        (xTaskGetSchedulerState() == taskSCHEDULER_RUNNING) &&
+        (uxCriticalNesting == 0))
+    {
+        taskENTER_CRITICAL();
+        {
+            if (xCopyOffloadInProgress == pdFALSE)
+            {
+                xCopyOffloadInProgress = pdTRUE;
+                xOffload = pdTRUE;
+            }
+        }
+        taskEXIT_CRITICAL();
+    }
+
+    if (xOffload != pdFALSE)
+    {
+        if (xPortCopyOffloadStart(pvDestination, pvSource, xBytes) != pdFALSE)
+        {
+            (void)xSemaphoreTake(xCopyOffloadComplete, portMAX_DELAY);
+
+#if (configGENERATE_COPY_STATS == 1)
+            {
+                portRECORD_COPY(xBytes);
+
+                taskENTER_CRITICAL();
+                xCopyStats.ulOffloaded++;
+                taskEXIT_CRITICAL();
+            }
+#endif
+        }
+        else
+        {
+            /* The engine is not available, so the CPU makes the copy. */
+            xOffload = pdFALSE;
+        }
+
+        xCopyOffloadInProgress = pdFALSE;
+    }
+
+    if (xOffload == pdFALSE)
+#endif /* configCOPY_OFFLOAD_THRESHOLD */
+    {
+        vPortMemcpy(pvDestination, pvSource, xBytes);
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Default implementation, which never offloads a copy.  The application
+ * provides its own definition to use a DMA engine.
+ */
+__attribute__((weak)) BaseType_t xPortCopyOffloadStart(void *pvDestination, const void *pvSource, size_t xBytes)
+{
+    (void)pvDestination;
+    (void)pvSource;
+    (void)xBytes;
+
+    return pdFALSE;
+}
+
+/*-----------------------------------------------------------*/
+
+void vPortCopyOffloadCompleteFromISR(BaseType_t *pxHigherPriorityTaskWoken)
+{
+#if (configCOPY_OFFLOAD_THRESHOLD > 0)
+    (void)xSemaphoreGiveFromISR(xCopyOffloadComplete, pxHigherPriorityTaskWoken);
+#else
+    (void)pxHigherPriorityTaskWoken;
+#endif
+}
+
+#endif /* configUSE_PORT_OPTIMISED_COPY */
+/*-----------------------------------------------------------*/
+
+#if (configGENERATE_COPY_STATS == 1)
+
+static void prvRecordCopy(size_t xBytes)
+{
+    static const size_t xBucketLimits[portCOPY_STATS_BUCKETS - 1] = {8U, 32U, 128U, 512U, 2048U};
+    UBaseType_t uxBucket = 0;
+    UBaseType_t uxSavedInterruptStatus;
+
+    while ((uxBucket < (UBaseType_t)(portCOPY_STATS_BUCKETS - 1)) && (xBytes > xBucketLimits[uxBucket]))
+    {
+        uxBucket++;
+    }
+
+    uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+    {
+        xCopyStats.ulCopies[uxBucket]++;
+        xCopyStats.ullBytes[uxBucket] += (uint64_t)xBytes;
+    }
+    portCLEAR_INTERRUPT_MASK_FROM_ISR(uxSavedInterruptStatus);
+}
+
+/*-----------------------------------------------------------*/
+
+void vPortGetCopyStats(PortCopyStats_t *pxCopyStats)
+{
+    UBaseType_t uxSavedInterruptStatus;
+
+    configASSERT(pxCopyStats);
+
+    uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+    {
+        *pxCopyStats = xCopyStats;
+    }
+    portCLEAR_INTERRUPT_MASK_FROM_ISR(uxSavedInterruptStatus);
+}
+
+/*-----------------------------------------------------------*/
+
+void vPortResetCopyStats(void)
+{
+    static const PortCopyStats_t xClearedCopyStats = {0};
+    UBaseType_t uxSavedInterruptStatus;
+
+    uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+    {
+        xCopyStats = xClearedCopyStats;
+    }
+    portCLEAR_INTERRUPT_MASK_FROM_ISR(uxSavedInterruptStatus);
+}
+
+#endif /* configGENERATE_COPY_STATS */
+/*-----------------------------------------------------------*/
+
+#if (configGENERATE_PORT_PROFILE == 1)
+
+/* Called with interrupts masked. */
+static void prvRecordPathProfile(PortPathProfile_t *pxPath, uint32_t ulCycles)
+{
+    pxPath->ulCount++;
+    pxPath->ulLastCycles = ulCycles;
+
+    if (ulCycles > pxPath->ulMaxCycles)
+    {
+        pxPath->ulMaxCycles = ulCycles;
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+void vPortGetProfile(PortProfile_t *pxProfile)
+{
+    UBaseType_t uxSavedInterruptStatus;
+
+    configASSERT(pxProfile);
+
+    uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+    {
+        *pxProfile = xPortProfile;
+    }
+    portCLEAR_INTERRUPT_MASK_FROM_ISR(uxSavedInterruptStatus);
+}
+
+/*-----------------------------------------------------------*/
+
+void vPortResetProfile(void)
+{
+    static const PortProfile_t xClearedProfile = {0};
+    UBaseType_t uxSavedInterruptStatus;
+
+    uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+    {
+        xPortProfile = xClearedProfile;
+    }
+    portCLEAR_INTERRUPT_MASK_FROM_ISR(uxSavedInterruptStatus);
+}
+
+#endif /* configGENERATE_PORT_PROFILE */
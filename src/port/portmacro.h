@@ -121,6 +121,15 @@
     #endif
 /*-----------------------------------------------------------*/
 
+/* Adaptive tick functionality, used when configUSE_ADAPTIVE_TICK is 1. */
+    extern TickType_t xPortAdaptiveTickStart( TickType_t xExpectedTicks );
+    extern TickType_t xPortAdaptiveTickStop( void );
+    extern TickType_t xPortAdaptiveTickElapsed( void );
+    #define portADAPTIVE_TICK_START( xExpectedTicks )    xPortAdaptiveTickStart( xExpectedTicks )
+    #define portADAPTIVE_TICK_STOP()                     xPortAdaptiveTickStop()
+    #define portADAPTIVE_TICK_ELAPSED()                  xPortAdaptiveTickElapsed()
+/*-----------------------------------------------------------*/
+
 /* Architecture specific optimisations. */
     #ifndef configUSE_PORT_OPTIMISED_TASK_SELECTION
         #define configUSE_PORT_OPTIMISED_TASK_SELECTION    1
@@ -241,6 +250,89 @@
 /*-----------------------------------------------------------*/
 
     #define portMEMORY_BARRIER()    __asm volatile ( "" ::: "memory" )
+/*-----------------------------------------------------------*/
+
+/* The DWT cycle counter.  xPortStartScheduler() starts the counter when
+ * configUSE_CYCLE_COUNTER is 1.  It is 32 bits wide and counts core clock
+ * cycles, so differences between two reads are correct across one wrap. */
+    #define portDWT_CYCCNT_REG         ( *( ( volatile uint32_t * ) 0xe0001004 ) )
+    #define portGET_CYCLE_COUNTER()    ( portDWT_CYCCNT_REG )
+
+/*-----------------------------------------------------------*/
+
+/* Copy and fill routines tuned for the Cortex-M7, used by the kernel in place
+ * of memcpy() and memset() when configUSE_PORT_OPTIMISED_COPY is 1.  Word
+ * aligned buffers are moved with unrolled LDRD/STRD sequences.
+ *
+ * When configCOPY_OFFLOAD_THRESHOLD is greater than 0, deferrable copies of at
+ * least that many bytes are passed to xPortCopyOffloadStart(), which the
+ * application provides to start a DMA (for example MDMA) transfer.  The calling
+ * task then blocks until the application calls
+ * vPortCopyOffloadCompleteFromISR() from the transfer complete interrupt.
+ * xPortCopyOffloadStart() is responsible for any cache maintenance the
+ * transfer needs, and returns pdFALSE if the copy cannot be offloaded, in which
+ * case the CPU makes the copy. */
+    #if ( configUSE_PORT_OPTIMISED_COPY == 1 )
+        void vPortMemcpy( void * pvDestination,
+                          const void * pvSource,
+                          size_t xBytes );
+        void vPortMemset( void * pvDestination,
+                          int iValue,
+                          size_t xBytes );
+        void vPortMemcpyDeferrable( void * pvDestination,
+                                    const void * pvSource,
+                                    size_t xBytes );
+        BaseType_t xPortCopyOffloadStart( void * pvDestination,
+                                          const void * pvSource,
+                                          size_t xBytes );
+        void vPortCopyOffloadCompleteFromISR( BaseType_t * pxHigherPriorityTaskWoken );
+
+        #define portMEMCPY( pvDestination, pvSource, xBytes )               vPortMemcpy( ( pvDestination ), ( pvSource ), ( xBytes ) )
+        #define portMEMSET( pvDestination, iValue, xBytes )                 vPortMemset( ( pvDestination ), ( iValue ), ( xBytes ) )
+        #define portMEMCPY_DEFERRABLE( pvDestination, pvSource, xBytes )    vPortMemcpyDeferrable( ( pvDestination ), ( pvSource ), ( xBytes ) )
+    #endif
+
+/* Copy statistics, collected when configGENERATE_COPY_STATS is 1.  Copies and
+ * fills are counted in buckets by length: up to 8, 32, 128, 512 and 2048
+ * bytes, and longer. */
+    #if ( configGENERATE_COPY_STATS == 1 )
+        #define portCOPY_STATS_BUCKETS    6
+
+        typedef struct xPORT_COPY_STATS
+        {
+            uint32_t ulCopies[ portCOPY_STATS_BUCKETS ]; /*< Number of copies and fills in each length bucket. */
+            uint64_t ullBytes[ portCOPY_STATS_BUCKETS ]; /*< Number of bytes copied or filled in each length bucket. */
+            uint32_t ulOffloaded;                        /*< Number of copies completed by xPortCopyOffloadStart(). */
+        } PortCopyStats_t;
+
+        void vPortGetCopyStats( PortCopyStats_t * pxCopyStats );
+        void vPortResetCopyStats( void );
+    #endif
+
+/* Execution profile of the port's hot paths, collected with the DWT cycle
+ * counter when configGENERATE_PORT_PROFILE is 1.  The context switch is timed
+ * from PendSV entry to exception return, a critical section from the outermost
+ * portENTER_CRITICAL() to the matching portEXIT_CRITICAL(), and the tick from
+ * SysTick entry to exit.  Critical sections entered from interrupts are not
+ * timed. */
+    #if ( configGENERATE_PORT_PROFILE == 1 )
+        typedef struct xPORT_PATH_PROFILE
+        {
+            uint32_t ulCount;      /*< Number of times the path executed. */
+            uint32_t ulLastCycles; /*< Cycles taken by the most recent execution. */
+            uint32_t ulMaxCycles;  /*< Most cycles taken by any execution. */
+        } PortPathProfile_t;
+
+        typedef struct xPORT_PROFILE
+        {
+            PortPathProfile_t xContextSwitch; /* Must be first, the PendSV handler relies on its offset. */
+            PortPathProfile_t xCriticalSection;
+            PortPathProfile_t xTick;
+        } PortProfile_t;
+
+        void vPortGetProfile( PortProfile_t * pxProfile );
+        void vPortResetProfile( void );
+    #endif
 
     #ifdef __cplusplus
         }
@@ -180,6 +180,20 @@ void vPortInitialiseBlocks( void ) PRIVILEGED_FUNCTION;
 size_t xPortGetFreeHeapSize( void ) PRIVILEGED_FUNCTION;
 size_t xPortGetMinimumEverFreeHeapSize( void ) PRIVILEGED_FUNCTION;
 
+#if ( configUSE_HEAP_DEFERRED_FREE == 1 )
+
+/*
+ * vPortFreeFromISR() can be called from an interrupt to free a block allocated
+ * with pvPortMalloc().  The block is pushed onto a lock-free list and returned
+ * to the heap by the next pvPortMalloc() or vPortFree() call, or by the idle
+ * task calling vPortFreeDeferredBlocks().  xPortGetDeferredFreeBytes() returns
+ * the number of bytes freed this way that have not been returned yet.
+ */
+    void vPortFreeFromISR( void * pv ) PRIVILEGED_FUNCTION;
+    void vPortFreeDeferredBlocks( void ) PRIVILEGED_FUNCTION;
+    size_t xPortGetDeferredFreeBytes( void ) PRIVILEGED_FUNCTION;
+#endif
+
 #if ( configSTACK_ALLOCATION_FROM_SEPARATE_HEAP == 1 )
     void * pvPortMallocStack( size_t xSize ) PRIVILEGED_FUNCTION;
     void vPortFreeStack( void * pv ) PRIVILEGED_FUNCTION;
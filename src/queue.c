@@ -92,6 +92,45 @@ typedef struct SemaphoreData
     #define queueYIELD_IF_USING_PREEMPTION()    portYIELD_WITHIN_API()
 #endif
 
+#if ( configUSE_QUEUE_POW2_STORAGE == 1 )
+
+/* Prototype of the routines used to copy a single item into or out of a
+ * queue's storage area. */
+    typedef void (* QueueCopyItemFunction_t)( void * pvDestination,
+                                              const void * pvSource,
+                                              size_t xItemSize );
+
+/* Returns the position in the storage area of a queue that uses masked
+ * indexing that is xOffset bytes on from pcPosition.  xOffset can be the
+ * two's complement of the item size to step backwards. */
+    #define prvMaskedQueuePosition( pxQueue, pcPosition, xOffset ) \
+    ( ( pxQueue )->pcHead + ( ( ( size_t ) ( ( pcPosition ) - ( pxQueue )->pcHead ) + ( size_t ) ( xOffset ) ) & ( pxQueue )->xStorageMask ) )
+#endif
+
+#if ( configUSE_QUEUE_ELASTIC == 1 )
+
+/* Overflow segment borrowed by an elastic queue from the shared pool while
+ * its inline storage is full. */
+    typedef struct QueueSegment
+    {
+        struct QueueSegment * pxNext;                          /*< The next (newer) segment of the queue that borrowed this one, or the next free segment while in the pool. */
+        uint8_t ucStorage[ configQUEUE_ELASTIC_SEGMENT_SIZE ]; /*< Item storage. */
+    } QueueSegment_t;
+
+/* Items are copied into and out of overflow segments with the same routine as
+ * the inline storage. */
+    #if ( configUSE_QUEUE_POW2_STORAGE == 1 )
+        #define prvCopyOverflowItem( pxQueue, pvDestination, pvSource )    ( pxQueue )->pxCopyItem( ( pvDestination ), ( pvSource ), ( size_t ) ( pxQueue )->uxItemSize )
+    #else
+        #define prvCopyOverflowItem( pxQueue, pvDestination, pvSource )    portMEMCPY( ( pvDestination ), ( pvSource ), ( size_t ) ( pxQueue )->uxItemSize )
+    #endif
+
+/* Number of items held by the inline storage area. */
+    #define queueINLINE_LENGTH( pxQueue )    ( ( pxQueue )->uxInlineLength )
+#else
+    #define queueINLINE_LENGTH( pxQueue )    ( ( pxQueue )->uxLength )
+#endif /* configUSE_QUEUE_ELASTIC */
+
 /*
  * Definition of the queue used by the scheduler.
  * Items are queued by copy, not reference.  See the following link for the
@@ -130,12 +169,38 @@ typedef struct QueueDefinition /* The old naming convention is used to prevent b
         UBaseType_t uxQueueNumber;
         uint8_t ucQueueType;
     #endif
+
+    #if ( configUSE_QUEUE_POW2_STORAGE == 1 )
+        size_t xStorageMask;                /*< The size of the storage area in bytes minus one if that size is a power of two, in which case read and write positions wrap by masking.  Otherwise 0, and positions wrap by comparing against pcTail. */
+        QueueCopyItemFunction_t pxCopyItem; /*< Copies one item into or out of the storage area.  Selected for uxItemSize when the queue is created. */
+    #endif
+
+    #if ( configUSE_QUEUE_ELASTIC == 1 )
+        UBaseType_t uxInlineLength;       /*< The number of items the inline storage area holds.  Less than uxLength only for an elastic queue, in which case items beyond this are held in overflow segments. */
+        QueueSegment_t * pxOverflowHead;  /*< The oldest borrowed overflow segment, or NULL if none are borrowed. */
+        QueueSegment_t * pxOverflowTail;  /*< The newest borrowed overflow segment, or NULL if none are borrowed. */
+        UBaseType_t uxOverflowReadIndex;  /*< Index of the oldest item in pxOverflowHead. */
+        UBaseType_t uxOverflowWriteIndex; /*< Index of the next free item in pxOverflowTail. */
+        UBaseType_t uxItemsPerSegment;    /*< The number of items one overflow segment holds. */
+        UBaseType_t uxGrowCount;          /*< The number of times an overflow segment has been borrowed. */
+        struct QueueDefinition * pxNextPoolWaiter; /*< The next queue in the list of elastic queues with senders blocked because the shared pool was exhausted. */
+        uint8_t ucWaitingOnPool;                   /*< pdTRUE while the queue is in that list. */
+    #endif
 } xQUEUE;
 
 /* The old xQUEUE name is maintained above then typedefed to the new Queue_t
  * name below to enable the use of older kernel aware debuggers. */
 typedef xQUEUE Queue_t;
 
+#if ( configUSE_INLINE_KERNEL_QUERIES == 1 )
+
+/* kernel_inline.h reads these members through the layout of StaticQueue_t.
+ * Each typedef has a negative array size, so fails to compile, if a member
+ * does not line up. */
+    typedef char queueMESSAGES_WAITING_MATCHES_STATIC_QUEUE[ ( offsetof( Queue_t, uxMessagesWaiting ) == offsetof( StaticQueue_t, uxDummy4[ 0 ] ) ) ? 1 : -1 ];
+    typedef char queueLENGTH_MATCHES_STATIC_QUEUE[ ( offsetof( Queue_t, uxLength ) == offsetof( StaticQueue_t, uxDummy4[ 1 ] ) ) ? 1 : -1 ];
+#endif
+
 /*-----------------------------------------------------------*/
 
 /*
@@ -183,11 +248,13 @@ static void prvUnlockQueue( Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
 static BaseType_t prvIsQueueEmpty( const Queue_t * pxQueue ) PRIVILEGED_FUNCTION;
 
 /*
- * Uses a critical section to determine if there is any space in a queue.
+ * Uses a critical section to determine if there is any space in a queue for
+ * an item sent to xPosition.
  *
  * @return pdTRUE if there is no space, otherwise pdFALSE;
  */
-static BaseType_t prvIsQueueFull( const Queue_t * pxQueue ) PRIVILEGED_FUNCTION;
+static BaseType_t prvIsQueueFull( Queue_t * const pxQueue,
+                                  const BaseType_t xPosition ) PRIVILEGED_FUNCTION;
 
 /*
  * Copies an item into the queue, either at the front of the queue or the
@@ -242,6 +309,135 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength,
  */
     static UBaseType_t prvGetDisinheritPriorityAfterTimeout( const Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
 #endif
+
+#if ( configUSE_QUEUE_POW2_STORAGE == 1 )
+
+/*
+ * Copy routines for the common item sizes.  Each copies a fixed number of
+ * bytes so the compiler can expand the copy into register loads and stores
+ * instead of a call to memcpy().  The Cortex-M7 handles the unaligned word
+ * accesses that can result if the caller's buffer is not word aligned.
+ */
+    static void prvCopyItemWord( void * pvDestination,
+                                 const void * pvSource,
+                                 size_t xItemSize ) PRIVILEGED_FUNCTION;
+    static void prvCopyItemDoubleWord( void * pvDestination,
+                                       const void * pvSource,
+                                       size_t xItemSize ) PRIVILEGED_FUNCTION;
+    static void prvCopyItemQuadWord( void * pvDestination,
+                                     const void * pvSource,
+                                     size_t xItemSize ) PRIVILEGED_FUNCTION;
+
+/*
+ * Copy routine used for all other item sizes.
+ */
+    static void prvCopyItemGeneric( void * pvDestination,
+                                    const void * pvSource,
+                                    size_t xItemSize ) PRIVILEGED_FUNCTION;
+#endif
+
+#if ( configUSE_QUEUE_ELASTIC == 1 )
+
+/*
+ * Determines if an item can be sent to xPosition of a queue, taking into
+ * account that once the inline storage of an elastic queue is full further
+ * items need a slot in an overflow segment, which might not be available if
+ * the shared segment pool is exhausted.  Must be called from a critical
+ * section.
+ */
+    static BaseType_t prvElasticQueueHasRoom( const Queue_t * const pxQueue,
+                                              const BaseType_t xPosition ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the number of items that could be sent to the back of a queue now,
+ * which for an elastic queue is limited by the free slots in its newest
+ * overflow segment and the segments left in the shared pool.  Must be called
+ * from a critical section.
+ */
+    static UBaseType_t prvElasticQueueSpaces( const Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
+
+/*
+ * Take a segment from, or give a segment back to, the shared overflow segment
+ * pool.  Must be called from a critical section.  Giving a segment back wakes
+ * a task blocked sending to another elastic queue because the pool was
+ * exhausted, and returns pdTRUE if that task has a priority above the calling
+ * task.
+ */
+    static QueueSegment_t * prvBorrowSegment( Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
+    static BaseType_t prvReturnSegment( const Queue_t * const pxQueue,
+                                        QueueSegment_t * const pxSegment ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called when a sender is about to block on an elastic queue.  If the queue
+ * is below its maximum length the sender is waiting for the pool, so the
+ * queue is added to the list prvReturnSegment() walks.  Must be called from a
+ * critical section.
+ */
+    static void prvAddPoolWaiter( Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
+
+/*
+ * Append an item to the newest overflow segment of an elastic queue,
+ * borrowing a new segment from the pool if necessary.  Overflow segments
+ * always hold the newest items in the queue, so this is only called once the
+ * inline storage is full.
+ */
+    static void prvAppendToOverflow( Queue_t * const pxQueue,
+                                     const void * pvItemToQueue ) PRIVILEGED_FUNCTION;
+
+/*
+ * Moves the newest item in the full inline storage of an elastic queue to the
+ * front of the overflow segments to make room for an item sent to the front
+ * of the queue.
+ */
+    static void prvMoveNewestInlineItemToOverflow( Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called after an item has been removed from the inline storage of an elastic
+ * queue.  Moves the oldest overflow item into the inline storage so items are
+ * always read from the inline storage in FIFO order, and returns overflow
+ * segments to the pool as they drain.  Returns pdTRUE if returning a segment
+ * woke a task that should preempt the calling task.
+ */
+    static BaseType_t prvRefillFromOverflow( Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns all the overflow segments borrowed by a queue to the pool.  Returns
+ * pdTRUE if doing so woke a task that should preempt the calling task.
+ */
+    static BaseType_t prvReleaseOverflowSegments( Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
+
+/* Determine if an item can be sent to a queue. */
+    #define prvQueueHasRoom( pxQueue, xPosition )    prvElasticQueueHasRoom( ( pxQueue ), ( xPosition ) )
+#else
+    #define prvQueueHasRoom( pxQueue, xPosition )    ( ( ( pxQueue )->uxMessagesWaiting < ( pxQueue )->uxLength ) || ( ( xPosition ) == queueOVERWRITE ) )
+#endif /* configUSE_QUEUE_ELASTIC */
+
+#if ( configUSE_QUEUE_SINGLE_CRITICAL_BLOCKING == 1 )
+
+/*
+ * Called from within the critical section in which a blocking send or receive
+ * found it could not complete.  Sets the timeout state on the first call and
+ * checks it on subsequent calls, so the whole blocking decision is taken
+ * without leaving the critical section.
+ *
+ * @return pdTRUE if the block time has expired, otherwise pdFALSE.
+ */
+    static BaseType_t prvCheckForTimeOutWithinCritical( TimeOut_t * const pxTimeOut,
+                                                        TickType_t * const pxTicksToWait,
+                                                        BaseType_t * const pxEntryTimeSet ) PRIVILEGED_FUNCTION;
+#endif
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_ELASTIC == 1 )
+
+/* The shared pool of overflow segments, and the list of segments not
+ * currently borrowed by any queue.  Only accessed from critical sections. */
+    PRIVILEGED_DATA static QueueSegment_t xQueueSegmentPool[ configQUEUE_ELASTIC_POOL_SEGMENTS ];
+    PRIVILEGED_DATA static QueueSegment_t * pxFreeQueueSegments = NULL;
+    PRIVILEGED_DATA static UBaseType_t uxFreeQueueSegments = ( UBaseType_t ) 0U;
+    PRIVILEGED_DATA static BaseType_t xQueueSegmentPoolInitialised = pdFALSE;
+    PRIVILEGED_DATA static Queue_t * pxPoolWaitingQueues = NULL; /*< Elastic queues with senders blocked because the pool was exhausted, linked through pxNextPoolWaiter.  Queues whose senders have since gone are removed when the list is next walked. */
+#endif
 /*-----------------------------------------------------------*/
 
 /*
@@ -308,13 +504,38 @@ BaseType_t xQueueGenericReset( QueueHandle_t xQueue,
     {
         taskENTER_CRITICAL();
         {
-            pxQueue->u.xQueue.pcTail = pxQueue->pcHead + ( pxQueue->uxLength * pxQueue->uxItemSize ); /*lint !e9016 Pointer arithmetic allowed on char types, especially when it assists conveying intent. */
+            pxQueue->u.xQueue.pcTail = pxQueue->pcHead + ( queueINLINE_LENGTH( pxQueue ) * pxQueue->uxItemSize ); /*lint !e9016 Pointer arithmetic allowed on char types, especially when it assists conveying intent. */
             pxQueue->uxMessagesWaiting = ( UBaseType_t ) 0U;
             pxQueue->pcWriteTo = pxQueue->pcHead;
-            pxQueue->u.xQueue.pcReadFrom = pxQueue->pcHead + ( ( pxQueue->uxLength - 1U ) * pxQueue->uxItemSize ); /*lint !e9016 Pointer arithmetic allowed on char types, especially when it assists conveying intent. */
+            pxQueue->u.xQueue.pcReadFrom = pxQueue->pcHead + ( ( queueINLINE_LENGTH( pxQueue ) - 1U ) * pxQueue->uxItemSize ); /*lint !e9016 Pointer arithmetic allowed on char types, especially when it assists conveying intent. */
             pxQueue->cRxLock = queueUNLOCKED;
             pxQueue->cTxLock = queueUNLOCKED;
 
+            #if ( configUSE_QUEUE_ELASTIC == 1 )
+            {
+                if( xNewQueue == pdFALSE )
+                {
+                    /* Any items held in overflow segments are discarded. */
+                    if( prvReleaseOverflowSegments( pxQueue ) != pdFALSE )
+                    {
+                        queueYIELD_IF_USING_PREEMPTION();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    pxQueue->pxOverflowHead = NULL;
+                    pxQueue->pxOverflowTail = NULL;
+                }
+
+                pxQueue->uxOverflowReadIndex = ( UBaseType_t ) 0U;
+                pxQueue->uxOverflowWriteIndex = ( UBaseType_t ) 0U;
+            }
+            #endif /* configUSE_QUEUE_ELASTIC */
+
             if( xNewQueue == pdFALSE )
             {
                 /* If there are tasks blocked waiting to read from the queue, then
@@ -519,6 +740,58 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength,
      * defined. */
     pxNewQueue->uxLength = uxQueueLength;
     pxNewQueue->uxItemSize = uxItemSize;
+
+    #if ( configUSE_QUEUE_ELASTIC == 1 )
+    {
+        /* The queue only becomes elastic if xQueueCreateElastic() raises
+         * uxLength above the inline length after it has been created. */
+        pxNewQueue->uxInlineLength = uxQueueLength;
+        pxNewQueue->uxItemsPerSegment = ( UBaseType_t ) 0U;
+        pxNewQueue->uxGrowCount = ( UBaseType_t ) 0U;
+        pxNewQueue->pxNextPoolWaiter = NULL;
+        pxNewQueue->ucWaitingOnPool = pdFALSE;
+    }
+    #endif /* configUSE_QUEUE_ELASTIC */
+
+    #if ( configUSE_QUEUE_POW2_STORAGE == 1 )
+    {
+        const size_t xStorageSize = ( size_t ) uxQueueLength * ( size_t ) uxItemSize;
+
+        /* Read and write positions can only wrap by masking if the storage
+         * area is a power of two bytes long, which is the case when both the
+         * queue length and the item size are powers of two. */
+        if( ( xStorageSize > ( size_t ) 1 ) && ( ( xStorageSize & ( xStorageSize - ( size_t ) 1 ) ) == ( size_t ) 0 ) )
+        {
+            pxNewQueue->xStorageMask = xStorageSize - ( size_t ) 1;
+        }
+        else
+        {
+            pxNewQueue->xStorageMask = ( size_t ) 0;
+        }
+
+        /* Select the copy routine once here rather than on every send and
+         * receive. */
+        switch( uxItemSize )
+        {
+            case sizeof( uint32_t ):
+                pxNewQueue->pxCopyItem = prvCopyItemWord;
+                break;
+
+            case sizeof( uint64_t ):
+                pxNewQueue->pxCopyItem = prvCopyItemDoubleWord;
+                break;
+
+            case ( 2U * sizeof( uint64_t ) ):
+                pxNewQueue->pxCopyItem = prvCopyItemQuadWord;
+                break;
+
+            default:
+                pxNewQueue->pxCopyItem = prvCopyItemGeneric;
+                break;
+        }
+    }
+    #endif /* configUSE_QUEUE_POW2_STORAGE */
+
     ( void ) xQueueGenericReset( pxNewQueue, pdTRUE );
 
     #if ( configUSE_TRACE_FACILITY == 1 )
@@ -861,7 +1134,7 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,
              * highest priority task wanting to access the queue.  If the head item
              * in the queue is to be overwritten then it does not matter if the
              * queue is full. */
-            if( ( pxQueue->uxMessagesWaiting < pxQueue->uxLength ) || ( xCopyPosition == queueOVERWRITE ) )
+            if( prvQueueHasRoom( pxQueue, xCopyPosition ) != pdFALSE )
             {
                 traceQUEUE_SEND( pxQueue );
 
@@ -977,69 +1250,107 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,
                     traceQUEUE_SEND_FAILED( pxQueue );
                     return errQUEUE_FULL;
                 }
-                else if( xEntryTimeSet == pdFALSE )
-                {
-                    /* The queue was full and a block time was specified so
-                     * configure the timeout structure. */
-                    vTaskInternalSetTimeOutState( &xTimeOut );
-                    xEntryTimeSet = pdTRUE;
-                }
-                else
-                {
-                    /* Entry time was already set. */
-                    mtCOVERAGE_TEST_MARKER();
-                }
+                #if ( configUSE_QUEUE_SINGLE_CRITICAL_BLOCKING == 1 )
+                    else if( prvCheckForTimeOutWithinCritical( &xTimeOut, &xTicksToWait, &xEntryTimeSet ) != pdFALSE )
+                    {
+                        /* The queue is still full and the block time has
+                         * expired, so leave now. */
+                        taskEXIT_CRITICAL();
+                        traceQUEUE_SEND_FAILED( pxQueue );
+                        return errQUEUE_FULL;
+                    }
+                    else
+                    {
+                        /* The queue was found to be full within this same
+                         * critical section, so neither a task nor an interrupt
+                         * can receive between the check and this task being
+                         * placed on the event list.  The queue is never locked
+                         * on this path, so interrupts always act on the event
+                         * lists directly. */
+                        traceBLOCKING_ON_QUEUE_SEND( pxQueue );
+
+                        #if ( configUSE_QUEUE_ELASTIC == 1 )
+                        {
+                            prvAddPoolWaiter( pxQueue );
+                        }
+                        #endif
+
+                        vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToSend ), xTicksToWait );
+
+                        /* The yield is held pending until the critical
+                         * section is exited.  Loop back to try again when this
+                         * task next runs. */
+                        portYIELD_WITHIN_API();
+                    }
+                #else /* configUSE_QUEUE_SINGLE_CRITICAL_BLOCKING */
+                    else if( xEntryTimeSet == pdFALSE )
+                    {
+                        /* The queue was full and a block time was specified so
+                         * configure the timeout structure. */
+                        vTaskInternalSetTimeOutState( &xTimeOut );
+                        xEntryTimeSet = pdTRUE;
+                    }
+                    else
+                    {
+                        /* Entry time was already set. */
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                #endif /* configUSE_QUEUE_SINGLE_CRITICAL_BLOCKING */
             }
         }
         taskEXIT_CRITICAL();
 
-        /* Interrupts and other tasks can send to and receive from the queue
-         * now the critical section has been exited. */
-
-        vTaskSuspendAll();
-        prvLockQueue( pxQueue );
-
-        /* Update the timeout state to see if it has expired yet. */
-        if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+        #if ( configUSE_QUEUE_SINGLE_CRITICAL_BLOCKING == 0 )
         {
-            if( prvIsQueueFull( pxQueue ) != pdFALSE )
-            {
-                traceBLOCKING_ON_QUEUE_SEND( pxQueue );
-                vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToSend ), xTicksToWait );
+            /* Interrupts and other tasks can send to and receive from the queue
+             * now the critical section has been exited. */
 
-                /* Unlocking the queue means queue events can effect the
-                 * event list. It is possible that interrupts occurring now
-                 * remove this task from the event list again - but as the
-                 * scheduler is suspended the task will go onto the pending
-                 * ready list instead of the actual ready list. */
-                prvUnlockQueue( pxQueue );
+            vTaskSuspendAll();
+            prvLockQueue( pxQueue );
 
-                /* Resuming the scheduler will move tasks from the pending
-                 * ready list into the ready list - so it is feasible that this
-                 * task is already in the ready list before it yields - in which
-                 * case the yield will not cause a context switch unless there
-                 * is also a higher priority task in the pending ready list. */
-                if( xTaskResumeAll() == pdFALSE )
+            /* Update the timeout state to see if it has expired yet. */
+            if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+            {
+                if( prvIsQueueFull( pxQueue, xCopyPosition ) != pdFALSE )
                 {
-                    portYIELD_WITHIN_API();
+                    traceBLOCKING_ON_QUEUE_SEND( pxQueue );
+                    vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToSend ), xTicksToWait );
+
+                    /* Unlocking the queue means queue events can effect the
+                     * event list. It is possible that interrupts occurring now
+                     * remove this task from the event list again - but as the
+                     * scheduler is suspended the task will go onto the pending
+                     * ready list instead of the actual ready list. */
+                    prvUnlockQueue( pxQueue );
+
+                    /* Resuming the scheduler will move tasks from the pending
+                     * ready list into the ready list - so it is feasible that this
+                     * task is already in the ready list before it yields - in which
+                     * case the yield will not cause a context switch unless there
+                     * is also a higher priority task in the pending ready list. */
+                    if( xTaskResumeAll() == pdFALSE )
+                    {
+                        portYIELD_WITHIN_API();
+                    }
+                }
+                else
+                {
+                    /* Try again. */
+                    prvUnlockQueue( pxQueue );
+                    ( void ) xTaskResumeAll();
                 }
             }
             else
             {
-                /* Try again. */
+                /* The timeout has expired. */
                 prvUnlockQueue( pxQueue );
                 ( void ) xTaskResumeAll();
-            }
-        }
-        else
-        {
-            /* The timeout has expired. */
-            prvUnlockQueue( pxQueue );
-            ( void ) xTaskResumeAll();
 
-            traceQUEUE_SEND_FAILED( pxQueue );
-            return errQUEUE_FULL;
+                traceQUEUE_SEND_FAILED( pxQueue );
+                return errQUEUE_FULL;
+            }
         }
+        #endif /* configUSE_QUEUE_SINGLE_CRITICAL_BLOCKING */
     } /*lint -restore */
 }
 /*-----------------------------------------------------------*/
@@ -1080,7 +1391,7 @@ BaseType_t xQueueGenericSendFromISR( QueueHandle_t xQueue,
      * post). */
     uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
     {
-        if( ( pxQueue->uxMessagesWaiting < pxQueue->uxLength ) || ( xCopyPosition == queueOVERWRITE ) )
+        if( prvQueueHasRoom( pxQueue, xCopyPosition ) != pdFALSE )
         {
             const int8_t cTxLock = pxQueue->cTxLock;
             const UBaseType_t uxPreviousMessagesWaiting = pxQueue->uxMessagesWaiting;
@@ -1415,6 +1726,19 @@ BaseType_t xQueueReceive( QueueHandle_t xQueue,
                 traceQUEUE_RECEIVE( pxQueue );
                 pxQueue->uxMessagesWaiting = uxMessagesWaiting - ( UBaseType_t ) 1;
 
+                #if ( configUSE_QUEUE_ELASTIC == 1 )
+                {
+                    if( prvRefillFromOverflow( pxQueue ) != pdFALSE )
+                    {
+                        queueYIELD_IF_USING_PREEMPTION();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                #endif
+
                 /* There is now space in the queue, were any tasks waiting to
                  * post to the queue?  If so, unblock the highest priority waiting
                  * task. */
@@ -1447,73 +1771,98 @@ BaseType_t xQueueReceive( QueueHandle_t xQueue,
                     traceQUEUE_RECEIVE_FAILED( pxQueue );
                     return errQUEUE_EMPTY;
                 }
-                else if( xEntryTimeSet == pdFALSE )
-                {
-                    /* The queue was empty and a block time was specified so
-                     * configure the timeout structure. */
-                    vTaskInternalSetTimeOutState( &xTimeOut );
-                    xEntryTimeSet = pdTRUE;
-                }
-                else
-                {
-                    /* Entry time was already set. */
-                    mtCOVERAGE_TEST_MARKER();
-                }
+                #if ( configUSE_QUEUE_SINGLE_CRITICAL_BLOCKING == 1 )
+                    else if( prvCheckForTimeOutWithinCritical( &xTimeOut, &xTicksToWait, &xEntryTimeSet ) != pdFALSE )
+                    {
+                        /* The queue is still empty and the block time has
+                         * expired, so leave now. */
+                        taskEXIT_CRITICAL();
+                        traceQUEUE_RECEIVE_FAILED( pxQueue );
+                        return errQUEUE_EMPTY;
+                    }
+                    else
+                    {
+                        /* The queue was found to be empty within this same
+                         * critical section, so nothing can be posted between
+                         * the check and this task being placed on the event
+                         * list.  See xQueueGenericSend(). */
+                        traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue );
+                        vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
+                        portYIELD_WITHIN_API();
+                    }
+                #else /* configUSE_QUEUE_SINGLE_CRITICAL_BLOCKING */
+                    else if( xEntryTimeSet == pdFALSE )
+                    {
+                        /* The queue was empty and a block time was specified so
+                         * configure the timeout structure. */
+                        vTaskInternalSetTimeOutState( &xTimeOut );
+                        xEntryTimeSet = pdTRUE;
+                    }
+                    else
+                    {
+                        /* Entry time was already set. */
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                #endif /* configUSE_QUEUE_SINGLE_CRITICAL_BLOCKING */
             }
         }
         taskEXIT_CRITICAL();
 
-        /* Interrupts and other tasks can send to and receive from the queue
-         * now the critical section has been exited. */
+        #if ( configUSE_QUEUE_SINGLE_CRITICAL_BLOCKING == 0 )
+        {
+            /* Interrupts and other tasks can send to and receive from the queue
+             * now the critical section has been exited. */
 
-        vTaskSuspendAll();
-        prvLockQueue( pxQueue );
+            vTaskSuspendAll();
+            prvLockQueue( pxQueue );
 
-        /* Update the timeout state to see if it has expired yet. */
-        if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
-        {
-            /* The timeout has not expired.  If the queue is still empty place
-             * the task on the list of tasks waiting to receive from the queue. */
-            if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+            /* Update the timeout state to see if it has expired yet. */
+            if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
             {
-                traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue );
-                vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
-                prvUnlockQueue( pxQueue );
-
-                if( xTaskResumeAll() == pdFALSE )
+                /* The timeout has not expired.  If the queue is still empty place
+                 * the task on the list of tasks waiting to receive from the queue. */
+                if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
                 {
-                    portYIELD_WITHIN_API();
+                    traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue );
+                    vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
+                    prvUnlockQueue( pxQueue );
+
+                    if( xTaskResumeAll() == pdFALSE )
+                    {
+                        portYIELD_WITHIN_API();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
                 }
                 else
                 {
-                    mtCOVERAGE_TEST_MARKER();
+                    /* The queue contains data again.  Loop back to try and read the
+                     * data. */
+                    prvUnlockQueue( pxQueue );
+                    ( void ) xTaskResumeAll();
                 }
             }
             else
             {
-                /* The queue contains data again.  Loop back to try and read the
-                 * data. */
+                /* Timed out.  If there is no data in the queue exit, otherwise loop
+                 * back and attempt to read the data. */
                 prvUnlockQueue( pxQueue );
                 ( void ) xTaskResumeAll();
-            }
-        }
-        else
-        {
-            /* Timed out.  If there is no data in the queue exit, otherwise loop
-             * back and attempt to read the data. */
-            prvUnlockQueue( pxQueue );
-            ( void ) xTaskResumeAll();
 
-            if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
-            {
-                traceQUEUE_RECEIVE_FAILED( pxQueue );
-                return errQUEUE_EMPTY;
-            }
-            else
-            {
-                mtCOVERAGE_TEST_MARKER();
+                if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+                {
+                    traceQUEUE_RECEIVE_FAILED( pxQueue );
+                    return errQUEUE_EMPTY;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
             }
         }
+        #endif /* configUSE_QUEUE_SINGLE_CRITICAL_BLOCKING */
     } /*lint -restore */
 }
 /*-----------------------------------------------------------*/
@@ -1529,6 +1878,10 @@ BaseType_t xQueueSemaphoreTake( QueueHandle_t xQueue,
         BaseType_t xInheritanceOccurred = pdFALSE;
     #endif
 
+    #if ( configUSE_PRIORITY_INHERITANCE_CHAIN == 1 )
+        BaseType_t xBlockedOnMutex = pdFALSE;
+    #endif
+
     /* Check the queue pointer is not NULL. */
     configASSERT( ( pxQueue ) );
 
@@ -1554,6 +1907,22 @@ BaseType_t xQueueSemaphoreTake( QueueHandle_t xQueue,
              * number of messages in the queue is the semaphore's count value. */
             const UBaseType_t uxSemaphoreCount = pxQueue->uxMessagesWaiting;
 
+            #if ( configUSE_PRIORITY_INHERITANCE_CHAIN == 1 )
+            {
+                /* If this task blocked on the mutex it is no longer doing so,
+                 * as it is running again. */
+                if( xBlockedOnMutex != pdFALSE )
+                {
+                    vTaskSetBlockedOnMutex( NULL );
+                    xBlockedOnMutex = pdFALSE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif
+
             /* Is there data in the queue now?  To be running the calling task
              * must be the highest priority task wanting to access the queue. */
             if( uxSemaphoreCount > ( UBaseType_t ) 0 )
@@ -1610,120 +1979,187 @@ BaseType_t xQueueSemaphoreTake( QueueHandle_t xQueue,
                     traceQUEUE_RECEIVE_FAILED( pxQueue );
                     return errQUEUE_EMPTY;
                 }
-                else if( xEntryTimeSet == pdFALSE )
-                {
-                    /* The semaphore count was 0 and a block time was specified
-                     * so configure the timeout structure ready to block. */
-                    vTaskInternalSetTimeOutState( &xTimeOut );
-                    xEntryTimeSet = pdTRUE;
-                }
-                else
-                {
-                    /* Entry time was already set. */
-                    mtCOVERAGE_TEST_MARKER();
-                }
-            }
-        }
-        taskEXIT_CRITICAL();
-
-        /* Interrupts and other tasks can give to and take from the semaphore
-         * now the critical section has been exited. */
+                #if ( configUSE_QUEUE_SINGLE_CRITICAL_BLOCKING == 1 )
+                    else if( prvCheckForTimeOutWithinCritical( &xTimeOut, &xTicksToWait, &xEntryTimeSet ) != pdFALSE )
+                    {
+                        #if ( configUSE_MUTEXES == 1 )
+                        {
+                            /* xInheritanceOccurred could only have be set if
+                             * pxQueue->uxQueueType == queueQUEUE_IS_MUTEX. */
+                            if( xInheritanceOccurred != pdFALSE )
+                            {
+                                UBaseType_t uxHighestWaitingPriority;
+
+                                /* This task has timed out, so give back the
+                                 * priority it lent to the mutex holder, but only
+                                 * as low as the next highest priority task that
+                                 * is waiting for the same mutex. */
+                                uxHighestWaitingPriority = prvGetDisinheritPriorityAfterTimeout( pxQueue );
+                                vTaskPriorityDisinheritAfterTimeout( pxQueue->u.xSemaphore.xMutexHolder, uxHighestWaitingPriority );
+                            }
+                        }
+                        #endif /* configUSE_MUTEXES */
 
-        vTaskSuspendAll();
-        prvLockQueue( pxQueue );
+                        taskEXIT_CRITICAL();
+                        traceQUEUE_RECEIVE_FAILED( pxQueue );
+                        return errQUEUE_EMPTY;
+                    }
+                    else
+                    {
+                        /* The count was found to be 0 within this same
+                         * critical section.  See xQueueGenericSend(). */
+                        traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue );
 
-        /* Update the timeout state to see if it has expired yet. */
-        if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+                        #if ( configUSE_MUTEXES == 1 )
+                        {
+                            if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
+                            {
+                                xInheritanceOccurred = xTaskPriorityInherit( pxQueue->u.xSemaphore.xMutexHolder );
+
+                                #if ( configUSE_PRIORITY_INHERITANCE_CHAIN == 1 )
+                                {
+                                    vTaskSetBlockedOnMutex( pxQueue );
+                                    xBlockedOnMutex = pdTRUE;
+                                }
+                                #endif
+                            }
+                            else
+                            {
+                                mtCOVERAGE_TEST_MARKER();
+                            }
+                        }
+                        #endif /* configUSE_MUTEXES */
+
+                        vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
+                        portYIELD_WITHIN_API();
+                    }
+                #else /* configUSE_QUEUE_SINGLE_CRITICAL_BLOCKING */
+                    else if( xEntryTimeSet == pdFALSE )
+                    {
+                        /* The semaphore count was 0 and a block time was specified
+                         * so configure the timeout structure ready to block. */
+                        vTaskInternalSetTimeOutState( &xTimeOut );
+                        xEntryTimeSet = pdTRUE;
+                    }
+                    else
+                    {
+                        /* Entry time was already set. */
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                #endif /* configUSE_QUEUE_SINGLE_CRITICAL_BLOCKING */
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        #if ( configUSE_QUEUE_SINGLE_CRITICAL_BLOCKING == 0 )
         {
-            /* A block time is specified and not expired.  If the semaphore
-             * count is 0 then enter the Blocked state to wait for a semaphore to
-             * become available.  As semaphores are implemented with queues the
-             * queue being empty is equivalent to the semaphore count being 0. */
-            if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
-            {
-                traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue );
+            /* Interrupts and other tasks can give to and take from the semaphore
+             * now the critical section has been exited. */
 
-                #if ( configUSE_MUTEXES == 1 )
+            vTaskSuspendAll();
+            prvLockQueue( pxQueue );
+
+            /* Update the timeout state to see if it has expired yet. */
+            if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+            {
+                /* A block time is specified and not expired.  If the semaphore
+                 * count is 0 then enter the Blocked state to wait for a semaphore to
+                 * become available.  As semaphores are implemented with queues the
+                 * queue being empty is equivalent to the semaphore count being 0. */
+                if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
                 {
-                    if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
+                    traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue );
+
+                    #if ( configUSE_MUTEXES == 1 )
                     {
-                        taskENTER_CRITICAL();
+                        if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
+                        {
+                            taskENTER_CRITICAL();
+                            {
+                                xInheritanceOccurred = xTaskPriorityInherit( pxQueue->u.xSemaphore.xMutexHolder );
+
+                                #if ( configUSE_PRIORITY_INHERITANCE_CHAIN == 1 )
+                                {
+                                    vTaskSetBlockedOnMutex( pxQueue );
+                                    xBlockedOnMutex = pdTRUE;
+                                }
+                                #endif
+                            }
+                            taskEXIT_CRITICAL();
+                        }
+                        else
                         {
-                            xInheritanceOccurred = xTaskPriorityInherit( pxQueue->u.xSemaphore.xMutexHolder );
+                            mtCOVERAGE_TEST_MARKER();
                         }
-                        taskEXIT_CRITICAL();
+                    }
+                    #endif /* if ( configUSE_MUTEXES == 1 ) */
+
+                    vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
+                    prvUnlockQueue( pxQueue );
+
+                    if( xTaskResumeAll() == pdFALSE )
+                    {
+                        portYIELD_WITHIN_API();
                     }
                     else
                     {
                         mtCOVERAGE_TEST_MARKER();
                     }
                 }
-                #endif /* if ( configUSE_MUTEXES == 1 ) */
-
-                vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
-                prvUnlockQueue( pxQueue );
-
-                if( xTaskResumeAll() == pdFALSE )
-                {
-                    portYIELD_WITHIN_API();
-                }
                 else
                 {
-                    mtCOVERAGE_TEST_MARKER();
+                    /* There was no timeout and the semaphore count was not 0, so
+                     * attempt to take the semaphore again. */
+                    prvUnlockQueue( pxQueue );
+                    ( void ) xTaskResumeAll();
                 }
             }
             else
             {
-                /* There was no timeout and the semaphore count was not 0, so
-                 * attempt to take the semaphore again. */
+                /* Timed out. */
                 prvUnlockQueue( pxQueue );
                 ( void ) xTaskResumeAll();
-            }
-        }
-        else
-        {
-            /* Timed out. */
-            prvUnlockQueue( pxQueue );
-            ( void ) xTaskResumeAll();
 
-            /* If the semaphore count is 0 exit now as the timeout has
-             * expired.  Otherwise return to attempt to take the semaphore that is
-             * known to be available.  As semaphores are implemented by queues the
-             * queue being empty is equivalent to the semaphore count being 0. */
-            if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
-            {
-                #if ( configUSE_MUTEXES == 1 )
+                /* If the semaphore count is 0 exit now as the timeout has
+                 * expired.  Otherwise return to attempt to take the semaphore that is
+                 * known to be available.  As semaphores are implemented by queues the
+                 * queue being empty is equivalent to the semaphore count being 0. */
+                if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
                 {
-                    /* xInheritanceOccurred could only have be set if
-                     * pxQueue->uxQueueType == queueQUEUE_IS_MUTEX so no need to
-                     * test the mutex type again to check it is actually a mutex. */
-                    if( xInheritanceOccurred != pdFALSE )
+                    #if ( configUSE_MUTEXES == 1 )
                     {
-                        taskENTER_CRITICAL();
+                        /* xInheritanceOccurred could only have be set if
+                         * pxQueue->uxQueueType == queueQUEUE_IS_MUTEX so no need to
+                         * test the mutex type again to check it is actually a mutex. */
+                        if( xInheritanceOccurred != pdFALSE )
                         {
-                            UBaseType_t uxHighestWaitingPriority;
-
-                            /* This task blocking on the mutex caused another
-                             * task to inherit this task's priority.  Now this task
-                             * has timed out the priority should be disinherited
-                             * again, but only as low as the next highest priority
-                             * task that is waiting for the same mutex. */
-                            uxHighestWaitingPriority = prvGetDisinheritPriorityAfterTimeout( pxQueue );
-                            vTaskPriorityDisinheritAfterTimeout( pxQueue->u.xSemaphore.xMutexHolder, uxHighestWaitingPriority );
+                            taskENTER_CRITICAL();
+                            {
+                                UBaseType_t uxHighestWaitingPriority;
+
+                                /* This task blocking on the mutex caused another
+                                 * task to inherit this task's priority.  Now this task
+                                 * has timed out the priority should be disinherited
+                                 * again, but only as low as the next highest priority
+                                 * task that is waiting for the same mutex. */
+                                uxHighestWaitingPriority = prvGetDisinheritPriorityAfterTimeout( pxQueue );
+                                vTaskPriorityDisinheritAfterTimeout( pxQueue->u.xSemaphore.xMutexHolder, uxHighestWaitingPriority );
+                            }
+                            taskEXIT_CRITICAL();
                         }
-                        taskEXIT_CRITICAL();
                     }
-                }
-                #endif /* configUSE_MUTEXES */
+                    #endif /* configUSE_MUTEXES */
 
-                traceQUEUE_RECEIVE_FAILED( pxQueue );
-                return errQUEUE_EMPTY;
-            }
-            else
-            {
-                mtCOVERAGE_TEST_MARKER();
+                    traceQUEUE_RECEIVE_FAILED( pxQueue );
+                    return errQUEUE_EMPTY;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
             }
         }
+        #endif /* configUSE_QUEUE_SINGLE_CRITICAL_BLOCKING */
     } /*lint -restore */
 }
 /*-----------------------------------------------------------*/
@@ -1920,6 +2356,26 @@ BaseType_t xQueueReceiveFromISR( QueueHandle_t xQueue,
             prvCopyDataFromQueue( pxQueue, pvBuffer );
             pxQueue->uxMessagesWaiting = uxMessagesWaiting - ( UBaseType_t ) 1;
 
+            #if ( configUSE_QUEUE_ELASTIC == 1 )
+            {
+                if( prvRefillFromOverflow( pxQueue ) != pdFALSE )
+                {
+                    if( pxHigherPriorityTaskWoken != NULL )
+                    {
+                        *pxHigherPriorityTaskWoken = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif
+
             /* If the queue is locked the event list will not be modified.
              * Instead update the lock count so the task that unlocks the queue
              * will know that an ISR has removed data while the queue was
@@ -2052,7 +2508,15 @@ UBaseType_t uxQueueSpacesAvailable( const QueueHandle_t xQueue )
 
     taskENTER_CRITICAL();
     {
-        uxReturn = pxQueue->uxLength - pxQueue->uxMessagesWaiting;
+        #if ( configUSE_QUEUE_ELASTIC == 1 )
+        {
+            uxReturn = prvElasticQueueSpaces( pxQueue );
+        }
+        #else
+        {
+            uxReturn = pxQueue->uxLength - pxQueue->uxMessagesWaiting;
+        }
+        #endif
     }
     taskEXIT_CRITICAL();
 
@@ -2085,6 +2549,39 @@ void vQueueDelete( QueueHandle_t xQueue )
     }
     #endif
 
+    #if ( configUSE_QUEUE_ELASTIC == 1 )
+    {
+        Queue_t ** ppxPoolWaiter;
+
+        taskENTER_CRITICAL();
+        {
+            if( pxQueue->ucWaitingOnPool != pdFALSE )
+            {
+                for( ppxPoolWaiter = &pxPoolWaitingQueues; *ppxPoolWaiter != pxQueue; ppxPoolWaiter = &( ( *ppxPoolWaiter )->pxNextPoolWaiter ) )
+                {
+                    /* The queue is known to be in the list. */
+                }
+
+                *ppxPoolWaiter = pxQueue->pxNextPoolWaiter;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( prvReleaseOverflowSegments( pxQueue ) != pdFALSE )
+            {
+                queueYIELD_IF_USING_PREEMPTION();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+    }
+    #endif
+
     #if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) )
     {
         /* The queue can only have been allocated dynamically - free it
@@ -2200,33 +2697,106 @@ static BaseType_t prvCopyDataToQueue( Queue_t * const pxQueue,
         }
         #endif /* configUSE_MUTEXES */
     }
+    #if ( configUSE_QUEUE_ELASTIC == 1 )
+        else if( ( xPosition == queueSEND_TO_BACK ) && ( uxMessagesWaiting >= pxQueue->uxInlineLength ) )
+        {
+            /* The inline storage of an elastic queue is full, so the item is
+             * held in an overflow segment until it reaches the front. */
+            prvAppendToOverflow( pxQueue, pvItemToQueue );
+        }
+    #endif /* configUSE_QUEUE_ELASTIC */
     else if( xPosition == queueSEND_TO_BACK )
     {
-        ( void ) memcpy( ( void * ) pxQueue->pcWriteTo, pvItemToQueue, ( size_t ) pxQueue->uxItemSize ); /*lint !e961 !e418 !e9087 MISRA exception as the casts are only redundant for some ports, plus previous logic ensures a null pointer can only be passed to memcpy() if the copy size is 0.  Cast to void required by function signature and safe as no alignment requirement and copy length specified in bytes. */
-        pxQueue->pcWriteTo += pxQueue->uxItemSize;                                                       /*lint !e9016 Pointer arithmetic on char types ok, especially in this use case where it is the clearest way of conveying intent. */
-
-        if( pxQueue->pcWriteTo >= pxQueue->u.xQueue.pcTail )                                             /*lint !e946 MISRA exception justified as comparison of pointers is the cleanest solution. */
+        #if ( configUSE_QUEUE_POW2_STORAGE == 1 )
         {
-            pxQueue->pcWriteTo = pxQueue->pcHead;
+            pxQueue->pxCopyItem( ( void * ) pxQueue->pcWriteTo, pvItemToQueue, ( size_t ) pxQueue->uxItemSize );
+
+            if( pxQueue->xStorageMask != ( size_t ) 0 )
+            {
+                pxQueue->pcWriteTo = prvMaskedQueuePosition( pxQueue, pxQueue->pcWriteTo, pxQueue->uxItemSize );
+            }
+            else
+            {
+                pxQueue->pcWriteTo += pxQueue->uxItemSize;
+
+                if( pxQueue->pcWriteTo >= pxQueue->u.xQueue.pcTail )
+                {
+                    pxQueue->pcWriteTo = pxQueue->pcHead;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
         }
-        else
+        #else /* configUSE_QUEUE_POW2_STORAGE */
         {
-            mtCOVERAGE_TEST_MARKER();
+            portMEMCPY( ( void * ) pxQueue->pcWriteTo, pvItemToQueue, ( size_t ) pxQueue->uxItemSize ); /*lint !e961 !e418 !e9087 MISRA exception as the casts are only redundant for some ports, plus previous logic ensures a null pointer can only be passed to memcpy() if the copy size is 0.  Cast to void required by function signature and safe as no alignment requirement and copy length specified in bytes. */
+            pxQueue->pcWriteTo += pxQueue->uxItemSize;                                                       /*lint !e9016 Pointer arithmetic on char types ok, especially in this use case where it is the clearest way of conveying intent. */
+
+            if( pxQueue->pcWriteTo >= pxQueue->u.xQueue.pcTail )                                             /*lint !e946 MISRA exception justified as comparison of pointers is the cleanest solution. */
+            {
+                pxQueue->pcWriteTo = pxQueue->pcHead;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
         }
+        #endif /* configUSE_QUEUE_POW2_STORAGE */
     }
     else
     {
-        ( void ) memcpy( ( void * ) pxQueue->u.xQueue.pcReadFrom, pvItemToQueue, ( size_t ) pxQueue->uxItemSize ); /*lint !e961 !e9087 !e418 MISRA exception as the casts are only redundant for some ports.  Cast to void required by function signature and safe as no alignment requirement and copy length specified in bytes.  Assert checks null pointer only used when length is 0. */
-        pxQueue->u.xQueue.pcReadFrom -= pxQueue->uxItemSize;
+        #if ( configUSE_QUEUE_ELASTIC == 1 )
+        {
+            if( ( xPosition == queueSEND_TO_FRONT ) && ( uxMessagesWaiting >= pxQueue->uxInlineLength ) )
+            {
+                prvMoveNewestInlineItemToOverflow( pxQueue );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* configUSE_QUEUE_ELASTIC */
 
-        if( pxQueue->u.xQueue.pcReadFrom < pxQueue->pcHead ) /*lint !e946 MISRA exception justified as comparison of pointers is the cleanest solution. */
+        #if ( configUSE_QUEUE_POW2_STORAGE == 1 )
         {
-            pxQueue->u.xQueue.pcReadFrom = ( pxQueue->u.xQueue.pcTail - pxQueue->uxItemSize );
+            pxQueue->pxCopyItem( ( void * ) pxQueue->u.xQueue.pcReadFrom, pvItemToQueue, ( size_t ) pxQueue->uxItemSize );
+
+            if( pxQueue->xStorageMask != ( size_t ) 0 )
+            {
+                pxQueue->u.xQueue.pcReadFrom = prvMaskedQueuePosition( pxQueue, pxQueue->u.xQueue.pcReadFrom, ( size_t ) 0U - ( size_t ) pxQueue->uxItemSize );
+            }
+            else
+            {
+                pxQueue->u.xQueue.pcReadFrom -= pxQueue->uxItemSize;
+
+                if( pxQueue->u.xQueue.pcReadFrom < pxQueue->pcHead )
+                {
+                    pxQueue->u.xQueue.pcReadFrom = ( pxQueue->u.xQueue.pcTail - pxQueue->uxItemSize );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
         }
-        else
+        #else /* configUSE_QUEUE_POW2_STORAGE */
         {
-            mtCOVERAGE_TEST_MARKER();
+            portMEMCPY( ( void * ) pxQueue->u.xQueue.pcReadFrom, pvItemToQueue, ( size_t ) pxQueue->uxItemSize ); /*lint !e961 !e9087 !e418 MISRA exception as the casts are only redundant for some ports.  Cast to void required by function signature and safe as no alignment requirement and copy length specified in bytes.  Assert checks null pointer only used when length is 0. */
+            pxQueue->u.xQueue.pcReadFrom -= pxQueue->uxItemSize;
+
+            if( pxQueue->u.xQueue.pcReadFrom < pxQueue->pcHead ) /*lint !e946 MISRA exception justified as comparison of pointers is the cleanest solution. */
+            {
+                pxQueue->u.xQueue.pcReadFrom = ( pxQueue->u.xQueue.pcTail - pxQueue->uxItemSize );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
         }
+        #endif /* configUSE_QUEUE_POW2_STORAGE */
 
         if( xPosition == queueOVERWRITE )
         {
@@ -2260,22 +2830,87 @@ static void prvCopyDataFromQueue( Queue_t * const pxQueue,
 {
     if( pxQueue->uxItemSize != ( UBaseType_t ) 0 )
     {
-        pxQueue->u.xQueue.pcReadFrom += pxQueue->uxItemSize;           /*lint !e9016 Pointer arithmetic on char types ok, especially in this use case where it is the clearest way of conveying intent. */
-
-        if( pxQueue->u.xQueue.pcReadFrom >= pxQueue->u.xQueue.pcTail ) /*lint !e946 MISRA exception justified as use of the relational operator is the cleanest solutions. */
+        #if ( configUSE_QUEUE_POW2_STORAGE == 1 )
         {
-            pxQueue->u.xQueue.pcReadFrom = pxQueue->pcHead;
+            if( pxQueue->xStorageMask != ( size_t ) 0 )
+            {
+                pxQueue->u.xQueue.pcReadFrom = prvMaskedQueuePosition( pxQueue, pxQueue->u.xQueue.pcReadFrom, pxQueue->uxItemSize );
+            }
+            else
+            {
+                pxQueue->u.xQueue.pcReadFrom += pxQueue->uxItemSize;
+
+                if( pxQueue->u.xQueue.pcReadFrom >= pxQueue->u.xQueue.pcTail )
+                {
+                    pxQueue->u.xQueue.pcReadFrom = pxQueue->pcHead;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+
+            pxQueue->pxCopyItem( pvBuffer, ( void * ) pxQueue->u.xQueue.pcReadFrom, ( size_t ) pxQueue->uxItemSize );
         }
-        else
+        #else /* configUSE_QUEUE_POW2_STORAGE */
         {
-            mtCOVERAGE_TEST_MARKER();
-        }
+            pxQueue->u.xQueue.pcReadFrom += pxQueue->uxItemSize;           /*lint !e9016 Pointer arithmetic on char types ok, especially in this use case where it is the clearest way of conveying intent. */
+
+            if( pxQueue->u.xQueue.pcReadFrom >= pxQueue->u.xQueue.pcTail ) /*lint !e946 MISRA exception justified as use of the relational operator is the cleanest solutions. */
+            {
+                pxQueue->u.xQueue.pcReadFrom = pxQueue->pcHead;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
 
-        ( void ) memcpy( ( void * ) pvBuffer, ( void * ) pxQueue->u.xQueue.pcReadFrom, ( size_t ) pxQueue->uxItemSize ); /*lint !e961 !e418 !e9087 MISRA exception as the casts are only redundant for some ports.  Also previous logic ensures a null pointer can only be passed to memcpy() when the count is 0.  Cast to void required by function signature and safe as no alignment requirement and copy length specified in bytes. */
+            portMEMCPY( ( void * ) pvBuffer, ( void * ) pxQueue->u.xQueue.pcReadFrom, ( size_t ) pxQueue->uxItemSize ); /*lint !e961 !e418 !e9087 MISRA exception as the casts are only redundant for some ports.  Also previous logic ensures a null pointer can only be passed to memcpy() when the count is 0.  Cast to void required by function signature and safe as no alignment requirement and copy length specified in bytes. */
+        }
+        #endif /* configUSE_QUEUE_POW2_STORAGE */
     }
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_QUEUE_POW2_STORAGE == 1 )
+
+    static void prvCopyItemWord( void * pvDestination,
+                                 const void * pvSource,
+                                 size_t xItemSize )
+    {
+        ( void ) xItemSize;
+        ( void ) memcpy( pvDestination, pvSource, sizeof( uint32_t ) );
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvCopyItemDoubleWord( void * pvDestination,
+                                       const void * pvSource,
+                                       size_t xItemSize )
+    {
+        ( void ) xItemSize;
+        ( void ) memcpy( pvDestination, pvSource, sizeof( uint64_t ) );
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvCopyItemQuadWord( void * pvDestination,
+                                     const void * pvSource,
+                                     size_t xItemSize )
+    {
+        ( void ) xItemSize;
+        ( void ) memcpy( pvDestination, pvSource, 2U * sizeof( uint64_t ) );
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvCopyItemGeneric( void * pvDestination,
+                                    const void * pvSource,
+                                    size_t xItemSize )
+    {
+        portMEMCPY( pvDestination, pvSource, xItemSize );
+    }
+
+#endif /* configUSE_QUEUE_POW2_STORAGE */
+/*-----------------------------------------------------------*/
+
 static void prvUnlockQueue( Queue_t * const pxQueue )
 {
     /* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED. */
@@ -2396,22 +3031,481 @@ static void prvUnlockQueue( Queue_t * const pxQueue )
 }
 /*-----------------------------------------------------------*/
 
-static BaseType_t prvIsQueueEmpty( const Queue_t * pxQueue )
-{
-    BaseType_t xReturn;
+#if ( configUSE_QUEUE_ELASTIC == 1 )
 
-    taskENTER_CRITICAL();
+    static BaseType_t prvElasticQueueHasRoom( const Queue_t * const pxQueue,
+                                              const BaseType_t xPosition )
     {
-        if( pxQueue->uxMessagesWaiting == ( UBaseType_t ) 0 )
+        BaseType_t xReturn;
+
+        if( xPosition == queueOVERWRITE )
         {
+            /* Overwriting is only permitted on queues of length 1, which
+             * cannot be elastic. */
             xReturn = pdTRUE;
         }
-        else
+        else if( pxQueue->uxMessagesWaiting >= pxQueue->uxLength )
         {
             xReturn = pdFALSE;
         }
+        else if( pxQueue->uxMessagesWaiting < pxQueue->uxInlineLength )
+        {
+            xReturn = pdTRUE;
+        }
+        else if( pxFreeQueueSegments != NULL )
+        {
+            xReturn = pdTRUE;
+        }
+        else if( xPosition == queueSEND_TO_FRONT )
+        {
+            /* The pool is exhausted, so there is only room if the oldest
+             * overflow segment has a free slot in front of its oldest item. */
+            xReturn = ( ( pxQueue->pxOverflowHead != NULL ) && ( pxQueue->uxOverflowReadIndex > ( UBaseType_t ) 0U ) ) ? pdTRUE : pdFALSE;
+        }
+        else
+        {
+            /* The pool is exhausted, so there is only room if the newest
+             * overflow segment is not yet full. */
+            xReturn = ( ( pxQueue->pxOverflowTail != NULL ) && ( pxQueue->uxOverflowWriteIndex < pxQueue->uxItemsPerSegment ) ) ? pdTRUE : pdFALSE;
+        }
+
+        return xReturn;
     }
-    taskEXIT_CRITICAL();
+/*-----------------------------------------------------------*/
+
+    static UBaseType_t prvElasticQueueSpaces( const Queue_t * const pxQueue )
+    {
+        UBaseType_t uxSpaces;
+        const UBaseType_t uxMaxSpaces = pxQueue->uxLength - pxQueue->uxMessagesWaiting;
+
+        if( pxQueue->uxMessagesWaiting < pxQueue->uxInlineLength )
+        {
+            /* No overflow segments are borrowed until the inline storage is
+             * full. */
+            uxSpaces = pxQueue->uxInlineLength - pxQueue->uxMessagesWaiting;
+        }
+        else if( pxQueue->pxOverflowTail != NULL )
+        {
+            uxSpaces = pxQueue->uxItemsPerSegment - pxQueue->uxOverflowWriteIndex;
+        }
+        else
+        {
+            uxSpaces = ( UBaseType_t ) 0U;
+        }
+
+        /* Non-elastic queues have no items per segment, so only count the
+         * pool if it could be borrowed from. */
+        if( pxQueue->uxLength > pxQueue->uxInlineLength )
+        {
+            uxSpaces += uxFreeQueueSegments * pxQueue->uxItemsPerSegment;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( uxSpaces > uxMaxSpaces )
+        {
+            uxSpaces = uxMaxSpaces;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return uxSpaces;
+    }
+/*-----------------------------------------------------------*/
+
+    static QueueSegment_t * prvBorrowSegment( Queue_t * const pxQueue )
+    {
+        QueueSegment_t * pxSegment = pxFreeQueueSegments;
+
+        /* prvElasticQueueHasRoom() has already checked a segment is
+         * available. */
+        configASSERT( pxSegment );
+
+        pxFreeQueueSegments = pxSegment->pxNext;
+        uxFreeQueueSegments--;
+        pxQueue->uxGrowCount++;
+        traceQUEUE_ELASTIC_GROW( pxQueue );
+
+        return pxSegment;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvReturnSegment( const Queue_t * const pxQueue,
+                                        QueueSegment_t * const pxSegment )
+    {
+        Queue_t * pxElasticQueue;
+        Queue_t * pxWaitingQueue = NULL;
+        Queue_t ** ppxPoolWaiter;
+        BaseType_t xReturn = pdFALSE;
+
+        pxSegment->pxNext = pxFreeQueueSegments;
+        pxFreeQueueSegments = pxSegment;
+        uxFreeQueueSegments++;
+
+        /* Wake the highest priority sender blocked on another elastic queue
+         * because the pool was exhausted.  Senders blocked on pxQueue are woken
+         * by the operation that returned the segment.  Only queues that had a
+         * sender block on the pool are walked, and any that no longer have one
+         * are removed, so the walk is bounded by the number of elastic queues
+         * with senders blocked on the pool. */
+        ppxPoolWaiter = &pxPoolWaitingQueues;
+
+        while( *ppxPoolWaiter != NULL )
+        {
+            pxElasticQueue = *ppxPoolWaiter;
+
+            /* A locked queue is kept even if its event list is still empty,
+             * as its sender may be about to be placed on it. */
+            if( ( pxElasticQueue->uxMessagesWaiting < pxElasticQueue->uxLength ) &&
+                ( ( listLIST_IS_EMPTY( &( pxElasticQueue->xTasksWaitingToSend ) ) == pdFALSE ) || ( pxElasticQueue->cRxLock != queueUNLOCKED ) ) )
+            {
+                /* Event lists are ordered by inverted priority, and the value
+                 * of an empty list's end marker is portMAX_DELAY, so a locked
+                 * queue with no sender on its list yet is chosen last. */
+                if( ( pxElasticQueue != pxQueue ) &&
+                    ( ( pxWaitingQueue == NULL ) ||
+                      ( listGET_ITEM_VALUE_OF_HEAD_ENTRY( &( pxElasticQueue->xTasksWaitingToSend ) ) < listGET_ITEM_VALUE_OF_HEAD_ENTRY( &( pxWaitingQueue->xTasksWaitingToSend ) ) ) ) )
+                {
+                    pxWaitingQueue = pxElasticQueue;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                ppxPoolWaiter = &( pxElasticQueue->pxNextPoolWaiter );
+            }
+            else
+            {
+                /* No sender is waiting on the pool any more. */
+                *ppxPoolWaiter = pxElasticQueue->pxNextPoolWaiter;
+                pxElasticQueue->pxNextPoolWaiter = NULL;
+                pxElasticQueue->ucWaitingOnPool = pdFALSE;
+            }
+        }
+
+        if( pxWaitingQueue != NULL )
+        {
+            const int8_t cRxLock = pxWaitingQueue->cRxLock;
+
+            /* This can be called from an interrupt, so a locked queue's event
+             * list is left for the task that unlocks it, as when an interrupt
+             * receives from a locked queue. */
+            if( cRxLock == queueUNLOCKED )
+            {
+                xReturn = xTaskRemoveFromEventList( &( pxWaitingQueue->xTasksWaitingToSend ) );
+            }
+            else
+            {
+                prvIncrementQueueRxLock( pxWaitingQueue, cRxLock );
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvAddPoolWaiter( Queue_t * const pxQueue )
+    {
+        if( ( pxQueue->uxLength > pxQueue->uxInlineLength ) &&
+            ( pxQueue->uxMessagesWaiting < pxQueue->uxLength ) &&
+            ( pxQueue->ucWaitingOnPool == pdFALSE ) )
+        {
+            pxQueue->pxNextPoolWaiter = pxPoolWaitingQueues;
+            pxPoolWaitingQueues = pxQueue;
+            pxQueue->ucWaitingOnPool = pdTRUE;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvAppendToOverflow( Queue_t * const pxQueue,
+                                     const void * pvItemToQueue )
+    {
+        QueueSegment_t * pxSegment;
+
+        if( ( pxQueue->pxOverflowTail == NULL ) || ( pxQueue->uxOverflowWriteIndex >= pxQueue->uxItemsPerSegment ) )
+        {
+            pxSegment = prvBorrowSegment( pxQueue );
+            pxSegment->pxNext = NULL;
+
+            if( pxQueue->pxOverflowTail == NULL )
+            {
+                pxQueue->pxOverflowHead = pxSegment;
+                pxQueue->uxOverflowReadIndex = ( UBaseType_t ) 0U;
+            }
+            else
+            {
+                pxQueue->pxOverflowTail->pxNext = pxSegment;
+            }
+
+            pxQueue->pxOverflowTail = pxSegment;
+            pxQueue->uxOverflowWriteIndex = ( UBaseType_t ) 0U;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        prvCopyOverflowItem( pxQueue, &( pxQueue->pxOverflowTail->ucStorage[ pxQueue->uxOverflowWriteIndex * pxQueue->uxItemSize ] ), pvItemToQueue );
+        pxQueue->uxOverflowWriteIndex++;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvMoveNewestInlineItemToOverflow( Queue_t * const pxQueue )
+    {
+        QueueSegment_t * pxSegment;
+
+        /* The inline storage is full, so the slot before the oldest item,
+         * which pcReadFrom points to, holds the newest inline item.  It
+         * belongs in front of all the overflow items. */
+        if( ( pxQueue->pxOverflowHead == NULL ) || ( pxQueue->uxOverflowReadIndex == ( UBaseType_t ) 0U ) )
+        {
+            pxSegment = prvBorrowSegment( pxQueue );
+            pxSegment->pxNext = pxQueue->pxOverflowHead;
+
+            if( pxQueue->pxOverflowTail == NULL )
+            {
+                pxQueue->pxOverflowTail = pxSegment;
+                pxQueue->uxOverflowWriteIndex = pxQueue->uxItemsPerSegment;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxQueue->pxOverflowHead = pxSegment;
+            pxQueue->uxOverflowReadIndex = pxQueue->uxItemsPerSegment;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        pxQueue->uxOverflowReadIndex--;
+        prvCopyOverflowItem( pxQueue, &( pxQueue->pxOverflowHead->ucStorage[ pxQueue->uxOverflowReadIndex * pxQueue->uxItemSize ] ), pxQueue->u.xQueue.pcReadFrom );
+
+        /* The slot just vacated is where the item sent to the front will be
+         * written, after which the inline storage is full again and the next
+         * write position is the new oldest item. */
+        pxQueue->pcWriteTo = pxQueue->u.xQueue.pcReadFrom;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvRefillFromOverflow( Queue_t * const pxQueue )
+    {
+        QueueSegment_t * const pxSegment = pxQueue->pxOverflowHead;
+        BaseType_t xReturn = pdFALSE;
+
+        if( pxSegment != NULL )
+        {
+            /* The inline storage was full, so the slot just read from is the
+             * next write position. */
+            prvCopyOverflowItem( pxQueue, pxQueue->pcWriteTo, &( pxSegment->ucStorage[ pxQueue->uxOverflowReadIndex * pxQueue->uxItemSize ] ) );
+            pxQueue->pcWriteTo += pxQueue->uxItemSize; /*lint !e9016 Pointer arithmetic on char types ok. */
+
+            if( pxQueue->pcWriteTo >= pxQueue->u.xQueue.pcTail ) /*lint !e946 MISRA exception justified as comparison of pointers is the cleanest solution. */
+            {
+                pxQueue->pcWriteTo = pxQueue->pcHead;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxQueue->uxOverflowReadIndex++;
+
+            if( ( ( pxSegment == pxQueue->pxOverflowTail ) && ( pxQueue->uxOverflowReadIndex == pxQueue->uxOverflowWriteIndex ) ) ||
+                ( pxQueue->uxOverflowReadIndex == pxQueue->uxItemsPerSegment ) )
+            {
+                /* The segment has drained, so give it back to the pool. */
+                pxQueue->pxOverflowHead = pxSegment->pxNext;
+                pxQueue->uxOverflowReadIndex = ( UBaseType_t ) 0U;
+
+                if( pxQueue->pxOverflowHead == NULL )
+                {
+                    pxQueue->pxOverflowTail = NULL;
+                    pxQueue->uxOverflowWriteIndex = ( UBaseType_t ) 0U;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                xReturn = prvReturnSegment( pxQueue, pxSegment );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvReleaseOverflowSegments( Queue_t * const pxQueue )
+    {
+        QueueSegment_t * pxSegment;
+        BaseType_t xReturn = pdFALSE;
+
+        while( pxQueue->pxOverflowHead != NULL )
+        {
+            pxSegment = pxQueue->pxOverflowHead;
+            pxQueue->pxOverflowHead = pxSegment->pxNext;
+
+            if( prvReturnSegment( pxQueue, pxSegment ) != pdFALSE )
+            {
+                xReturn = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        pxQueue->pxOverflowTail = NULL;
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+        QueueHandle_t xQueueCreateElastic( const UBaseType_t uxInlineLength,
+                                           const UBaseType_t uxMaxLength,
+                                           const UBaseType_t uxItemSize )
+        {
+            Queue_t * pxNewQueue;
+            UBaseType_t uxSegment;
+
+            configASSERT( uxInlineLength > ( UBaseType_t ) 0U );
+            configASSERT( uxMaxLength > uxInlineLength );
+
+            /* Elastic queues hold data, and each overflow segment must be able
+             * to hold at least one item. */
+            configASSERT( uxItemSize > ( UBaseType_t ) 0U );
+            configASSERT( uxItemSize <= ( UBaseType_t ) configQUEUE_ELASTIC_SEGMENT_SIZE );
+
+            /* Only the inline storage is allocated with the queue. */
+            pxNewQueue = xQueueGenericCreate( uxInlineLength, uxItemSize, queueQUEUE_TYPE_BASE );
+
+            if( pxNewQueue != NULL )
+            {
+                taskENTER_CRITICAL();
+                {
+                    if( xQueueSegmentPoolInitialised == pdFALSE )
+                    {
+                        for( uxSegment = ( UBaseType_t ) 0U; uxSegment < ( UBaseType_t ) configQUEUE_ELASTIC_POOL_SEGMENTS; uxSegment++ )
+                        {
+                            ( void ) prvReturnSegment( NULL, &( xQueueSegmentPool[ uxSegment ] ) );
+                        }
+
+                        xQueueSegmentPoolInitialised = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    /* Items beyond the inline length go into overflow
+                     * segments. */
+                    pxNewQueue->uxLength = uxMaxLength;
+                    pxNewQueue->uxItemsPerSegment = ( UBaseType_t ) configQUEUE_ELASTIC_SEGMENT_SIZE / uxItemSize;
+
+                }
+                taskEXIT_CRITICAL();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            return pxNewQueue;
+        }
+
+    #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+    UBaseType_t uxQueueGetGrowCount( const QueueHandle_t xQueue )
+    {
+        UBaseType_t uxReturn;
+
+        configASSERT( xQueue );
+        uxReturn = ( ( Queue_t * ) xQueue )->uxGrowCount;
+
+        return uxReturn;
+    } /*lint !e818 Pointer cannot be declared const as xQueue is a typedef not pointer. */
+/*-----------------------------------------------------------*/
+
+    UBaseType_t uxQueueGetFreeSegmentCount( void )
+    {
+        return uxFreeQueueSegments;
+    }
+
+#endif /* configUSE_QUEUE_ELASTIC */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_SINGLE_CRITICAL_BLOCKING == 1 )
+
+    static BaseType_t prvCheckForTimeOutWithinCritical( TimeOut_t * const pxTimeOut,
+                                                        TickType_t * const pxTicksToWait,
+                                                        BaseType_t * const pxEntryTimeSet )
+    {
+        BaseType_t xReturn;
+
+        if( *pxEntryTimeSet == pdFALSE )
+        {
+            /* First time round, so configure the timeout structure ready to
+             * block for the full block time. */
+            vTaskInternalSetTimeOutState( pxTimeOut );
+            *pxEntryTimeSet = pdTRUE;
+            xReturn = pdFALSE;
+        }
+        else
+        {
+            /* xTaskCheckForTimeOut() nests its own critical section, which is
+             * safe as critical sections on this port are counted. */
+            xReturn = xTaskCheckForTimeOut( pxTimeOut, pxTicksToWait );
+        }
+
+        return xReturn;
+    }
+
+#endif /* configUSE_QUEUE_SINGLE_CRITICAL_BLOCKING */
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvIsQueueEmpty( const Queue_t * pxQueue )
+{
+    BaseType_t xReturn;
+
+    taskENTER_CRITICAL();
+    {
+        if( pxQueue->uxMessagesWaiting == ( UBaseType_t ) 0 )
+        {
+            xReturn = pdTRUE;
+        }
+        else
+        {
+            xReturn = pdFALSE;
+        }
+    }
+    taskEXIT_CRITICAL();
 
     return xReturn;
 }
@@ -2437,14 +3531,24 @@ BaseType_t xQueueIsQueueEmptyFromISR( const QueueHandle_t xQueue )
 } /*lint !e818 xQueue could not be pointer to const because it is a typedef. */
 /*-----------------------------------------------------------*/
 
-static BaseType_t prvIsQueueFull( const Queue_t * pxQueue )
+static BaseType_t prvIsQueueFull( Queue_t * const pxQueue,
+                                  const BaseType_t xPosition )
 {
     BaseType_t xReturn;
 
     taskENTER_CRITICAL();
     {
-        if( pxQueue->uxMessagesWaiting == pxQueue->uxLength )
+        if( prvQueueHasRoom( pxQueue, xPosition ) == pdFALSE )
         {
+            #if ( configUSE_QUEUE_ELASTIC == 1 )
+            {
+                /* Registered in the same critical section as the check, and
+                 * the queue is locked until the calling task is on the event
+                 * list, so a segment returned in between is not missed. */
+                prvAddPoolWaiter( pxQueue );
+            }
+            #endif
+
             xReturn = pdTRUE;
         }
         else
@@ -2465,14 +3569,30 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
 
     configASSERT( pxQueue );
 
-    if( pxQueue->uxMessagesWaiting == pxQueue->uxLength )
+    #if ( configUSE_QUEUE_ELASTIC == 1 )
     {
-        xReturn = pdTRUE;
+        UBaseType_t uxSavedInterruptStatus;
+
+        /* An elastic queue is also full while the shared segment pool is
+         * exhausted, as then a send would fail. */
+        uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            xReturn = ( prvQueueHasRoom( pxQueue, queueSEND_TO_BACK ) == pdFALSE ) ? pdTRUE : pdFALSE;
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
     }
-    else
+    #else
     {
-        xReturn = pdFALSE;
+        if( pxQueue->uxMessagesWaiting == pxQueue->uxLength )
+        {
+            xReturn = pdTRUE;
+        }
+        else
+        {
+            xReturn = pdFALSE;
+        }
     }
+    #endif /* configUSE_QUEUE_ELASTIC */
 
     return xReturn;
 } /*lint !e818 xQueue could not be pointer to const because it is a typedef. */
@@ -2492,7 +3612,7 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
          * between the check to see if the queue is full and blocking on the queue. */
         portDISABLE_INTERRUPTS();
         {
-            if( prvIsQueueFull( pxQueue ) != pdFALSE )
+            if( prvIsQueueFull( pxQueue, queueSEND_TO_BACK ) != pdFALSE )
             {
                 /* The queue is full - do we want to block or just leave without
                  * posting? */
@@ -2613,7 +3733,7 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
                 }
 
                 --( pxQueue->uxMessagesWaiting );
-                ( void ) memcpy( ( void * ) pvBuffer, ( void * ) pxQueue->u.xQueue.pcReadFrom, ( unsigned ) pxQueue->uxItemSize );
+                portMEMCPY( ( void * ) pvBuffer, ( void * ) pxQueue->u.xQueue.pcReadFrom, ( unsigned ) pxQueue->uxItemSize );
 
                 xReturn = pdPASS;
 
@@ -2727,7 +3847,7 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
             }
 
             --( pxQueue->uxMessagesWaiting );
-            ( void ) memcpy( ( void * ) pvBuffer, ( void * ) pxQueue->u.xQueue.pcReadFrom, ( unsigned ) pxQueue->uxItemSize );
+            portMEMCPY( ( void * ) pvBuffer, ( void * ) pxQueue->u.xQueue.pcReadFrom, ( unsigned ) pxQueue->uxItemSize );
 
             if( ( *pxCoRoutineWoken ) == pdFALSE )
             {
@@ -910,7 +910,9 @@ UBaseType_t uxQueueMessagesWaiting( const QueueHandle_t xQueue ) PRIVILEGED_FUNC
  *
  * Return the number of free spaces available in a queue.  This is equal to the
  * number of items that can be sent to the queue before the queue becomes full
- * if no items are removed.
+ * if no items are removed.  For an elastic queue the count only includes the
+ * overflow segments currently free in the shared pool, which other elastic
+ * queues can also borrow.
  *
  * @param xQueue A handle to the queue being queried.
  *
@@ -1701,6 +1703,62 @@ QueueSetMemberHandle_t xQueueSelectFromSet( QueueSetHandle_t xQueueSet,
  */
 QueueSetMemberHandle_t xQueueSelectFromSetFromISR( QueueSetHandle_t xQueueSet ) PRIVILEGED_FUNCTION;
 
+/*
+ * Creates an elastic queue.  An elastic queue only allocates storage for
+ * uxInlineLength items when it is created.  While more items than that are
+ * queued, up to a total of uxMaxLength, the extra items are held in overflow
+ * segments borrowed from a pool that is shared by all elastic queues, and the
+ * segments are returned to the pool as the queue drains.  Items are still
+ * received in FIFO order, and tasks block on an elastic queue exactly as they
+ * do on any other queue.
+ *
+ * If the shared pool is exhausted the queue is treated as full until either
+ * a segment becomes free or items are received from it.  A segment returned
+ * to the pool by any elastic queue wakes the highest priority task blocked
+ * sending to another elastic queue that is below its maximum length.  Finding
+ * that task takes time proportional to the number of elastic queues with
+ * senders blocked on the exhausted pool, with interrupts masked.
+ *
+ * configUSE_QUEUE_ELASTIC must be set to 1 in FreeRTOSConfig.h for
+ * xQueueCreateElastic() to be available.  The size and number of overflow
+ * segments are set by configQUEUE_ELASTIC_SEGMENT_SIZE and
+ * configQUEUE_ELASTIC_POOL_SEGMENTS.  Elastic queues cannot be used from
+ * co-routines.
+ *
+ * @param uxInlineLength The number of items held without borrowing overflow
+ * segments.
+ *
+ * @param uxMaxLength The maximum number of items the queue can hold.  Must be
+ * greater than uxInlineLength.
+ *
+ * @param uxItemSize The size in bytes of each item.  Must be greater than 0 and
+ * no greater than configQUEUE_ELASTIC_SEGMENT_SIZE.
+ *
+ * @return The handle of the created queue, or NULL if the inline storage could
+ * not be allocated.
+ */
+#if ( ( configUSE_QUEUE_ELASTIC == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+    QueueHandle_t xQueueCreateElastic( const UBaseType_t uxInlineLength,
+                                       const UBaseType_t uxMaxLength,
+                                       const UBaseType_t uxItemSize ) PRIVILEGED_FUNCTION;
+#endif
+
+/*
+ * Returns the number of times xQueue has borrowed an overflow segment from the
+ * shared pool since it was created.
+ */
+#if ( configUSE_QUEUE_ELASTIC == 1 )
+    UBaseType_t uxQueueGetGrowCount( const QueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
+#endif
+
+/*
+ * Returns the number of overflow segments not currently borrowed by any
+ * elastic queue.
+ */
+#if ( configUSE_QUEUE_ELASTIC == 1 )
+    UBaseType_t uxQueueGetFreeSegmentCount( void ) PRIVILEGED_FUNCTION;
+#endif
+
 /* Not public API functions. */
 void vQueueWaitForMessageRestricted( QueueHandle_t xQueue,
                                      TickType_t xTicksToWait,
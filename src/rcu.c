@@ -0,0 +1,250 @@
+/*
+ * FreeRTOS Kernel V10.5.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers.  That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "rcu.h"
+
+/* Lint e961, e750 and e9021 are suppressed as a MISRA exception justified
+ * because the MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750 !e9021 See comment above. */
+
+/* This entire source file will be skipped if the application is not configured
+ * to include RCU functionality.  This #if is closed at the very bottom of this
+ * file. */
+#if ( configUSE_RCU == 1 )
+
+    #ifndef configRCU_TASK_NAME
+        #define configRCU_TASK_NAME    "RCU"
+    #endif
+
+/* The reclaimer task checks whether the readers holding up a grace period have
+ * left their sections once per tick. */
+    #define rcuGRACE_PERIOD_POLL_TICKS    ( ( TickType_t ) 1U )
+
+/* Used by vRcuSynchronize() to wait for its own callback. */
+    typedef struct RcuSynchronize
+    {
+        RcuHead_t xHead;              /*< Must be first so the callback can cast back to the structure. */
+        TaskHandle_t xTask;           /*< The task waiting in vRcuSynchronize(). */
+        volatile BaseType_t xElapsed; /*< Set to pdTRUE by the callback. */
+    } RcuSynchronize_t;
+
+/*-----------------------------------------------------------*/
+
+/* Callbacks waiting for the next grace period to start, oldest first.  Only
+ * accessed from within a critical section. */
+    PRIVILEGED_DATA static RcuHead_t * pxPendingHead = NULL;
+    PRIVILEGED_DATA static RcuHead_t ** ppxPendingTail = &pxPendingHead;
+
+    PRIVILEGED_DATA static TaskHandle_t xReclaimerTaskHandle = NULL;
+    PRIVILEGED_DATA static volatile uint32_t ulCompletedGracePeriods = 0UL;
+
+    #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+        PRIVILEGED_DATA static StaticTask_t xReclaimerTaskBuffer;
+        PRIVILEGED_DATA static StackType_t uxReclaimerTaskStack[ configRCU_TASK_STACK_DEPTH ];
+    #endif
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The RCU reclaimer task.  Runs each batch of queued callbacks once a grace
+ * period that started after they were queued has elapsed.
+ */
+    static portTASK_FUNCTION_PROTO( prvReclaimerTask, pvParameters ) PRIVILEGED_FUNCTION;
+
+/*
+ * The callback queued by vRcuSynchronize().
+ */
+    static void prvWakeSynchronizer( RcuHead_t * pxHead ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+    BaseType_t xRcuCreateReclaimerTask( void )
+    {
+        BaseType_t xReturn = pdFAIL;
+
+        #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+        {
+            xReclaimerTaskHandle = xTaskCreateStatic( prvReclaimerTask,
+                                                      configRCU_TASK_NAME,
+                                                      ( uint32_t ) configRCU_TASK_STACK_DEPTH,
+                                                      NULL,
+                                                      ( ( UBaseType_t ) configRCU_TASK_PRIORITY ) | portPRIVILEGE_BIT,
+                                                      uxReclaimerTaskStack,
+                                                      &xReclaimerTaskBuffer );
+
+            if( xReclaimerTaskHandle != NULL )
+            {
+                xReturn = pdPASS;
+            }
+        }
+        #else /* if ( configSUPPORT_STATIC_ALLOCATION == 1 ) */
+        {
+            xReturn = xTaskCreate( prvReclaimerTask,
+                                   configRCU_TASK_NAME,
+                                   configRCU_TASK_STACK_DEPTH,
+                                   NULL,
+                                   ( ( UBaseType_t ) configRCU_TASK_PRIORITY ) | portPRIVILEGE_BIT,
+                                   &xReclaimerTaskHandle );
+        }
+        #endif /* configSUPPORT_STATIC_ALLOCATION */
+
+        configASSERT( xReturn );
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    void vRcuCall( RcuHead_t * const pxHead,
+                   RcuCallbackFunction_t pxCallback )
+    {
+        configASSERT( pxHead );
+        configASSERT( pxCallback );
+
+        pxHead->pxNext = NULL;
+        pxHead->pxCallback = pxCallback;
+
+        taskENTER_CRITICAL();
+        {
+            *ppxPendingTail = pxHead;
+            ppxPendingTail = &( pxHead->pxNext );
+        }
+        taskEXIT_CRITICAL();
+
+        /* The reclaimer task checks for callbacks when it starts, so there is
+         * nothing to notify before the scheduler has been started. */
+        if( xReclaimerTaskHandle != NULL )
+        {
+            ( void ) xTaskNotifyGive( xReclaimerTaskHandle );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    void vRcuSynchronize( void )
+    {
+        RcuSynchronize_t xSynchronize;
+
+        xSynchronize.xTask = xTaskGetCurrentTaskHandle();
+        xSynchronize.xElapsed = pdFALSE;
+
+        vRcuCall( &( xSynchronize.xHead ), prvWakeSynchronizer );
+
+        /* Loop in case the notification was given for another reason. */
+        while( xSynchronize.xElapsed == pdFALSE )
+        {
+            ( void ) ulTaskNotifyTakeIndexed( configRCU_SYNCHRONIZE_NOTIFY_INDEX, pdTRUE, portMAX_DELAY );
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    uint32_t ulRcuGetCompletedGracePeriods( void )
+    {
+        return ulCompletedGracePeriods;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvWakeSynchronizer( RcuHead_t * pxHead )
+    {
+        RcuSynchronize_t * const pxSynchronize = ( RcuSynchronize_t * ) pxHead;
+        const TaskHandle_t xTask = pxSynchronize->xTask;
+
+        /* pxSynchronize is on the stack of the waiting task, so must not be
+         * accessed once xElapsed is set. */
+        pxSynchronize->xElapsed = pdTRUE;
+        ( void ) xTaskNotifyGiveIndexed( xTask, configRCU_SYNCHRONIZE_NOTIFY_INDEX );
+    }
+/*-----------------------------------------------------------*/
+
+    static portTASK_FUNCTION( prvReclaimerTask, pvParameters )
+    {
+        RcuHead_t * pxBatch;
+        RcuHead_t * pxNext;
+        UBaseType_t uxPhase;
+
+        /* Just to avoid compiler warnings. */
+        ( void ) pvParameters;
+
+        for( ; ; )
+        {
+            /* Take every callback queued so far.  They all wait for the same
+             * grace period. */
+            taskENTER_CRITICAL();
+            {
+                pxBatch = pxPendingHead;
+                pxPendingHead = NULL;
+                ppxPendingTail = &pxPendingHead;
+            }
+            taskEXIT_CRITICAL();
+
+            if( pxBatch == NULL )
+            {
+                /* Wait for vRcuCall() to queue a callback. */
+                ( void ) ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+            }
+            else
+            {
+                /* Nothing can have read an unpublished pointer after this
+                 * point, so once every reader that is inside a section now has
+                 * left it the old data is no longer referenced. */
+                uxPhase = uxTaskRcuStartGracePeriod();
+
+                while( xTaskRcuGracePeriodElapsed( uxPhase ) == pdFALSE )
+                {
+                    vTaskDelay( rcuGRACE_PERIOD_POLL_TICKS );
+                }
+
+                ulCompletedGracePeriods++;
+
+                while( pxBatch != NULL )
+                {
+                    /* The callback may free the structure holding pxNext. */
+                    pxNext = pxBatch->pxNext;
+                    pxBatch->pxCallback( pxBatch );
+                    pxBatch = pxNext;
+                }
+            }
+        }
+    }
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+ * to include RCU functionality.  If you want to include RCU functionality then
+ * ensure configUSE_RCU is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_RCU == 1 */
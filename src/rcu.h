@@ -0,0 +1,280 @@
+/*
+ * FreeRTOS Kernel V10.5.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+#ifndef RCU_H
+#define RCU_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h" must appear in source files before "include rcu.h"
+#endif
+
+/* FreeRTOS includes. */
+#include "task.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * RCU (read-copy-update) protects read-mostly data that is reached through a
+ * pointer, such as a routing table.  Readers enter a read-side critical section
+ * with vRcuReadLock(), read the pointer with pvRcuDereference(), and leave with
+ * vRcuReadUnlock().  Entering and leaving a section only writes to the TCB of
+ * the calling task, so readers never contend with each other or with writers.
+ *
+ * A writer builds a new version of the data, publishes it with
+ * vRcuAssignPointer(), and then frees the old version once a grace period has
+ * elapsed - that is once every task that was inside a read-side critical
+ * section when the pointer was published has left it.  The old version can be
+ * freed in the background with vRcuCall(), or the writer can wait for the grace
+ * period with vRcuSynchronize().  Writers must serialise with each other, for
+ * example with a mutex.
+ *
+ * Grace periods are detected from the tasks the scheduler switches out while
+ * inside a read-side critical section, and callbacks are run by the RCU
+ * reclaimer task, which is created when the scheduler is started.  A reader
+ * can block inside a read-side critical section, but doing so holds up all
+ * reclamation until it leaves.
+ *
+ * configUSE_RCU must be set to 1 in FreeRTOSConfig.h for RCU to be available.
+ * The priority and stack size of the reclaimer task are set by
+ * configRCU_TASK_PRIORITY and configRCU_TASK_STACK_DEPTH.
+ */
+
+struct RcuHead;
+
+/**
+ * rcu.h
+ *
+ * Defines the prototype to which functions passed to vRcuCall() must conform.
+ * The callback is passed the RcuHead_t that was passed to vRcuCall().
+ *
+ * \defgroup RcuCallbackFunction_t RcuCallbackFunction_t
+ * \ingroup RCU
+ */
+typedef void (* RcuCallbackFunction_t)( struct RcuHead * pxHead );
+
+/**
+ * rcu.h
+ *
+ * Embedded in an object that is freed with vRcuCall().  The members are private
+ * to the RCU implementation.
+ *
+ * \defgroup RcuHead_t RcuHead_t
+ * \ingroup RCU
+ */
+typedef struct RcuHead
+{
+    struct RcuHead * pxNext;            /*< The next callback waiting for the same grace period. */
+    RcuCallbackFunction_t pxCallback;   /*< The function called once the grace period has elapsed. */
+} RcuHead_t;
+
+/**
+ * rcu.h
+ * @code{c}
+ * void vRcuReadLock( void );
+ * @endcode
+ *
+ * Enter a read-side critical section.  Sections can be nested, and can be used
+ * from interrupts whose priority is at or below
+ * configMAX_SYSCALL_INTERRUPT_PRIORITY.  Pointers read with pvRcuDereference()
+ * inside the section remain valid until the matching vRcuReadUnlock().
+ *
+ * Example usage:
+ * @code{c}
+ * extern Route_t * pxRoutes;
+ *
+ * uint32_t ulLookup( uint32_t ulAddress )
+ * {
+ *     Route_t * pxTable;
+ *     uint32_t ulPort;
+ *
+ *     vRcuReadLock();
+ *     {
+ *         pxTable = ( Route_t * ) pvRcuDereference( &pxRoutes );
+ *         ulPort = ulFindPort( pxTable, ulAddress );
+ *     }
+ *     vRcuReadUnlock();
+ *
+ *     return ulPort;
+ * }
+ * @endcode
+ *
+ * \defgroup vRcuReadLock vRcuReadLock
+ * \ingroup RCU
+ */
+#define vRcuReadLock()      vTaskRcuReadLock()
+
+/**
+ * rcu.h
+ * @code{c}
+ * void vRcuReadUnlock( void );
+ * @endcode
+ *
+ * Leave a read-side critical section entered with vRcuReadLock().
+ *
+ * \defgroup vRcuReadUnlock vRcuReadUnlock
+ * \ingroup RCU
+ */
+#define vRcuReadUnlock()    vTaskRcuReadUnlock()
+
+/**
+ * rcu.h
+ * @code{c}
+ * void * pvRcuDereference( void * const * ppvPointer );
+ * @endcode
+ *
+ * Read a pointer that is published with vRcuAssignPointer().  Must be called
+ * from within a read-side critical section.
+ *
+ * @param ppvPointer The address of the published pointer.
+ *
+ * @return The current value of the pointer.
+ *
+ * \defgroup pvRcuDereference pvRcuDereference
+ * \ingroup RCU
+ */
+#define pvRcuDereference( ppvPointer )    ( *( ( void * const volatile * ) ( ppvPointer ) ) )
+
+/**
+ * rcu.h
+ * @code{c}
+ * void vRcuAssignPointer( void ** ppvPointer, void * pvValue );
+ * @endcode
+ *
+ * Publish a new version of the data.  Every write made to the new version
+ * before this call is visible to a reader that reads the new pointer.
+ *
+ * @param ppvPointer The address of the published pointer.
+ *
+ * @param pvValue The new version.
+ *
+ * \defgroup vRcuAssignPointer vRcuAssignPointer
+ * \ingroup RCU
+ */
+#define vRcuAssignPointer( ppvPointer, pvValue )                            \
+    do {                                                                    \
+        portMEMORY_BARRIER();                                               \
+        *( ( void * volatile * ) ( ppvPointer ) ) = ( void * ) ( pvValue ); \
+    } while( 0 )
+
+/**
+ * rcu.h
+ * @code{c}
+ * void vRcuCall( RcuHead_t * pxHead, RcuCallbackFunction_t pxCallback );
+ * @endcode
+ *
+ * Arrange for pxCallback to be called from the RCU reclaimer task once a grace
+ * period that starts after this call has elapsed.  The callback normally frees
+ * the object that contains pxHead.  Must not be called from an interrupt.
+ *
+ * Example usage:
+ * @code{c}
+ * typedef struct
+ * {
+ *     RcuHead_t xRcuHead; // First, so the callback can cast back to the table.
+ *     Route_t xRoutes[ 32 ];
+ * } RouteTable_t;
+ *
+ * static void prvFreeTable( RcuHead_t * pxHead )
+ * {
+ *     vPortFree( pxHead );
+ * }
+ *
+ * void vUpdateRoutes( RouteTable_t * pxNew )
+ * {
+ *     RouteTable_t * pxOld;
+ *
+ *     xSemaphoreTake( xRouteWriteMutex, portMAX_DELAY );
+ *     pxOld = pxRoutes;
+ *     vRcuAssignPointer( &pxRoutes, pxNew );
+ *     xSemaphoreGive( xRouteWriteMutex );
+ *
+ *     vRcuCall( &( pxOld->xRcuHead ), prvFreeTable );
+ * }
+ * @endcode
+ *
+ * @param pxHead Storage for the request, normally embedded in the object being
+ * freed.  Must remain valid until the callback has been called.
+ *
+ * @param pxCallback The function to call.
+ *
+ * \defgroup vRcuCall vRcuCall
+ * \ingroup RCU
+ */
+void vRcuCall( RcuHead_t * const pxHead,
+               RcuCallbackFunction_t pxCallback ) PRIVILEGED_FUNCTION;
+
+/**
+ * rcu.h
+ * @code{c}
+ * void vRcuSynchronize( void );
+ * @endcode
+ *
+ * Block until a grace period that starts after this call has elapsed, after
+ * which the calling task can free data it unpublished before the call.  Must
+ * not be called from within a read-side critical section.
+ *
+ * The calling task waits on its task notification at index
+ * configRCU_SYNCHRONIZE_NOTIFY_INDEX, which must not be used for anything else
+ * while this function runs.
+ *
+ * \defgroup vRcuSynchronize vRcuSynchronize
+ * \ingroup RCU
+ */
+void vRcuSynchronize( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * rcu.h
+ * @code{c}
+ * uint32_t ulRcuGetCompletedGracePeriods( void );
+ * @endcode
+ *
+ * @return The number of grace periods that have elapsed since the scheduler
+ * was started.
+ *
+ * \defgroup ulRcuGetCompletedGracePeriods ulRcuGetCompletedGracePeriods
+ * \ingroup RCU
+ */
+uint32_t ulRcuGetCompletedGracePeriods( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * For internal use only.  Called by vTaskStartScheduler() to create the RCU
+ * reclaimer task.
+ */
+BaseType_t xRcuCreateReclaimerTask( void ) PRIVILEGED_FUNCTION;
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* RCU_H */
@@ -241,6 +241,16 @@ typedef struct StreamBufferDef_t                 /*lint !e9058 Style convention
     #endif
 } StreamBuffer_t;
 
+#if ( configUSE_INLINE_KERNEL_QUERIES == 1 )
+
+/* kernel_inline.h reads these members through the layout of
+ * StaticStreamBuffer_t.  Each typedef has a negative array size, so fails to
+ * compile, if a member does not line up. */
+    typedef char sbTAIL_MATCHES_STATIC_STREAM_BUFFER[ ( offsetof( StreamBuffer_t, xTail ) == offsetof( StaticStreamBuffer_t, uxDummy1[ 0 ] ) ) ? 1 : -1 ];
+    typedef char sbHEAD_MATCHES_STATIC_STREAM_BUFFER[ ( offsetof( StreamBuffer_t, xHead ) == offsetof( StaticStreamBuffer_t, uxDummy1[ 1 ] ) ) ? 1 : -1 ];
+    typedef char sbLENGTH_MATCHES_STATIC_STREAM_BUFFER[ ( offsetof( StreamBuffer_t, xLength ) == offsetof( StaticStreamBuffer_t, uxDummy1[ 2 ] ) ) ? 1 : -1 ];
+#endif
+
 /*
  * The number of bytes available to be read from the buffer.
  */
@@ -1261,7 +1271,7 @@ static size_t prvWriteBytesToBuffer( StreamBuffer_t * const pxStreamBuffer,
 
     /* Write as many bytes as can be written in the first write. */
     configASSERT( ( xHead + xFirstLength ) <= pxStreamBuffer->xLength );
-    ( void ) memcpy( ( void * ) ( &( pxStreamBuffer->pucBuffer[ xHead ] ) ), ( const void * ) pucData, xFirstLength ); /*lint !e9087 memcpy() requires void *. */
+    portMEMCPY_DEFERRABLE( ( void * ) ( &( pxStreamBuffer->pucBuffer[ xHead ] ) ), ( const void * ) pucData, xFirstLength ); /*lint !e9087 memcpy() requires void *. */
 
     /* If the number of bytes written was less than the number that could be
      * written in the first write... */
@@ -1269,7 +1279,7 @@ static size_t prvWriteBytesToBuffer( StreamBuffer_t * const pxStreamBuffer,
     {
         /* ...then write the remaining bytes to the start of the buffer. */
         configASSERT( ( xCount - xFirstLength ) <= pxStreamBuffer->xLength );
-        ( void ) memcpy( ( void * ) pxStreamBuffer->pucBuffer, ( const void * ) &( pucData[ xFirstLength ] ), xCount - xFirstLength ); /*lint !e9087 memcpy() requires void *. */
+        portMEMCPY_DEFERRABLE( ( void * ) pxStreamBuffer->pucBuffer, ( const void * ) &( pucData[ xFirstLength ] ), xCount - xFirstLength ); /*lint !e9087 memcpy() requires void *. */
     }
     else
     {
@@ -1309,14 +1319,14 @@ static size_t prvReadBytesFromBuffer( StreamBuffer_t * pxStreamBuffer,
      * read.  Asserts check bounds of read and write. */
     configASSERT( xFirstLength <= xCount );
     configASSERT( ( xTail + xFirstLength ) <= pxStreamBuffer->xLength );
-    ( void ) memcpy( ( void * ) pucData, ( const void * ) &( pxStreamBuffer->pucBuffer[ xTail ] ), xFirstLength ); /*lint !e9087 memcpy() requires void *. */
+    portMEMCPY_DEFERRABLE( ( void * ) pucData, ( const void * ) &( pxStreamBuffer->pucBuffer[ xTail ] ), xFirstLength ); /*lint !e9087 memcpy() requires void *. */
 
     /* If the total number of wanted bytes is greater than the number
      * that could be read in the first read... */
     if( xCount > xFirstLength )
     {
         /* ...then read the remaining bytes from the start of the buffer. */
-        ( void ) memcpy( ( void * ) &( pucData[ xFirstLength ] ), ( void * ) ( pxStreamBuffer->pucBuffer ), xCount - xFirstLength ); /*lint !e9087 memcpy() requires void *. */
+        portMEMCPY_DEFERRABLE( ( void * ) &( pucData[ xFirstLength ] ), ( void * ) ( pxStreamBuffer->pucBuffer ), xCount - xFirstLength ); /*lint !e9087 memcpy() requires void *. */
     }
     else
     {
@@ -0,0 +1,165 @@
+/*
+ * FreeRTOS Kernel V10.5.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers.  That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "swi.h"
+
+/* Lint e961, e750 and e9021 are suppressed as a MISRA exception justified
+ * because the MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750 !e9021 See comment above. */
+
+/* This entire source file will be skipped if the application is not configured
+ * to include SWI functionality.  This #if is closed at the very bottom of this
+ * file. */
+#if ( configUSE_SWI == 1 )
+
+/* The definition of an SWI created with xSwiCreate(). */
+    typedef struct SwiDefinition
+    {
+        SwiFunction_t pxFunction;    /*< The function to run, or NULL if the SWI has not been created. */
+        void * pvParameter;          /*< Passed to pxFunction. */
+        uint32_t ulPostCount;        /*< Posts since the function last ran.  Only accessed atomically. */
+    } Swi_t;
+
+/*-----------------------------------------------------------*/
+
+    PRIVILEGED_DATA static Swi_t xSwis[ configSWI_MAX_PRIORITIES ];
+
+/* Bit n is set while the SWI at priority n is pending.  Only accessed
+ * atomically, so posting needs no critical section. */
+    PRIVILEGED_DATA static uint32_t ulPendingSwis = 0UL;
+
+/*-----------------------------------------------------------*/
+
+    BaseType_t xSwiCreate( UBaseType_t uxPriority,
+                           SwiFunction_t pxFunction,
+                           void * pvParameter )
+    {
+        BaseType_t xReturn = pdFAIL;
+
+        configASSERT( pxFunction );
+
+        if( uxPriority < ( UBaseType_t ) configSWI_MAX_PRIORITIES )
+        {
+            taskENTER_CRITICAL();
+            {
+                if( xSwis[ uxPriority ].pxFunction == NULL )
+                {
+                    xSwis[ uxPriority ].pvParameter = pvParameter;
+                    xSwis[ uxPriority ].ulPostCount = 0UL;
+                    xSwis[ uxPriority ].pxFunction = pxFunction;
+                    xReturn = pdPASS;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            taskEXIT_CRITICAL();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    void vSwiPost( UBaseType_t uxPriority )
+    {
+        configASSERT( uxPriority < ( UBaseType_t ) configSWI_MAX_PRIORITIES );
+        configASSERT( xSwis[ uxPriority ].pxFunction != NULL );
+
+        /* Count the post before marking the SWI pending, so the dispatcher
+         * always sees at least this post once it sees the pending bit. */
+        ( void ) __atomic_fetch_add( &( xSwis[ uxPriority ].ulPostCount ), 1UL, __ATOMIC_RELAXED );
+        ( void ) __atomic_fetch_or( &ulPendingSwis, ( uint32_t ) 1UL << uxPriority, __ATOMIC_RELEASE );
+
+        /* SWIs are run from the PendSV handler. */
+        portYIELD();
+    }
+/*-----------------------------------------------------------*/
+
+    void vSwiDispatch( void )
+    {
+        uint32_t ulPending;
+        uint32_t ulPostCount;
+        UBaseType_t uxPriority;
+        Swi_t * pxSwi;
+
+        for( ; ; )
+        {
+            ulPending = __atomic_load_n( &ulPendingSwis, __ATOMIC_ACQUIRE );
+
+            if( ulPending == 0UL )
+            {
+                break;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            /* Run the highest priority pending SWI.  SWIs posted while it runs
+             * are picked up on the next pass. */
+            uxPriority = ( UBaseType_t ) ( 31U - ( UBaseType_t ) __builtin_clz( ulPending ) );
+            ( void ) __atomic_fetch_and( &ulPendingSwis, ~( ( uint32_t ) 1UL << uxPriority ), __ATOMIC_ACQ_REL );
+
+            pxSwi = &( xSwis[ uxPriority ] );
+
+            /* A post made after the pending bit was cleared is counted here
+             * and then sets the bit again, in which case the SWI is seen
+             * pending next time with no posts outstanding. */
+            ulPostCount = __atomic_exchange_n( &( pxSwi->ulPostCount ), 0UL, __ATOMIC_ACQ_REL );
+
+            if( ulPostCount != 0UL )
+            {
+                pxSwi->pxFunction( pxSwi->pvParameter, ulPostCount );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+    }
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+ * to include SWI functionality.  If you want to include SWI functionality then
+ * ensure configUSE_SWI is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_SWI == 1 */
@@ -0,0 +1,160 @@
+/*
+ * FreeRTOS Kernel V10.5.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+#ifndef SWI_H
+#define SWI_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h" must appear in source files before "include swi.h"
+#endif
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * Software interrupts (SWIs) are prioritised, run-to-completion functions that
+ * sit between interrupt service routines and tasks.  An interrupt posts an SWI
+ * to defer the bulk of its work, and the SWI runs in the PendSV handler before
+ * the kernel returns to a task - so ahead of every task, but preemptible by
+ * every hardware interrupt.  SWIs run on the main (interrupt) stack, so they
+ * need no stack of their own and no context switch, but they must not block.
+ *
+ * Each SWI has a priority of its own between 0 and
+ * ( configSWI_MAX_PRIORITIES - 1 ), with higher numbers running first.  An SWI
+ * runs to completion before the next one is started, so an SWI posted while
+ * another is running waits for it even if it has the higher priority.  Posting
+ * an SWI that is already pending does not run it twice; the function is told
+ * how many times it was posted instead.
+ *
+ * An SWI function can call the API functions that end in "FromISR".  The
+ * context switch a woken task needs is performed when the SWIs have run, so the
+ * pxHigherPriorityTaskWoken parameter can be NULL.
+ *
+ * configUSE_SWI must be set to 1 in FreeRTOSConfig.h for SWIs to be available.
+ * The main stack must be large enough for the deepest SWI function in addition
+ * to the nested interrupts.
+ */
+
+/**
+ * swi.h
+ *
+ * Defines the prototype to which SWI functions must conform.
+ *
+ * @param pvParameter The value passed to xSwiCreate().
+ *
+ * @param ulPostCount The number of times the SWI was posted since it last ran.
+ *
+ * \defgroup SwiFunction_t SwiFunction_t
+ * \ingroup SWI
+ */
+typedef void (* SwiFunction_t)( void * pvParameter,
+                                uint32_t ulPostCount );
+
+/**
+ * swi.h
+ * @code{c}
+ * BaseType_t xSwiCreate( UBaseType_t uxPriority, SwiFunction_t pxFunction, void * pvParameter );
+ * @endcode
+ *
+ * Create the SWI that runs at uxPriority.  Must be called from a task, or
+ * before the scheduler is started, and before the SWI is first posted.
+ *
+ * Example usage:
+ * @code{c}
+ * #define mainUART_SWI_PRIORITY    3
+ *
+ * static void prvUartSwi( void * pvParameter, uint32_t ulPostCount )
+ * {
+ *     // Drain the receive ring filled by the interrupt and wake the
+ *     // consumer task.
+ *     vParseReceivedBytes();
+ *     vTaskNotifyGiveFromISR( xConsumerTask, NULL );
+ * }
+ *
+ * void UART_IRQHandler( void )
+ * {
+ *     vCopyBytesToRing();
+ *     vSwiPost( mainUART_SWI_PRIORITY );
+ * }
+ *
+ * void vSetup( void )
+ * {
+ *     xSwiCreate( mainUART_SWI_PRIORITY, prvUartSwi, NULL );
+ * }
+ * @endcode
+ *
+ * @param uxPriority The priority of the SWI, which also identifies it.
+ *
+ * @param pxFunction The function run when the SWI is posted.
+ *
+ * @param pvParameter Passed to pxFunction each time it runs.
+ *
+ * @return pdPASS if the SWI was created, or pdFAIL if uxPriority is out of
+ * range or already used by another SWI.
+ *
+ * \defgroup xSwiCreate xSwiCreate
+ * \ingroup SWI
+ */
+BaseType_t xSwiCreate( UBaseType_t uxPriority,
+                       SwiFunction_t pxFunction,
+                       void * pvParameter ) PRIVILEGED_FUNCTION;
+
+/**
+ * swi.h
+ * @code{c}
+ * void vSwiPost( UBaseType_t uxPriority );
+ * @endcode
+ *
+ * Post the SWI that runs at uxPriority, so that it runs before the kernel next
+ * returns to a task.  Posting does not use a critical section, so this can be
+ * called from a task or from an interrupt of any priority, including those
+ * above configMAX_SYSCALL_INTERRUPT_PRIORITY.
+ *
+ * @param uxPriority The priority the SWI was created with.
+ *
+ * \defgroup vSwiPost vSwiPost
+ * \ingroup SWI
+ */
+void vSwiPost( UBaseType_t uxPriority ) PRIVILEGED_FUNCTION;
+
+/*
+ * For internal use only.  Called by the port from the PendSV handler, with
+ * interrupts enabled, to run the pending SWIs.
+ */
+void vSwiDispatch( void ) PRIVILEGED_FUNCTION;
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* SWI_H */
@@ -86,6 +86,41 @@
 struct tskTaskControlBlock; /* The old naming convention is used to prevent breaking kernel aware debuggers. */
 typedef struct tskTaskControlBlock * TaskHandle_t;
 
+/**
+ * task. h
+ *
+ * Type by which task groups are referenced.  For example, a call to
+ * xTaskGroupCreate() returns a TaskGroupHandle_t variable that can then be
+ * passed to vTaskGroupAddTask() and vTaskGroupSuspend().
+ *
+ * \defgroup TaskGroupHandle_t TaskGroupHandle_t
+ * \ingroup TaskGroups
+ */
+struct tskTaskGroup;
+typedef struct tskTaskGroup * TaskGroupHandle_t;
+
+/**
+ * task. h
+ *
+ * Type by which deadline timers are referenced.  For example, a call to
+ * xTaskDeadlineTimerInit() returns a DeadlineTimerHandle_t variable that can
+ * then be passed to vTaskDeadlineTimerStart().
+ *
+ * \defgroup DeadlineTimerHandle_t DeadlineTimerHandle_t
+ * \ingroup DeadlineTimers
+ */
+struct tskDeadlineTimer;
+typedef struct tskDeadlineTimer * DeadlineTimerHandle_t;
+
+/*
+ * Defines the prototype to which deadline timer callback functions must
+ * conform.  The callback runs in the tick interrupt, so it can only use API
+ * functions that end in FromISR, and sets *pxHigherPriorityTaskWoken as they
+ * do.
+ */
+typedef void (* DeadlineTimerCallback_t)( DeadlineTimerHandle_t xTimer,
+                                          BaseType_t * pxHigherPriorityTaskWoken );
+
 /*
  * Defines the prototype to which the application task hook function must
  * conform.
@@ -168,6 +203,50 @@ typedef struct xTASK_STATUS
     configSTACK_DEPTH_TYPE usStackHighWaterMark;  /* The minimum amount of stack space that has remained for the task since the task was created.  The closer this value is to zero the closer the task has come to overflowing its stack. */
 } TaskStatus_t;
 
+/* One entry of the schedule table passed to vTaskStartTimeTriggeredSchedule(). */
+typedef struct xTIME_TRIGGERED_SLOT
+{
+    TickType_t xOffset; /* The tick within the major frame at which the slot releases its task. */
+    TickType_t xBudget; /* The most ticks the task may run for once released before waiting for its next slot, or 0 if the slot has no budget. */
+} TimeTriggeredSlot_t;
+
+/* Used with the vTaskGetSlotStats() function to return the statistics of one
+ * slot of the time triggered schedule. */
+typedef struct xTIME_TRIGGERED_SLOT_STATS
+{
+    uint32_t ulReleases;          /* The number of times the slot released its task. */
+    uint32_t ulMissedReleases;    /* The number of times the slot fell due while its task was not waiting for it, normally because the task was still running its previous slot. */
+    uint32_t ulOverruns;          /* The number of times the task ran beyond the slot's budget before waiting for its next slot. */
+    uint32_t ulMinReleaseLatency; /* The shortest time, in cycles, from the tick that released the slot to the task running. */
+    uint32_t ulMaxReleaseLatency; /* The longest time, in cycles, from the tick that released the slot to the task running. */
+    uint32_t ulReleaseJitter;     /* ulMaxReleaseLatency minus ulMinReleaseLatency. */
+} TimeTriggeredSlotStats_t;
+
+/* One entry of the window table passed to vTaskStartPartitionSchedule(). */
+typedef struct xPARTITION_WINDOW
+{
+    UBaseType_t uxPartition; /* The partition whose tasks run during the window. */
+    TickType_t xDuration;    /* The length of the window in ticks. */
+} PartitionWindow_t;
+
+/* Used with the vTaskGetPartitionStats() function to return the statistics of
+ * one temporal partition. */
+typedef struct xPARTITION_STATS
+{
+    uint32_t ulWindowTicks; /* The number of ticks for which the partition's windows have been open. */
+    uint32_t ulRunTicks;    /* The number of ticks on which a task of the partition, other than the idle task, was running. */
+    uint32_t ulSlackTicks;  /* The number of ticks of the partition's windows that were given to the background partition because none of the partition's tasks were ready. */
+} PartitionStats_t;
+
+/* Used with the vTaskGetStackTierStats() function to return how often stacks
+ * have been moved between fast and slow memory. */
+typedef struct xSTACK_TIER_STATS
+{
+    uint32_t ulLoads;      /* The number of times a stack was copied into its slot when its task was switched in. */
+    uint32_t ulEvictions;  /* The number of times a stack was copied out of a slot by a context switch to make room for another. */
+    uint32_t ulWriteBacks; /* The number of times the idle task copied a stack out of a slot after its task had not run for configSTACK_TIER_WRITE_BACK_TICKS. */
+} StackTierStats_t;
+
 /* Possible return values for eTaskConfirmSleepModeStatus(). */
 typedef enum
 {
@@ -1223,6 +1302,789 @@ void vTaskResume( TaskHandle_t xTaskToResume ) PRIVILEGED_FUNCTION;
  */
 BaseType_t xTaskResumeFromISR( TaskHandle_t xTaskToResume ) PRIVILEGED_FUNCTION;
 
+/*-----------------------------------------------------------
+* TASK GROUPS
+*----------------------------------------------------------*/
+
+/**
+ * task. h
+ * @code{c}
+ * TaskGroupHandle_t xTaskGroupCreate( void );
+ * @endcode
+ *
+ * configUSE_TASK_GROUPS and configSUPPORT_DYNAMIC_ALLOCATION must both be set
+ * to 1 for this function to be available.
+ *
+ * Create a new, empty task group.  The memory used to hold the group is
+ * allocated with pvPortMalloc().  Tasks are added to the group with
+ * vTaskGroupAddTask(), after which the members can be suspended, resumed or
+ * have their priority changed together.  Each group operation updates every
+ * member within one critical section and makes a single scheduling decision
+ * at the end, so other tasks never run while the group is part way through a
+ * change.
+ *
+ * @return A handle to the created group, or NULL if there was insufficient
+ * heap available.
+ *
+ * Example usage:
+ * @code{c}
+ * TaskGroupHandle_t xAcquisitionGroup;
+ *
+ * void vEnterStandbyMode( void )
+ * {
+ *   // Stop every acquisition task before any of them can run again.
+ *   vTaskGroupSuspend( xAcquisitionGroup );
+ * }
+ *
+ * void vEnterRunMode( void )
+ * {
+ *   vTaskGroupResume( xAcquisitionGroup );
+ * }
+ *
+ * void vSetup( TaskHandle_t xSampler, TaskHandle_t xFilter )
+ * {
+ *   xAcquisitionGroup = xTaskGroupCreate();
+ *   vTaskGroupAddTask( xAcquisitionGroup, xSampler );
+ *   vTaskGroupAddTask( xAcquisitionGroup, xFilter );
+ * }
+ * @endcode
+ * \defgroup xTaskGroupCreate xTaskGroupCreate
+ * \ingroup TaskGroups
+ */
+#if ( ( configUSE_TASK_GROUPS == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+    TaskGroupHandle_t xTaskGroupCreate( void ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * TaskGroupHandle_t xTaskGroupCreateStatic( StaticTaskGroup_t * pxTaskGroupBuffer );
+ * @endcode
+ *
+ * configUSE_TASK_GROUPS and configSUPPORT_STATIC_ALLOCATION must both be set
+ * to 1 for this function to be available.
+ *
+ * As xTaskGroupCreate(), but the memory used to hold the group is provided by
+ * the application.
+ *
+ * @param pxTaskGroupBuffer Must point to a variable of type StaticTaskGroup_t,
+ * which will then be used to hold the group's data structures.
+ *
+ * @return A handle to the created group.
+ *
+ * \defgroup xTaskGroupCreateStatic xTaskGroupCreateStatic
+ * \ingroup TaskGroups
+ */
+#if ( ( configUSE_TASK_GROUPS == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+    TaskGroupHandle_t xTaskGroupCreateStatic( StaticTaskGroup_t * pxTaskGroupBuffer ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * void vTaskGroupDelete( TaskGroupHandle_t xTaskGroup );
+ * @endcode
+ *
+ * Delete a task group.  The member tasks are not deleted or otherwise
+ * affected, other than no longer belonging to a group.
+ *
+ * @param xTaskGroup The group being deleted.
+ *
+ * \defgroup vTaskGroupDelete vTaskGroupDelete
+ * \ingroup TaskGroups
+ */
+void vTaskGroupDelete( TaskGroupHandle_t xTaskGroup ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * @code{c}
+ * void vTaskGroupAddTask( TaskGroupHandle_t xTaskGroup, TaskHandle_t xTask );
+ * @endcode
+ *
+ * Add a task to a task group.  A task belongs to at most one group, so a task
+ * that is already in another group is moved.  A task is removed from its group
+ * automatically when it is deleted.
+ *
+ * @param xTaskGroup The group the task is being added to.
+ *
+ * @param xTask Handle of the task being added.  Passing NULL adds the calling
+ * task.
+ *
+ * \defgroup vTaskGroupAddTask vTaskGroupAddTask
+ * \ingroup TaskGroups
+ */
+void vTaskGroupAddTask( TaskGroupHandle_t xTaskGroup,
+                        TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * @code{c}
+ * void vTaskGroupRemoveTask( TaskHandle_t xTask );
+ * @endcode
+ *
+ * Remove a task from whichever task group it belongs to, if any.
+ *
+ * @param xTask Handle of the task being removed.  Passing NULL removes the
+ * calling task.
+ *
+ * \defgroup vTaskGroupRemoveTask vTaskGroupRemoveTask
+ * \ingroup TaskGroups
+ */
+void vTaskGroupRemoveTask( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * @code{c}
+ * UBaseType_t uxTaskGroupGetMemberCount( TaskGroupHandle_t xTaskGroup );
+ * @endcode
+ *
+ * @return The number of tasks in the group.
+ *
+ * \defgroup uxTaskGroupGetMemberCount uxTaskGroupGetMemberCount
+ * \ingroup TaskGroups
+ */
+UBaseType_t uxTaskGroupGetMemberCount( TaskGroupHandle_t xTaskGroup ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * @code{c}
+ * void vTaskGroupSuspend( TaskGroupHandle_t xTaskGroup );
+ * @endcode
+ *
+ * INCLUDE_vTaskSuspend must be defined as 1 for this function to be
+ * available.
+ *
+ * Suspend every member of a task group, as if vTaskSuspend() had been called
+ * for each one, but within a single critical section.  If the calling task is
+ * a member it is suspended too, and only then does a context switch occur.
+ *
+ * @param xTaskGroup The group whose members are being suspended.
+ *
+ * \defgroup vTaskGroupSuspend vTaskGroupSuspend
+ * \ingroup TaskGroups
+ */
+void vTaskGroupSuspend( TaskGroupHandle_t xTaskGroup ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * @code{c}
+ * void vTaskGroupResume( TaskGroupHandle_t xTaskGroup );
+ * @endcode
+ *
+ * INCLUDE_vTaskSuspend must be defined as 1 for this function to be
+ * available.
+ *
+ * Resume every suspended member of a task group, as if vTaskResume() had been
+ * called for each one.  All members are made ready before the scheduler
+ * decides, once, whether a context switch is required.
+ *
+ * @param xTaskGroup The group whose members are being resumed.
+ *
+ * \defgroup vTaskGroupResume vTaskGroupResume
+ * \ingroup TaskGroups
+ */
+void vTaskGroupResume( TaskGroupHandle_t xTaskGroup ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * @code{c}
+ * void vTaskGroupPriorityOffset( TaskGroupHandle_t xTaskGroup, BaseType_t xOffset );
+ * @endcode
+ *
+ * INCLUDE_vTaskPrioritySet must be defined as 1 for this function to be
+ * available.
+ *
+ * Add xOffset to the base priority of every member of a task group, as if
+ * vTaskPrioritySet() had been called for each one.  Each new priority is
+ * clamped to the range tskIDLE_PRIORITY to ( configMAX_PRIORITIES - 1 ), so an
+ * opposite offset does not necessarily restore the original priorities of
+ * members that were clamped.  As with vTaskPrioritySet(), a member that has
+ * inherited a higher priority keeps it until the mutex is returned.
+ *
+ * @param xTaskGroup The group whose members are being changed.
+ *
+ * @param xOffset The amount to add to each member's priority.  Can be
+ * negative.
+ *
+ * \defgroup vTaskGroupPriorityOffset vTaskGroupPriorityOffset
+ * \ingroup TaskGroups
+ */
+void vTaskGroupPriorityOffset( TaskGroupHandle_t xTaskGroup,
+                               BaseType_t xOffset ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------
+* PROPORTIONAL SHARE SCHEDULING
+*----------------------------------------------------------*/
+
+/**
+ * task. h
+ * @code{c}
+ * void vTaskSetShareWeight( TaskHandle_t xTask, uint32_t ulWeight );
+ * @endcode
+ *
+ * configUSE_PROPORTIONAL_SHARE must be set to 1 for this function to be
+ * available.
+ *
+ * Tasks running at configPROPORTIONAL_SHARE_PRIORITY do not take equal turns
+ * as other tasks of equal priority do.  Instead each is charged for the CPU
+ * cycles it actually uses, and the ready task that has used the least in
+ * proportion to its weight runs next.  A task that blocks before the end of
+ * its time slice is therefore not penalised for doing so.  A task that has
+ * been blocked for a while is owed at most configPROPORTIONAL_SHARE_MAX_CREDIT
+ * cycles when it next becomes ready.
+ *
+ * The weight only affects the task while it runs at
+ * configPROPORTIONAL_SHARE_PRIORITY.  Tasks start with a weight of
+ * configPROPORTIONAL_SHARE_DEFAULT_WEIGHT.
+ *
+ * @param xTask Handle of the task whose weight is being set.  Passing NULL
+ * sets the weight of the calling task.
+ *
+ * @param ulWeight The new weight, from 1 to 4096.  A task with twice the weight
+ * of another receives twice as many cycles when both are always ready.
+ *
+ * \defgroup vTaskSetShareWeight vTaskSetShareWeight
+ * \ingroup TaskCtrl
+ */
+void vTaskSetShareWeight( TaskHandle_t xTask,
+                          uint32_t ulWeight ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * @code{c}
+ * uint32_t ulTaskGetShareWeight( TaskHandle_t xTask );
+ * @endcode
+ *
+ * configUSE_PROPORTIONAL_SHARE must be set to 1 for this function to be
+ * available.
+ *
+ * @param xTask Handle of the task being queried.  Passing NULL queries the
+ * calling task.
+ *
+ * @return The weight of the task.  See vTaskSetShareWeight().
+ *
+ * \defgroup ulTaskGetShareWeight ulTaskGetShareWeight
+ * \ingroup TaskCtrl
+ */
+uint32_t ulTaskGetShareWeight( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * @code{c}
+ * void vTaskGetShareCycles( TaskHandle_t xTask, uint64_t * pullTaskCycles, uint64_t * pullBandCycles );
+ * @endcode
+ *
+ * configUSE_PROPORTIONAL_SHARE must be set to 1 for this function to be
+ * available.
+ *
+ * Read the number of CPU cycles charged to a task while it ran at
+ * configPROPORTIONAL_SHARE_PRIORITY, along with the total charged to all tasks
+ * at that priority.  Both counts start when the scheduler starts and are only
+ * updated at context switches.  The share achieved over an interval is the
+ * difference between two readings of the task count divided by the
+ * difference between the matching band counts.
+ *
+ * @param xTask Handle of the task being queried.  Passing NULL queries the
+ * calling task.
+ *
+ * @param pullTaskCycles Used to return the cycles charged to the task.
+ *
+ * @param pullBandCycles Used to return the cycles charged to all tasks at
+ * configPROPORTIONAL_SHARE_PRIORITY.
+ *
+ * \defgroup vTaskGetShareCycles vTaskGetShareCycles
+ * \ingroup TaskUtils
+ */
+void vTaskGetShareCycles( TaskHandle_t xTask,
+                          uint64_t * pullTaskCycles,
+                          uint64_t * pullBandCycles ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * @code{c}
+ * uint32_t ulTaskGetAchievedShare( TaskHandle_t xTask );
+ * @endcode
+ *
+ * configUSE_PROPORTIONAL_SHARE must be set to 1 for this function to be
+ * available.
+ *
+ * @param xTask Handle of the task being queried.  Passing NULL queries the
+ * calling task.
+ *
+ * @return The share of the cycles used at configPROPORTIONAL_SHARE_PRIORITY
+ * that have been charged to the task since the scheduler started, in parts
+ * per thousand.  See vTaskGetShareCycles().
+ *
+ * \defgroup ulTaskGetAchievedShare ulTaskGetAchievedShare
+ * \ingroup TaskUtils
+ */
+uint32_t ulTaskGetAchievedShare( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------
+* TIME TRIGGERED SCHEDULING
+*----------------------------------------------------------*/
+
+/**
+ * task. h
+ * @code{c}
+ * void vTaskStartTimeTriggeredSchedule( const TimeTriggeredSlot_t * pxSchedule, UBaseType_t uxSlots, TickType_t xMajorFrameTicks );
+ * @endcode
+ *
+ * configUSE_TIME_TRIGGERED_SCHEDULE must be set to 1 for this function to be
+ * available.
+ *
+ * Start a cyclic executive that releases tasks at fixed offsets within a
+ * major frame that repeats for as long as the application runs.  Each slot of
+ * the table is released by the tick interrupt on the tick given by its offset,
+ * independently of when the task released by the slot last ran, so slot
+ * releases do not drift as xTaskDelayUntil() loops can.  A task takes part in
+ * the schedule by calling xTaskWaitForSlot().
+ *
+ * A released task is scheduled by priority like any other task, and tasks that
+ * are not part of the schedule run in the time the schedule leaves unused.
+ * Give the time triggered tasks the highest priorities in the system if their
+ * release jitter is to stay within the cost of a context switch.
+ *
+ * The function must be called after the scheduler has been started, and can
+ * only be called once.  The table is not copied so must remain valid, and is
+ * normally declared const.
+ *
+ * Example usage:
+ * @code{c}
+ * // A 10 tick major frame.  The control task runs at the start of the frame
+ * // and half way through it, the logging task after the first control run.
+ * static const TimeTriggeredSlot_t xSchedule[] =
+ * {
+ *     { 0, 2 }, // Slot 0: control, at most 2 ticks.
+ *     { 2, 0 }, // Slot 1: logging, no budget.
+ *     { 5, 2 }  // Slot 2: control, at most 2 ticks.
+ * };
+ *
+ * void vControlTask( void * pvParameters )
+ * {
+ *     for( ;; )
+ *     {
+ *         xTaskWaitForSlot( 0 );
+ *         vRunControlLoop();
+ *         xTaskWaitForSlot( 2 );
+ *         vRunControlLoop();
+ *     }
+ * }
+ *
+ * void vStartTask( void * pvParameters )
+ * {
+ *     vTaskStartTimeTriggeredSchedule( xSchedule, 3, 10 );
+ *     vTaskDelete( NULL );
+ * }
+ * @endcode
+ *
+ * @param pxSchedule The schedule table.  Offsets must be in ascending order and
+ * less than xMajorFrameTicks.
+ *
+ * @param uxSlots The number of slots in the table, from 1 to
+ * configTIME_TRIGGERED_MAX_SLOTS.
+ *
+ * @param xMajorFrameTicks The length of the major frame in ticks.  The first
+ * frame starts on the tick after the function is called.
+ *
+ * \defgroup vTaskStartTimeTriggeredSchedule vTaskStartTimeTriggeredSchedule
+ * \ingroup TaskCtrl
+ */
+void vTaskStartTimeTriggeredSchedule( const TimeTriggeredSlot_t * const pxSchedule,
+                                      const UBaseType_t uxSlots,
+                                      const TickType_t xMajorFrameTicks ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * @code{c}
+ * BaseType_t xTaskWaitForSlot( UBaseType_t uxSlot );
+ * @endcode
+ *
+ * configUSE_TIME_TRIGGERED_SCHEDULE must be set to 1 for this function to be
+ * available.
+ *
+ * Complete the slot the calling task was last released into, if any, then
+ * block until slot uxSlot is next released.  A slot belongs to the first task
+ * that waits for it.  One task can own several slots.
+ *
+ * If the task is still running when one of its slots falls due then the
+ * release is missed and counted in the slot's statistics, and the task waits
+ * for the next release of the slot when it calls xTaskWaitForSlot().  If the
+ * task completes the slot more than the slot's budget after the slot was
+ * released then an overrun is counted.  See vTaskGetSlotStats().
+ *
+ * @param uxSlot The index of the slot in the schedule table.
+ *
+ * @return pdTRUE if the task was released by the slot.  pdFALSE if the task was
+ * made ready by something else, for example xTaskAbortDelay(), or was
+ * suspended when the slot fell due.
+ *
+ * \defgroup xTaskWaitForSlot xTaskWaitForSlot
+ * \ingroup TaskCtrl
+ */
+BaseType_t xTaskWaitForSlot( const UBaseType_t uxSlot ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * @code{c}
+ * void vTaskGetSlotStats( UBaseType_t uxSlot, TimeTriggeredSlotStats_t * pxSlotStats );
+ * @endcode
+ *
+ * configUSE_TIME_TRIGGERED_SCHEDULE must be set to 1 for this function to be
+ * available.
+ *
+ * Read the release statistics of one slot of the time triggered schedule.  The
+ * release latency is measured with portGET_CYCLE_COUNTER() from the tick
+ * interrupt that released the slot to the released task returning from
+ * xTaskWaitForSlot(), so the release jitter is the spread of that latency.
+ * The latencies read as 0 until the task has been released at least once.
+ *
+ * @param uxSlot The index of the slot in the schedule table.
+ *
+ * @param pxSlotStats Used to return the statistics of the slot.
+ *
+ * \defgroup vTaskGetSlotStats vTaskGetSlotStats
+ * \ingroup TaskUtils
+ */
+void vTaskGetSlotStats( const UBaseType_t uxSlot,
+                        TimeTriggeredSlotStats_t * const pxSlotStats ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------
+* TIME PARTITIONED SCHEDULING
+*----------------------------------------------------------*/
+
+/**
+ * task. h
+ * @code{c}
+ * void vTaskStartPartitionSchedule( const PartitionWindow_t * pxWindows, UBaseType_t uxWindows );
+ * @endcode
+ *
+ * configUSE_TIME_PARTITIONS must be set to 1 for this function to be
+ * available.
+ *
+ * Split time into a major frame of windows that repeats for as long as the
+ * application runs.  While a window is open only the tasks of the partition
+ * bound to it are considered for selection, so each partition is guaranteed
+ * its windows whatever the priorities of the tasks in other partitions.  The
+ * priorities of tasks in different partitions are never compared, so each
+ * partition has its own priority space.
+ *
+ * When none of the tasks of the window's partition are ready the slack is
+ * given to the highest priority ready task of the background partition,
+ * partition 0, which contains the idle task.  A task of the window's partition
+ * that becomes ready while a background task runs preempts it no later than
+ * the next tick.
+ *
+ * Tasks start in the background partition.  See vTaskSetPartition().  Before
+ * this function is called tasks are scheduled by priority alone.
+ *
+ * The table is not copied so must remain valid, and is normally declared const.
+ * The function can only be called once.
+ *
+ * Example usage:
+ * @code{c}
+ * // A 20 tick major frame.  The control partition gets 8 ticks, the
+ * // communications partition 10 ticks and the background partition 2 ticks.
+ * static const PartitionWindow_t xWindows[] =
+ * {
+ *     { 1, 8 },
+ *     { 2, 10 },
+ *     { 0, 2 }
+ * };
+ *
+ * vTaskSetPartition( xControlTask, 1 );
+ * vTaskSetPartition( xCommsTask, 2 );
+ * vTaskStartPartitionSchedule( xWindows, 3 );
+ * @endcode
+ *
+ * @param pxWindows The window table.  Each window must last at least one tick.
+ *
+ * @param uxWindows The number of windows in the table.
+ *
+ * \defgroup vTaskStartPartitionSchedule vTaskStartPartitionSchedule
+ * \ingroup TaskCtrl
+ */
+void vTaskStartPartitionSchedule( const PartitionWindow_t * const pxWindows,
+                                  const UBaseType_t uxWindows ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * @code{c}
+ * void vTaskSetPartition( TaskHandle_t xTask, UBaseType_t uxPartition );
+ * @endcode
+ *
+ * configUSE_TIME_PARTITIONS must be set to 1 for this function to be
+ * available.
+ *
+ * Move a task into a temporal partition.  See vTaskStartPartitionSchedule().
+ *
+ * @param xTask Handle of the task being moved.  Passing NULL moves the calling
+ * task.  The idle task cannot be moved out of the background partition.
+ *
+ * @param uxPartition The partition, from 0 to configNUM_PARTITIONS - 1.
+ *
+ * \defgroup vTaskSetPartition vTaskSetPartition
+ * \ingroup TaskCtrl
+ */
+void vTaskSetPartition( TaskHandle_t xTask,
+                        UBaseType_t uxPartition ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * @code{c}
+ * UBaseType_t uxTaskGetPartition( TaskHandle_t xTask );
+ * @endcode
+ *
+ * configUSE_TIME_PARTITIONS must be set to 1 for this function to be
+ * available.
+ *
+ * @param xTask Handle of the task being queried.  Passing NULL queries the
+ * calling task.
+ *
+ * @return The partition the task belongs to.
+ *
+ * \defgroup uxTaskGetPartition uxTaskGetPartition
+ * \ingroup TaskCtrl
+ */
+UBaseType_t uxTaskGetPartition( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * @code{c}
+ * void vTaskGetPartitionStats( UBaseType_t uxPartition, PartitionStats_t * pxPartitionStats );
+ * @endcode
+ *
+ * configUSE_TIME_PARTITIONS must be set to 1 for this function to be
+ * available.
+ *
+ * Read how many ticks a partition has been given and how many it has used.
+ * The counts are sampled by the tick interrupt, from the time
+ * vTaskStartPartitionSchedule() is called.
+ *
+ * @param uxPartition The partition being queried.
+ *
+ * @param pxPartitionStats Used to return the statistics of the partition.
+ *
+ * \defgroup vTaskGetPartitionStats vTaskGetPartitionStats
+ * \ingroup TaskUtils
+ */
+void vTaskGetPartitionStats( UBaseType_t uxPartition,
+                             PartitionStats_t * const pxPartitionStats ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------
+* STACK TIERING
+*----------------------------------------------------------*/
+
+/**
+ * task. h
+ * @code{c}
+ * BaseType_t xTaskEnableStackTiering( TaskHandle_t xTask, configSTACK_DEPTH_TYPE uxStackDepth );
+ * @endcode
+ *
+ * configUSE_STACK_TIERING must be set to 1 for this function to be available.
+ *
+ * Run a task on one of configSTACK_TIER_SLOTS stack slots that are placed in
+ * fast memory, such as DTCM, by configSTACK_TIER_SLOT_ATTRIBUTE.  Each slot is
+ * shared by several tasks.  The stack the task was created with, normally in
+ * slow memory, becomes the backing store of the task's stack.
+ *
+ * When a task is switched in and its slot holds another task's stack, the used
+ * part of that stack is copied to its backing store and the used part of the
+ * task's own stack is copied into the slot.  The idle task copies the stacks of
+ * tasks that have not run for configSTACK_TIER_WRITE_BACK_TICKS back to their
+ * backing store ahead of time, so waking a task that has been blocked for a
+ * long time costs a single copy.  Tasks that run often therefore keep their
+ * stacks in fast memory.  Give tasks that run often slots of their own.
+ *
+ * A task always runs at the same stack address, so pointers the task holds to
+ * its own stack remain valid.  Nothing other than the task itself may access
+ * the task's stack while the task is blocked, though - for example a DMA
+ * transfer or another task must not be given the address of a buffer that is
+ * on the stack of a tiered task.  The stack high water mark of a tiered task is
+ * not meaningful.
+ *
+ * The function must be called before the task runs for the first time, for
+ * example straight after the task is created and before the scheduler is
+ * started.  The task is given the slot shared by the fewest tasks.
+ *
+ * @param xTask The handle of the task.
+ *
+ * @param uxStackDepth The stack depth the task was created with.  Must not be
+ * greater than configSTACK_TIER_SLOT_DEPTH.
+ *
+ * @return pdPASS if the task now runs on a slot, otherwise pdFAIL.
+ *
+ * \defgroup xTaskEnableStackTiering xTaskEnableStackTiering
+ * \ingroup TaskCtrl
+ */
+BaseType_t xTaskEnableStackTiering( TaskHandle_t xTask,
+                                    configSTACK_DEPTH_TYPE uxStackDepth ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * @code{c}
+ * void vTaskGetStackTierStats( StackTierStats_t * pxStackTierStats );
+ * @endcode
+ *
+ * configUSE_STACK_TIERING must be set to 1 for this function to be available.
+ *
+ * @param pxStackTierStats Used to return the number of stack copies made.
+ *
+ * \defgroup vTaskGetStackTierStats vTaskGetStackTierStats
+ * \ingroup TaskUtils
+ */
+void vTaskGetStackTierStats( StackTierStats_t * const pxStackTierStats ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------
+* DEADLINE TIMERS
+*----------------------------------------------------------*/
+
+/**
+ * task. h
+ * @code{c}
+ * DeadlineTimerHandle_t xTaskDeadlineTimerInit( StaticDeadlineTimer_t * pxTimerBuffer, DeadlineTimerCallback_t pxCallback, void * pvContext );
+ * @endcode
+ *
+ * configUSE_DEADLINE_TIMERS must be set to 1 for this function to be
+ * available.
+ *
+ * Initialise a deadline timer in memory provided by the application.  Nothing
+ * is allocated.
+ *
+ * A deadline timer is kept in the same delayed lists as the blocked tasks,
+ * ordered by expiry time with them, so one pass of the tick both unblocks the
+ * tasks and calls the timers that are due.  The callback runs directly in the
+ * tick interrupt rather than in the timer service task, so an expiry costs no
+ * task wake-up or context switch.  In return the callback must be short, and
+ * can only use API functions that end in FromISR.  Use the software timers in
+ * timers.h for callbacks that need to block.
+ *
+ * Deadline timers are not tasks, and are not reported by uxTaskGetSystemState()
+ * or found by xTaskGetHandle().
+ *
+ * Example usage:
+ * @code{c}
+ * static StaticDeadlineTimer_t xWatchdogBuffer;
+ * static DeadlineTimerHandle_t xWatchdog;
+ *
+ * static void prvWatchdogExpired( DeadlineTimerHandle_t xTimer, BaseType_t * pxHigherPriorityTaskWoken )
+ * {
+ *     TaskHandle_t xSupervisor = ( TaskHandle_t ) pvTaskDeadlineTimerGetContext( xTimer );
+ *
+ *     vTaskNotifyGiveFromISR( xSupervisor, pxHigherPriorityTaskWoken );
+ * }
+ *
+ * void vStartWatchdog( void )
+ * {
+ *     xWatchdog = xTaskDeadlineTimerInit( &xWatchdogBuffer, prvWatchdogExpired, xTaskGetCurrentTaskHandle() );
+ *     vTaskDeadlineTimerStart( xWatchdog, pdMS_TO_TICKS( 50 ), 0 );
+ * }
+ * @endcode
+ *
+ * @param pxTimerBuffer Must point to a variable of type StaticDeadlineTimer_t,
+ * which will then be used to hold the timer's data structures.
+ *
+ * @param pxCallback The function called when the timer expires.
+ *
+ * @param pvContext A value the callback can retrieve with
+ * pvTaskDeadlineTimerGetContext().
+ *
+ * @return A handle to the timer, which is not running.
+ *
+ * \defgroup xTaskDeadlineTimerInit xTaskDeadlineTimerInit
+ * \ingroup DeadlineTimers
+ */
+DeadlineTimerHandle_t xTaskDeadlineTimerInit( StaticDeadlineTimer_t * pxTimerBuffer,
+                                              DeadlineTimerCallback_t pxCallback,
+                                              void * pvContext ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * @code{c}
+ * void vTaskDeadlineTimerStart( DeadlineTimerHandle_t xTimer, TickType_t xDelay, TickType_t xPeriod );
+ * void vTaskDeadlineTimerStartFromISR( DeadlineTimerHandle_t xTimer, TickType_t xDelay, TickType_t xPeriod );
+ * @endcode
+ *
+ * configUSE_DEADLINE_TIMERS must be set to 1 for these functions to be
+ * available.
+ *
+ * Start a deadline timer, or restart it if it is already running.  The timer
+ * first expires xDelay ticks from now, then every xPeriod ticks after that.  A
+ * periodic timer keeps to its period from the first expiry, so if expiries are
+ * missed, for example while the scheduler is suspended, the callback is called
+ * once for each of them when the tick catches up.
+ *
+ * @param xTimer The timer to start.
+ *
+ * @param xDelay The ticks until the first expiry.  Must not be 0.
+ *
+ * @param xPeriod The ticks between expiries, or 0 for a timer that expires
+ * once.
+ *
+ * \defgroup vTaskDeadlineTimerStart vTaskDeadlineTimerStart
+ * \ingroup DeadlineTimers
+ */
+void vTaskDeadlineTimerStart( DeadlineTimerHandle_t xTimer,
+                              TickType_t xDelay,
+                              TickType_t xPeriod ) PRIVILEGED_FUNCTION;
+void vTaskDeadlineTimerStartFromISR( DeadlineTimerHandle_t xTimer,
+                                     TickType_t xDelay,
+                                     TickType_t xPeriod ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * @code{c}
+ * void vTaskDeadlineTimerStop( DeadlineTimerHandle_t xTimer );
+ * void vTaskDeadlineTimerStopFromISR( DeadlineTimerHandle_t xTimer );
+ * @endcode
+ *
+ * configUSE_DEADLINE_TIMERS must be set to 1 for these functions to be
+ * available.
+ *
+ * Stop a deadline timer.  Stopping a timer that is not running has no effect.
+ * A callback can stop its own timer.
+ *
+ * @param xTimer The timer to stop.
+ *
+ * \defgroup vTaskDeadlineTimerStop vTaskDeadlineTimerStop
+ * \ingroup DeadlineTimers
+ */
+void vTaskDeadlineTimerStop( DeadlineTimerHandle_t xTimer ) PRIVILEGED_FUNCTION;
+void vTaskDeadlineTimerStopFromISR( DeadlineTimerHandle_t xTimer ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * @code{c}
+ * BaseType_t xTaskDeadlineTimerIsActive( DeadlineTimerHandle_t xTimer );
+ * @endcode
+ *
+ * configUSE_DEADLINE_TIMERS must be set to 1 for this function to be
+ * available.
+ *
+ * @return pdTRUE if the timer is running, otherwise pdFALSE.  A one-shot timer
+ * is no longer running once its callback has been called.
+ *
+ * \defgroup xTaskDeadlineTimerIsActive xTaskDeadlineTimerIsActive
+ * \ingroup DeadlineTimers
+ */
+BaseType_t xTaskDeadlineTimerIsActive( DeadlineTimerHandle_t xTimer ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * @code{c}
+ * void * pvTaskDeadlineTimerGetContext( DeadlineTimerHandle_t xTimer );
+ * @endcode
+ *
+ * configUSE_DEADLINE_TIMERS must be set to 1 for this function to be
+ * available.
+ *
+ * @return The pvContext value passed to xTaskDeadlineTimerInit().
+ *
+ * \defgroup pvTaskDeadlineTimerGetContext pvTaskDeadlineTimerGetContext
+ * \ingroup DeadlineTimers
+ */
+void * pvTaskDeadlineTimerGetContext( DeadlineTimerHandle_t xTimer ) PRIVILEGED_FUNCTION;
+
 /*-----------------------------------------------------------
 * SCHEDULER CONTROL
 *----------------------------------------------------------*/
@@ -1460,6 +2322,25 @@ TickType_t xTaskGetTickCount( void ) PRIVILEGED_FUNCTION;
  */
 TickType_t xTaskGetTickCountFromISR( void ) PRIVILEGED_FUNCTION;
 
+/**
+ * task. h
+ * @code{c}
+ * UBaseType_t uxTaskGetPriorityInheritanceChainDepth( void );
+ * @endcode
+ *
+ * configUSE_PRIORITY_INHERITANCE_CHAIN must be set to 1 for this function to
+ * be available.
+ *
+ * @return The greatest number of tasks whose priority was raised by a single
+ * priority inheritance, including the direct mutex holder.  A value equal to
+ * configMAX_PRIORITY_INHERITANCE_CHAIN_DEPTH indicates a chain may have been
+ * cut short.
+ *
+ * \defgroup uxTaskGetPriorityInheritanceChainDepth uxTaskGetPriorityInheritanceChainDepth
+ * \ingroup TaskUtils
+ */
+UBaseType_t uxTaskGetPriorityInheritanceChainDepth( void ) PRIVILEGED_FUNCTION;
+
 /**
  * task. h
  * @code{c}
@@ -2371,6 +3252,85 @@ BaseType_t xTaskGenericNotifyWait( UBaseType_t uxIndexToWaitOn,
 #define xTaskNotifyWaitIndexed( uxIndexToWaitOn, ulBitsToClearOnEntry, ulBitsToClearOnExit, pulNotificationValue, xTicksToWait ) \
     xTaskGenericNotifyWait( ( uxIndexToWaitOn ), ( ulBitsToClearOnEntry ), ( ulBitsToClearOnExit ), ( pulNotificationValue ), ( xTicksToWait ) )
 
+/**
+ * task. h
+ * @code{c}
+ * uint32_t ulTaskNotifyWaitBitsIndexed( UBaseType_t uxIndexToWaitOn, uint32_t ulBitsToWaitFor, BaseType_t xClearOnExit, BaseType_t xWaitForAllBits, TickType_t xTicksToWait );
+ *
+ * uint32_t ulTaskNotifyWaitBits( uint32_t ulBitsToWaitFor, BaseType_t xClearOnExit, BaseType_t xWaitForAllBits, TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Uses a notification value as an event group: waits for either any one, or
+ * all, of the bits in ulBitsToWaitFor to be set in the notification value at
+ * uxIndexToWaitOn.  Unlike xTaskNotifyWaitIndexed(), a notification that does
+ * not satisfy the condition leaves the task blocked - the notifying task or
+ * interrupt checks the condition, so the waiting task does not have to run
+ * just to find it must wait again.
+ *
+ * configUSE_TASK_NOTIFICATIONS and configUSE_TASK_NOTIFY_WAIT_BITS must both
+ * be set to 1 for this function to be available.
+ *
+ * Example usage:
+ * @code{c}
+ * #define mainRX_BIT     ( 1UL << 0 )
+ * #define mainTX_BIT     ( 1UL << 1 )
+ * #define mainSTAT_BIT   ( 1UL << 2 )
+ *
+ * void vDriverTask( void * pvParameters )
+ * {
+ *     uint32_t ulValue;
+ *
+ *     for( ;; )
+ *     {
+ *         // Sleep through mainSTAT_BIT notifications until a transfer
+ *         // completes.
+ *         ulValue = ulTaskNotifyWaitBits( mainRX_BIT | mainTX_BIT, pdTRUE, pdFALSE, portMAX_DELAY );
+ *
+ *         if( ( ulValue & mainRX_BIT ) != 0 )
+ *         {
+ *             prvHandleRx();
+ *         }
+ *
+ *         if( ( ulValue & mainTX_BIT ) != 0 )
+ *         {
+ *             prvHandleTx();
+ *         }
+ *     }
+ * }
+ * @endcode
+ *
+ * @param uxIndexToWaitOn The index within the calling task's array of
+ * notification values on which to wait.  uxIndexToWaitOn must be less than
+ * configTASK_NOTIFICATION_ARRAY_ENTRIES.
+ *
+ * @param ulBitsToWaitFor The bits to wait for.  Must not be 0.
+ *
+ * @param xClearOnExit If xClearOnExit is pdTRUE then the bits in
+ * ulBitsToWaitFor are cleared in the notification value when the condition is
+ * met.  They are not cleared if the function times out.
+ *
+ * @param xWaitForAllBits pdTRUE to wait for all of the bits in ulBitsToWaitFor
+ * to be set, pdFALSE to wait for any one of them.
+ *
+ * @param xTicksToWait The maximum amount of time that the task should wait in
+ * the Blocked state for the condition to be met.
+ *
+ * @return The notification value when the condition was met or the block time
+ * expired, before any bits were cleared.  Test the value to know which.
+ *
+ * \defgroup ulTaskNotifyWaitBitsIndexed ulTaskNotifyWaitBitsIndexed
+ * \ingroup TaskNotifications
+ */
+uint32_t ulTaskGenericNotifyWaitBits( UBaseType_t uxIndexToWait,
+                                      uint32_t ulBitsToWaitFor,
+                                      BaseType_t xClearOnExit,
+                                      BaseType_t xWaitForAllBits,
+                                      TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+#define ulTaskNotifyWaitBits( ulBitsToWaitFor, xClearOnExit, xWaitForAllBits, xTicksToWait ) \
+    ulTaskGenericNotifyWaitBits( tskDEFAULT_INDEX_TO_NOTIFY, ( ulBitsToWaitFor ), ( xClearOnExit ), ( xWaitForAllBits ), ( xTicksToWait ) )
+#define ulTaskNotifyWaitBitsIndexed( uxIndexToWaitOn, ulBitsToWaitFor, xClearOnExit, xWaitForAllBits, xTicksToWait ) \
+    ulTaskGenericNotifyWaitBits( ( uxIndexToWaitOn ), ( ulBitsToWaitFor ), ( xClearOnExit ), ( xWaitForAllBits ), ( xTicksToWait ) )
+
 /**
  * task. h
  * @code{c}
@@ -2923,6 +3883,24 @@ BaseType_t xTaskCatchUpTicks( TickType_t xTicksToCatchUp ) PRIVILEGED_FUNCTION;
  */
 BaseType_t xTaskIncrementTick( void ) PRIVILEGED_FUNCTION;
 
+/*
+ * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS ONLY
+ * INTENDED FOR USE WHEN IMPLEMENTING A PORT OF THE SCHEDULER AND IS
+ * AN INTERFACE WHICH IS FOR THE EXCLUSIVE USE OF THE SCHEDULER.
+ *
+ * Used in place of xTaskIncrementTick() when
+ * configUSE_DEFERRED_TICK_PROCESSING is set to 1.  vTaskDeferTickFromISR() is
+ * called from the tick interrupt with interrupts disabled and only counts the
+ * tick; the port must then pend the interrupt that calls
+ * vTaskProcessDeferredTicks().  vTaskProcessDeferredTicks() must be called from
+ * an interrupt of the same priority as the tick interrupt, before the context
+ * switch is performed.  It moves expired delayed tasks to the ready lists at
+ * most configDEFERRED_TICK_UNBLOCK_BATCH at a time, with interrupts enabled
+ * between batches, then performs the rest of the tick processing.
+ */
+void vTaskDeferTickFromISR( void ) PRIVILEGED_FUNCTION;
+void vTaskProcessDeferredTicks( void ) PRIVILEGED_FUNCTION;
+
 /*
  * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS AN
  * INTERFACE WHICH IS FOR THE EXCLUSIVE USE OF THE SCHEDULER.
@@ -3081,6 +4059,24 @@ void vTaskSetTaskNumber( TaskHandle_t xTask,
  */
 void vTaskStepTick( TickType_t xTicksToJump ) PRIVILEGED_FUNCTION;
 
+/*
+ * Only available when configUSE_ADAPTIVE_TICK is set to 1.  Called by the
+ * port's tick interrupt, with interrupts masked, after a tick that did not
+ * request a context switch.  If no tick driven scheduling decision can fall due
+ * before the next task unblocks, asks the port, with
+ * portADAPTIVE_TICK_START(), to defer the tick interrupt until then.
+ */
+void vTaskEnterAdaptiveTick( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * Only available when configUSE_ADAPTIVE_TICK is set to 1.  Restores the
+ * periodic tick, if it is deferred, and steps the tick count forward by the
+ * tick periods that passed, as returned by portADAPTIVE_TICK_STOP().  Called
+ * by the kernel whenever the deadline may move, and by the port's tick
+ * interrupt before it increments the tick.
+ */
+void vTaskExitAdaptiveTick( void ) PRIVILEGED_FUNCTION;
+
 /*
  * Only available when configUSE_TICKLESS_IDLE is set to 1.
  * Provided for use within portSUPPRESS_TICKS_AND_SLEEP() to allow the port
@@ -3103,12 +4099,38 @@ eSleepModeStatus eTaskConfirmSleepModeStatus( void ) PRIVILEGED_FUNCTION;
  */
 TaskHandle_t pvTaskIncrementMutexHeldCount( void ) PRIVILEGED_FUNCTION;
 
+/*
+ * For internal use only.  Record the mutex the calling task is about to block
+ * on, or NULL when it is no longer blocked on a mutex, so priority inheritance
+ * can follow chains of mutex holders.  Must be called from a critical section.
+ */
+void vTaskSetBlockedOnMutex( void * pvMutex ) PRIVILEGED_FUNCTION;
+
 /*
  * For internal use only.  Same as vTaskSetTimeOutState(), but without a critical
  * section.
  */
 void vTaskInternalSetTimeOutState( TimeOut_t * const pxTimeOut ) PRIVILEGED_FUNCTION;
 
+/*
+ * For internal use only.  Called by vRcuReadLock() and vRcuReadUnlock() to
+ * enter and leave an RCU read-side critical section.  Only the read-side
+ * nesting count of the calling task is written unless the task was switched
+ * out while inside the section.
+ */
+void vTaskRcuReadLock( void ) PRIVILEGED_FUNCTION;
+void vTaskRcuReadUnlock( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * For internal use only.  Called by the RCU reclaimer task to start a grace
+ * period.  Returns the phase to pass to xTaskRcuGracePeriodElapsed(), which
+ * returns pdTRUE once every task that was inside a read-side critical section
+ * when the grace period started has left it.  Grace periods must be run one
+ * at a time.
+ */
+UBaseType_t uxTaskRcuStartGracePeriod( void ) PRIVILEGED_FUNCTION;
+BaseType_t xTaskRcuGracePeriodElapsed( UBaseType_t uxPhase ) PRIVILEGED_FUNCTION;
+
 
 /* *INDENT-OFF* */
 #ifdef __cplusplus
@@ -41,6 +41,18 @@
 #include "timers.h"
 #include "stack_macros.h"
 
+#if ( configUSE_PRIORITY_INHERITANCE_CHAIN == 1 )
+    #include "queue.h"
+#endif
+
+#if ( configUSE_RCU == 1 )
+    #include "rcu.h"
+#endif
+
+#if ( ( configUSE_STACK_TIERING == 1 ) && ( portSTACK_GROWTH > 0 ) )
+    #error configUSE_STACK_TIERING can only be used with ports whose stack grows down.
+#endif
+
 /* Lint e9021, e961 and e750 are suppressed as a MISRA exception justified
  * because the MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
  * for the header files above, but not in this file, in order to generate the
@@ -214,14 +226,51 @@
 
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_TIME_PARTITIONS == 1 )
+
+/* A task of the partition that owns the open window must run in place of a
+ * background task that is using the window's slack, whatever their
+ * priorities.  The callers of prvAddTaskToReadyList() only compare priorities,
+ * so latch a context switch that is performed on the next tick at the latest. */
+    #define taskPARTITION_CHECK_FOR_PREEMPTION( pxTCB )                                                         \
+    if( ( ( pxTCB )->uxPartition == uxActivePartition ) && ( pxCurrentTCB->uxPartition != uxActivePartition ) ) \
+    {                                                                                                           \
+        xYieldPending = pdTRUE;                                                                                 \
+    }
+#else
+    #define taskPARTITION_CHECK_FOR_PREEMPTION( pxTCB )
+#endif /* configUSE_TIME_PARTITIONS */
+
+/*-----------------------------------------------------------*/
+
+/* While the tick is deferred by vTaskEnterAdaptiveTick() xTickCount lags the
+ * time.  Anything that can change when the next tick driven decision falls
+ * due, or that needs xTickCount to be current, first restores the periodic
+ * tick. */
+#if ( configUSE_ADAPTIVE_TICK == 1 )
+    #define taskEXIT_ADAPTIVE_TICK()                 \
+    do {                                             \
+        if( xAdaptiveTickActive != pdFALSE )         \
+        {                                            \
+            vTaskExitAdaptiveTick();                 \
+        }                                            \
+    } while( 0 )
+#else
+    #define taskEXIT_ADAPTIVE_TICK()
+#endif /* configUSE_ADAPTIVE_TICK */
+
+/*-----------------------------------------------------------*/
+
 /*
  * Place the task represented by pxTCB into the appropriate ready list for
  * the task.  It is inserted at the end of the list.
  */
 #define prvAddTaskToReadyList( pxTCB )                                                                 \
     traceMOVED_TASK_TO_READY_STATE( pxTCB );                                                           \
+    taskEXIT_ADAPTIVE_TICK();                                                                          \
     taskRECORD_READY_PRIORITY( ( pxTCB )->uxPriority );                                                \
     listINSERT_END( &( pxReadyTasksLists[ ( pxTCB )->uxPriority ] ), &( ( pxTCB )->xStateListItem ) ); \
+    taskPARTITION_CHECK_FOR_PREEMPTION( pxTCB );                                                       \
     tracePOST_MOVED_TASK_TO_READY_STATE( pxTCB )
 /*-----------------------------------------------------------*/
 
@@ -247,6 +296,40 @@
     #define taskEVENT_LIST_ITEM_VALUE_IN_USE    0x80000000UL
 #endif
 
+/* The ucRcuPreemptedPhase member of the TCB holds the grace period phase in
+ * which the task was switched out inside an RCU read-side critical section, or
+ * taskRCU_NOT_PREEMPTED if it has not been. */
+#if ( configUSE_RCU == 1 )
+    #define taskRCU_NOT_PREEMPTED    ( ( uint8_t ) 0xFF )
+#endif
+
+/* Values that can be assigned to the ucState member of a time triggered slot. */
+#if ( configUSE_TIME_TRIGGERED_SCHEDULE == 1 )
+    #define taskSLOT_IDLE       ( ( uint8_t ) 0 )
+    #define taskSLOT_WAITING    ( ( uint8_t ) 1 )
+    #define taskSLOT_ACTIVE     ( ( uint8_t ) 2 )
+#endif
+
+/* pvBlockedOnMutex is only cleared when the task next runs, so a task is only
+ * still blocked on that mutex while its event list item is in a wait list.  A
+ * task unblocked while the scheduler was suspended has its event list item in
+ * xPendingReadyList instead. */
+#if ( configUSE_PRIORITY_INHERITANCE_CHAIN == 1 )
+    #define prvTaskIsBlockedOnMutex( pxTCB )                                            \
+    ( ( ( pxTCB )->pvBlockedOnMutex != NULL ) &&                                        \
+      ( listLIST_ITEM_CONTAINER( &( ( pxTCB )->xEventListItem ) ) != NULL ) &&          \
+      ( listLIST_ITEM_CONTAINER( &( ( pxTCB )->xEventListItem ) ) != &xPendingReadyList ) )
+#endif
+
+#if ( configUSE_PROPORTIONAL_SHARE == 1 )
+
+/* The pass of a task advances by taskSHARE_STRIDE1 / weight for each cycle it
+ * runs, so tasks accumulate pass at a rate inversely proportional to their
+ * weight.  The weight limit keeps the rounding error of the stride below 0.5%. */
+    #define taskSHARE_STRIDE1       ( 1UL << 20UL )
+    #define taskSHARE_MAX_WEIGHT    ( 4096UL )
+#endif
+
 /*
  * Task control block.  A task control block (TCB) is allocated for each task,
  * and stores task state information, including a pointer to the task's context
@@ -284,6 +367,46 @@ typedef struct tskTaskControlBlock       /* The old naming convention is used to
         UBaseType_t uxMutexesHeld;
     #endif
 
+    #if ( configUSE_PRIORITY_INHERITANCE_CHAIN == 1 )
+        void * pvBlockedOnMutex; /*< The mutex the task is blocked waiting to take, used to follow the chain of mutex holders when priority is inherited. */
+    #endif
+
+    #if ( configUSE_TASK_GROUPS == 1 )
+        ListItem_t xGroupListItem; /*< Used to reference a task from the member list of its task group. */
+    #endif
+
+    #if ( configUSE_PROPORTIONAL_SHARE == 1 )
+        uint32_t ulShareWeight;  /*< The task's share of the CPU relative to the other tasks running at configPROPORTIONAL_SHARE_PRIORITY. */
+        uint32_t ulShareStride;  /*< taskSHARE_STRIDE1 divided by ulShareWeight.  The pass advances by this much per cycle run. */
+        uint64_t ullSharePass;   /*< Virtual time consumed so far.  The ready task with the lowest pass runs next. */
+        uint64_t ullShareCycles; /*< CPU cycles charged to the task while it ran at configPROPORTIONAL_SHARE_PRIORITY. */
+    #endif
+
+    #if ( configUSE_FLIGHT_RECORDER == 1 )
+        uint32_t ulFlightRecorderReadyCycles; /*< Cycle count at which the task was last unblocked, or 0 if it has run since. */
+    #endif
+
+    #if ( configUSE_TIME_PARTITIONS == 1 )
+        UBaseType_t uxPartition; /*< The temporal partition the task belongs to.  Partition 0 is the background partition. */
+    #endif
+
+    #if ( configUSE_RCU == 1 )
+        UBaseType_t uxRcuReadNesting; /*< The depth of nested RCU read-side critical sections the task is inside. */
+        uint8_t ucRcuPreemptedPhase;  /*< The grace period phase in which the task was switched out inside a read-side critical section, or taskRCU_NOT_PREEMPTED. */
+    #endif
+
+    #if ( configUSE_STACK_TIERING == 1 )
+        StackType_t * pxStackBackingStore;       /*< The stack the task was created with, which holds the task's stack while it is not in the task's slot.  NULL if the task does not use stack tiering. */
+        TickType_t xStackTierLastRun;            /*< The tick count when the task was last switched out. */
+        UBaseType_t uxStackTierSlot;             /*< The index of the slot the task runs on.  pxStack points to the start of the slot. */
+        configSTACK_DEPTH_TYPE uxStackTierDepth; /*< The depth of the task's stack in words. */
+    #endif
+
+    #if ( configUSE_TASK_NOTIFY_WAIT_BITS == 1 )
+        uint32_t ulNotifyWaitBits;      /*< The notification bits the task is waiting for in ulTaskGenericNotifyWaitBits(), or 0 if any notification unblocks the task. */
+        BaseType_t xNotifyWaitForAllBits; /*< pdTRUE if all of ulNotifyWaitBits must be set to unblock the task, pdFALSE if any one of them is enough. */
+    #endif
+
     #if ( configUSE_APPLICATION_TASK_TAG == 1 )
         TaskHookFunction_t pxTaskTag;
     #endif
@@ -324,6 +447,68 @@ typedef struct tskTaskControlBlock       /* The old naming convention is used to
  * below to enable the use of older kernel aware debuggers. */
 typedef tskTCB TCB_t;
 
+#if ( configUSE_TASK_GROUPS == 1 )
+
+/*
+ * A task group is a list of tasks that can be suspended, resumed or have
+ * their priority changed together.  A task belongs to at most one group.
+ */
+    typedef struct tskTaskGroup
+    {
+        List_t xMemberList; /*< Tasks in the group, referenced through their xGroupListItem. */
+
+        #if ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+            uint8_t ucStaticallyAllocated; /*< Set to pdTRUE if the group is statically allocated to ensure no attempt is made to free the memory. */
+        #endif
+    } TaskGroup_t;
+
+#endif /* configUSE_TASK_GROUPS */
+
+#if ( configUSE_DEADLINE_TIMERS == 1 )
+
+/*
+ * A deadline timer is held in the delayed task lists alongside the blocked
+ * tasks.  Its first member overlays pxTopOfStack in the TCB and always points
+ * to ucDeadlineTimerTag, which no stack can, so the owner of a delayed list
+ * item can be told apart from a task with taskIS_DEADLINE_TIMER().
+ */
+    typedef struct tskDeadlineTimer
+    {
+        const void * pvTag;                          /*< Always &ucDeadlineTimerTag.  MUST BE THE FIRST MEMBER OF THE STRUCT. */
+        ListItem_t xDeadlineListItem;                /*< Referenced from the delayed task lists while the timer is running.  The item value is the expiry time. */
+        TickType_t xPeriod;                          /*< Ticks between expiries, or 0 for a one-shot timer. */
+        DeadlineTimerCallback_t pxCallback;          /*< Called from the tick when the timer expires. */
+        void * pvContext;                            /*< Returned by pvTaskDeadlineTimerGetContext(). */
+        struct tskDeadlineTimer * pxNextRequest;     /*< Links timers started or stopped from an interrupt while the scheduler was suspended. */
+        TickType_t xRequestDelay;                    /*< xDelay of a pending start request. */
+        TickType_t xRequestPeriod;                   /*< xPeriod of a pending start request. */
+        uint8_t ucRequest;                           /*< One of the taskDEADLINE_TIMER_* request values. */
+    } DeadlineTimer_t;
+
+    static const uint8_t ucDeadlineTimerTag = 0U;
+
+    #define taskIS_DEADLINE_TIMER( pvOwner )    ( *( ( const void * const * ) ( pvOwner ) ) == ( const void * ) &ucDeadlineTimerTag )
+
+/* Values that can be assigned to the ucRequest member of a deadline timer. */
+    #define taskDEADLINE_TIMER_NO_REQUEST           ( ( uint8_t ) 0 )
+    #define taskDEADLINE_TIMER_START_REQUESTED      ( ( uint8_t ) 1 )
+    #define taskDEADLINE_TIMER_STOP_REQUESTED       ( ( uint8_t ) 2 )
+    #define taskDEADLINE_TIMER_REQUEST_DISCARDED    ( ( uint8_t ) 3 )
+
+#else
+
+    #define taskIS_DEADLINE_TIMER( pvOwner )    ( pdFALSE )
+
+#endif /* configUSE_DEADLINE_TIMERS */
+
+/* The variables read by the inline queries in kernel_inline.h are only given
+ * external linkage when configUSE_INLINE_KERNEL_QUERIES is 1. */
+#if ( configUSE_INLINE_KERNEL_QUERIES == 1 )
+    #define tskINLINE_QUERY_DATA
+#else
+    #define tskINLINE_QUERY_DATA    static
+#endif
+
 /*lint -save -e956 A manual analysis and inspection has been used to determine
  * which static variables must be declared volatile. */
 portDONT_DISCARD PRIVILEGED_DATA TCB_t * volatile pxCurrentTCB = NULL;
@@ -352,6 +537,18 @@ PRIVILEGED_DATA static List_t xPendingReadyList;                         /*< Tas
 
 #endif
 
+#if ( configUSE_TIME_TRIGGERED_SCHEDULE == 1 )
+
+    PRIVILEGED_DATA static List_t xTimeTriggeredWaitingList; /*< Tasks that are waiting for their time triggered slot to be released. */
+
+#endif
+
+#if ( configUSE_DEADLINE_TIMERS == 1 )
+
+    PRIVILEGED_DATA static DeadlineTimer_t * volatile pxDeadlineTimerRequests = NULL; /*< Deadline timers started or stopped from an interrupt while the scheduler was suspended.  They are started or stopped when the scheduler is resumed. */
+
+#endif
+
 /* Global POSIX errno. Its value is changed upon context switching to match
  * the errno of the currently running task. */
 #if ( configUSE_POSIX_ERRNO == 1 )
@@ -360,9 +557,9 @@ PRIVILEGED_DATA static List_t xPendingReadyList;                         /*< Tas
 
 /* Other file private variables. --------------------------------*/
 PRIVILEGED_DATA static volatile UBaseType_t uxCurrentNumberOfTasks = ( UBaseType_t ) 0U;
-PRIVILEGED_DATA static volatile TickType_t xTickCount = ( TickType_t ) configINITIAL_TICK_COUNT;
+PRIVILEGED_DATA tskINLINE_QUERY_DATA volatile TickType_t xTickCount = ( TickType_t ) configINITIAL_TICK_COUNT;
 PRIVILEGED_DATA static volatile UBaseType_t uxTopReadyPriority = tskIDLE_PRIORITY;
-PRIVILEGED_DATA static volatile BaseType_t xSchedulerRunning = pdFALSE;
+PRIVILEGED_DATA tskINLINE_QUERY_DATA volatile BaseType_t xSchedulerRunning = pdFALSE;
 PRIVILEGED_DATA static volatile TickType_t xPendedTicks = ( TickType_t ) 0U;
 PRIVILEGED_DATA static volatile BaseType_t xYieldPending = pdFALSE;
 PRIVILEGED_DATA static volatile BaseType_t xNumOfOverflows = ( BaseType_t ) 0;
@@ -383,7 +580,23 @@ const volatile UBaseType_t uxTopUsedPriority = configMAX_PRIORITIES - 1U;
  * kernel to move the task from the pending ready list into the real ready list
  * when the scheduler is unsuspended.  The pending ready list itself can only be
  * accessed from a critical section. */
-PRIVILEGED_DATA static volatile UBaseType_t uxSchedulerSuspended = ( UBaseType_t ) pdFALSE;
+PRIVILEGED_DATA tskINLINE_QUERY_DATA volatile UBaseType_t uxSchedulerSuspended = ( UBaseType_t ) pdFALSE;
+
+#if ( configUSE_DEFERRED_TICK_PROCESSING == 1 )
+
+/* Ticks counted by the tick interrupt that vTaskProcessDeferredTicks() has not
+ * yet processed.  Only accessed from interrupts at the tick priority. */
+    PRIVILEGED_DATA static volatile TickType_t xDeferredTicks = ( TickType_t ) 0U;
+
+#endif
+
+#if ( configUSE_ADAPTIVE_TICK == 1 )
+
+/* pdTRUE while vTaskEnterAdaptiveTick() has the port deferring the tick
+ * interrupt.  Only written with interrupts masked. */
+    PRIVILEGED_DATA static volatile BaseType_t xAdaptiveTickActive = pdFALSE;
+
+#endif
 
 #if ( configGENERATE_RUN_TIME_STATS == 1 )
 
@@ -394,6 +607,80 @@ PRIVILEGED_DATA static volatile UBaseType_t uxSchedulerSuspended = ( UBaseType_t
 
 #endif
 
+#if ( configUSE_PROPORTIONAL_SHARE == 1 )
+
+    PRIVILEGED_DATA static uint32_t ulShareSwitchedInCycles = 0UL;  /*< Cycle counter value when the running task was switched in. */
+    PRIVILEGED_DATA static uint64_t ullShareVirtualTime = 0ULL;     /*< Pass of the most recently selected proportional share task. */
+    PRIVILEGED_DATA static uint64_t ullShareBandCycles = 0ULL;      /*< Total cycles charged to tasks at configPROPORTIONAL_SHARE_PRIORITY. */
+    PRIVILEGED_DATA static uint32_t ulShareMaxCredit = 0UL;         /*< configPROPORTIONAL_SHARE_MAX_CREDIT, evaluated once when the scheduler starts as it can depend on the CPU clock. */
+
+#endif
+
+#if ( configUSE_TIME_TRIGGERED_SCHEDULE == 1 )
+
+/* The run time state of one slot of the time triggered schedule table. */
+    typedef struct tskTimeTriggeredSlotState
+    {
+        TCB_t * pxTask;                  /*< The task that owns the slot, or NULL if no task has waited for it yet. */
+        TickType_t xReleaseTick;         /*< The tick on which the slot was last released. */
+        uint32_t ulReleaseCycles;        /*< The cycle counter value when the slot was last released. */
+        uint8_t ucState;                 /*< One of the taskSLOT_ values. */
+        TimeTriggeredSlotStats_t xStats; /*< Returned by vTaskGetSlotStats(). */
+    } TimeTriggeredSlotState_t;
+
+    PRIVILEGED_DATA static const TimeTriggeredSlot_t * pxTimeTriggeredSchedule = NULL;                  /*< The schedule table, or NULL if the schedule has not been started. */
+    PRIVILEGED_DATA static UBaseType_t uxTimeTriggeredSlots = ( UBaseType_t ) 0U;                      /*< The number of slots in the schedule table. */
+    PRIVILEGED_DATA static TickType_t xTimeTriggeredMajorFrame = ( TickType_t ) 0U;                    /*< The length of the major frame in ticks. */
+    PRIVILEGED_DATA static TickType_t xTimeTriggeredFrameStart = ( TickType_t ) 0U;                    /*< The tick on which the current major frame started. */
+    PRIVILEGED_DATA static UBaseType_t uxNextTimeTriggeredSlot = ( UBaseType_t ) 0U;                   /*< The index of the next slot to be released. */
+    PRIVILEGED_DATA static TickType_t xNextTimeTriggeredRelease = ( TickType_t ) 0U;                   /*< The tick on which uxNextTimeTriggeredSlot is released. */
+    PRIVILEGED_DATA static TimeTriggeredSlotState_t xTimeTriggeredSlotStates[ configTIME_TRIGGERED_MAX_SLOTS ]; /*< The run time state of each slot in the schedule table. */
+
+#endif
+
+#if ( configUSE_TIME_PARTITIONS == 1 )
+
+    PRIVILEGED_DATA static const PartitionWindow_t * pxPartitionWindows = NULL;                           /*< The window table, or NULL if the partition schedule has not been started. */
+    PRIVILEGED_DATA static UBaseType_t uxPartitionWindows = ( UBaseType_t ) 0U;                            /*< The number of windows in the window table. */
+    PRIVILEGED_DATA static UBaseType_t uxCurrentPartitionWindow = ( UBaseType_t ) 0U;                      /*< The index of the open window. */
+    PRIVILEGED_DATA static TickType_t xPartitionWindowTicksLeft = ( TickType_t ) 0U;                       /*< The number of ticks until the open window closes. */
+    PRIVILEGED_DATA static UBaseType_t uxActivePartition = ( UBaseType_t ) configNUM_PARTITIONS;           /*< The partition that owns the open window, or configNUM_PARTITIONS if no window is open. */
+    PRIVILEGED_DATA static PartitionStats_t xPartitionStats[ configNUM_PARTITIONS ];                       /*< Returned by vTaskGetPartitionStats(). */
+
+#endif
+
+#if ( configUSE_RCU == 1 )
+
+    PRIVILEGED_DATA static UBaseType_t uxRcuPhase = ( UBaseType_t ) 0U;                                        /*< The phase of the grace period in progress, 0 or 1. */
+    PRIVILEGED_DATA static volatile UBaseType_t uxRcuPreemptedReaders[ 2 ] = { ( UBaseType_t ) 0U, ( UBaseType_t ) 0U }; /*< The number of tasks switched out inside a read-side critical section in each phase that have not yet left it. */
+
+#endif
+
+#if ( configUSE_STACK_TIERING == 1 )
+
+/* The state of one fast memory stack slot. */
+    typedef struct tskStackTierSlot
+    {
+        TCB_t * pxResident;  /*< The task whose stack is in the slot, or NULL if the slot holds no stack. */
+        BaseType_t xDirty;   /*< pdTRUE if the resident has run since its stack was last copied to its backing store. */
+        UBaseType_t uxTasks; /*< The number of tasks that run on the slot. */
+    } StackTierSlot_t;
+
+/* The slots themselves.  Not PRIVILEGED_DATA as configSTACK_TIER_SLOT_ATTRIBUTE
+ * chooses where they are placed. */
+    static StackType_t uxStackTierSlotStacks[ configSTACK_TIER_SLOTS ][ configSTACK_TIER_SLOT_DEPTH ] configSTACK_TIER_SLOT_ATTRIBUTE;
+
+    PRIVILEGED_DATA static StackTierSlot_t xStackTierSlots[ configSTACK_TIER_SLOTS ];   /*< The state of each slot. */
+    PRIVILEGED_DATA static StackTierStats_t xStackTierStats = { 0UL, 0UL, 0UL };         /*< Returned by vTaskGetStackTierStats(). */
+
+#endif
+
+#if ( configUSE_PRIORITY_INHERITANCE_CHAIN == 1 )
+
+    PRIVILEGED_DATA static UBaseType_t uxInheritanceChainHighWaterMark = ( UBaseType_t ) 0U; /*< The longest chain of tasks whose priority was raised by a single inheritance. */
+
+#endif
+
 /*lint -restore */
 
 /*-----------------------------------------------------------*/
@@ -411,6 +698,51 @@ PRIVILEGED_DATA static volatile UBaseType_t uxSchedulerSuspended = ( UBaseType_t
 
 #endif /* INCLUDE_vTaskSuspend */
 
+/*
+ * Move a task into the Suspended state.  Must be called from a critical
+ * section, and the caller is responsible for any resulting context switch.
+ */
+#if ( INCLUDE_vTaskSuspend == 1 )
+
+    static void prvSuspendTask( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif /* INCLUDE_vTaskSuspend */
+
+/*
+ * Called after the running task has been placed in the Suspended state, to
+ * either yield or, if the scheduler has not been started, select another task
+ * for pxCurrentTCB.
+ */
+#if ( INCLUDE_vTaskSuspend == 1 )
+
+    static void prvSwitchAwayFromSuspendedTask( void ) PRIVILEGED_FUNCTION;
+
+#endif /* INCLUDE_vTaskSuspend */
+
+/*
+ * Move a task that prvTaskIsTaskSuspended() reported as suspended back into
+ * its ready list.  Must be called from a critical section.  Returns pdTRUE if
+ * the resumed task has a priority at or above that of the running task, in
+ * which case the caller should yield.
+ */
+#if ( INCLUDE_vTaskSuspend == 1 )
+
+    static BaseType_t prvResumeTask( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif /* INCLUDE_vTaskSuspend */
+
+/*
+ * Set the base priority of a task, moving it to a new ready list if needed.
+ * Must be called from a critical section.  Returns pdTRUE if the change means
+ * a context switch is required, which the caller is responsible for.
+ */
+#if ( INCLUDE_vTaskPrioritySet == 1 )
+
+    static BaseType_t prvSetBasePriority( TCB_t * pxTCB,
+                                          UBaseType_t uxNewPriority ) PRIVILEGED_FUNCTION;
+
+#endif /* INCLUDE_vTaskPrioritySet */
+
 /*
  * Utility to ready all the lists used by the scheduler.  This is called
  * automatically upon the creation of the first task.
@@ -516,6 +848,176 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
  */
 static void prvResetNextTaskUnblockTime( void ) PRIVILEGED_FUNCTION;
 
+#if ( configUSE_PRIORITY_INHERITANCE_CHAIN == 1 )
+
+/*
+ * Mutex wait lists are ordered by priority, so a task that is blocked on a
+ * mutex must be re-inserted into the wait list whenever its priority changes.
+ */
+    static void prvResortMutexWaiter( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+/*
+ * Change the priority of a task that is further along a priority inheritance
+ * chain, moving it to the matching ready list or re-sorting it within the wait
+ * list of the mutex it is blocked on.
+ */
+    static void prvSetChainedPriority( TCB_t * pxTCB,
+                                       UBaseType_t uxNewPriority ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called after the holder of a mutex has inherited uxPriority.  If the holder
+ * is itself blocked on a mutex then the holder of that mutex inherits the same
+ * priority, and so on, up to configMAX_PRIORITY_INHERITANCE_CHAIN_DEPTH tasks.
+ */
+    static void prvPropagateInheritedPriority( TCB_t * pxMutexHolderTCB,
+                                               UBaseType_t uxPriority ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called after the priority of a mutex holder has been lowered because a
+ * waiting task timed out.  Tasks further along the chain are lowered as far as
+ * the highest priority task still waiting for the mutex they hold.
+ */
+    static void prvUnwindInheritedPriority( TCB_t * pxMutexHolderTCB ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_PRIORITY_INHERITANCE_CHAIN */
+
+#if ( configUSE_PROPORTIONAL_SHARE == 1 )
+
+/*
+ * Charge the cycles used since the last context switch to the task being
+ * switched out, if it ran at configPROPORTIONAL_SHARE_PRIORITY.
+ */
+    static void prvChargeProportionalShare( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called when configPROPORTIONAL_SHARE_PRIORITY is the highest ready priority
+ * to replace the round robin choice with the ready task that has the lowest
+ * pass.
+ */
+    static void prvSelectProportionalShareTask( void ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_PROPORTIONAL_SHARE */
+
+#if ( configUSE_DEADLINE_TIMERS == 1 )
+
+/*
+ * Insert a deadline timer into the delayed task lists to expire at xExpiry.
+ * xBase is the time xExpiry was calculated from, which tells whether xExpiry
+ * has wrapped past the current list into the overflow list.  Called with
+ * interrupts masked.
+ */
+    static void prvInsertDeadlineTimer( DeadlineTimer_t * pxTimer,
+                                        TickType_t xExpiry,
+                                        TickType_t xBase ) PRIVILEGED_FUNCTION;
+
+/*
+ * Start or stop a deadline timer.  Called with interrupts masked and the
+ * scheduler not suspended, or from the task that suspended it.
+ */
+    static void prvStartDeadlineTimer( DeadlineTimer_t * pxTimer,
+                                       TickType_t xDelay,
+                                       TickType_t xPeriod ) PRIVILEGED_FUNCTION;
+    static void prvStopDeadlineTimer( DeadlineTimer_t * pxTimer ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called from the tick when the deadline timer at the head of the delayed
+ * list is due.  Re-arms a periodic timer then calls the callback.  Returns the
+ * callback's pxHigherPriorityTaskWoken value.
+ */
+    static BaseType_t prvExpireDeadlineTimer( DeadlineTimer_t * pxTimer ) PRIVILEGED_FUNCTION;
+
+/*
+ * Carry out the requests made from interrupts while the scheduler was
+ * suspended.  Called from xTaskResumeAll().
+ */
+    static void prvProcessDeadlineTimerRequests( void ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_DEADLINE_TIMERS */
+
+#if ( configUSE_TIME_TRIGGERED_SCHEDULE == 1 )
+
+/*
+ * Called from the tick interrupt to release the slots of the time triggered
+ * schedule that fall due on xConstTickCount.  Returns pdTRUE if a released
+ * task has a priority above that of the running task.
+ */
+    static BaseType_t prvReleaseTimeTriggeredSlots( const TickType_t xConstTickCount ) PRIVILEGED_FUNCTION;
+
+/*
+ * Complete any slot the task was released into, counting an overrun if the
+ * task ran for longer than the slot's budget.  Must be called from within a
+ * critical section.
+ */
+    static void prvCompleteTimeTriggeredSlots( const TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_TIME_TRIGGERED_SCHEDULE */
+
+#if ( configUSE_TIME_PARTITIONS == 1 )
+
+/*
+ * Called when the task chosen by priority does not belong to the partition
+ * that owns the open window.  Chooses the highest priority ready task of that
+ * partition instead, or of the background partition if it has none.
+ */
+    static void prvSelectPartitionTask( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called from the tick interrupt to update the partition statistics and to
+ * open the next window when the open one closes.  Returns pdTRUE if a new
+ * window was opened.
+ */
+    static BaseType_t prvUpdatePartitionWindow( void ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_TIME_PARTITIONS */
+
+#if ( configUSE_STACK_TIERING == 1 )
+
+/*
+ * Copy the used part of the stack of a task that uses stack tiering into its
+ * slot when xToSlot is pdTRUE, or out to its backing store when xToSlot is
+ * pdFALSE.
+ */
+    static void prvCopyTieredStack( const TCB_t * const pxTCB,
+                                    const BaseType_t xToSlot ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called as a task that uses stack tiering is switched in to bring its stack
+ * into its slot, first copying out the stack of the task already there.
+ */
+    static void prvLoadTieredStack( TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called by the idle task to copy the stacks of tasks that have not run for
+ * configSTACK_TIER_WRITE_BACK_TICKS to their backing stores, so the next task
+ * to use each slot does not have to.
+ */
+    static void prvWriteBackTieredStacks( void ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_STACK_TIERING */
+
+#if ( configUSE_TASK_NOTIFY_WAIT_BITS == 1 )
+
+/*
+ * Returns pdTRUE if the notification value at uxIndex holds the bits pxTCB is
+ * waiting for, or if pxTCB is not waiting for particular bits.  Called from a
+ * critical section.
+ */
+    static BaseType_t prvNotifyWaitConditionMet( const TCB_t * const pxTCB,
+                                                 UBaseType_t uxIndex ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called by the notify functions after updating the notification value at
+ * uxIndex of pxTCB.  A task waiting for particular bits that the value does
+ * not yet hold is left blocked and still waiting.  Returns the notify state
+ * the caller should act on, which is taskNOT_WAITING_NOTIFICATION in that
+ * case and ucOriginalNotifyState otherwise.  Called from a critical section.
+ */
+    static uint8_t prvFilterNotifyWaitBits( TCB_t * const pxTCB,
+                                            UBaseType_t uxIndex,
+                                            uint8_t ucOriginalNotifyState ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_TASK_NOTIFY_WAIT_BITS */
+
 #if ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 )
 
 /*
@@ -844,7 +1346,7 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
     #if ( tskSET_NEW_STACKS_TO_KNOWN_VALUE == 1 )
     {
         /* Fill the stack with a known value to assist debugging. */
-        ( void ) memset( pxNewTCB->pxStack, ( int ) tskSTACK_FILL_BYTE, ( size_t ) ulStackDepth * sizeof( StackType_t ) );
+        portMEMSET( pxNewTCB->pxStack, ( int ) tskSTACK_FILL_BYTE, ( size_t ) ulStackDepth * sizeof( StackType_t ) );
     }
     #endif /* tskSET_NEW_STACKS_TO_KNOWN_VALUE */
 
@@ -940,6 +1442,49 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
     listSET_LIST_ITEM_VALUE( &( pxNewTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxPriority ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
     listSET_LIST_ITEM_OWNER( &( pxNewTCB->xEventListItem ), pxNewTCB );
 
+    #if ( configUSE_TASK_GROUPS == 1 )
+    {
+        vListInitialiseItem( &( pxNewTCB->xGroupListItem ) );
+        listSET_LIST_ITEM_OWNER( &( pxNewTCB->xGroupListItem ), pxNewTCB );
+    }
+    #endif
+
+    #if ( configUSE_PROPORTIONAL_SHARE == 1 )
+    {
+        /* The pass is set to the current virtual time when the task is
+         * added to the ready list. */
+        pxNewTCB->ulShareWeight = configPROPORTIONAL_SHARE_DEFAULT_WEIGHT;
+        pxNewTCB->ulShareStride = taskSHARE_STRIDE1 / ( uint32_t ) configPROPORTIONAL_SHARE_DEFAULT_WEIGHT;
+        pxNewTCB->ullShareCycles = 0ULL;
+    }
+    #endif
+
+    #if ( configUSE_TIME_PARTITIONS == 1 )
+    {
+        pxNewTCB->uxPartition = ( UBaseType_t ) 0U;
+    }
+    #endif
+
+    #if ( configUSE_RCU == 1 )
+    {
+        pxNewTCB->uxRcuReadNesting = ( UBaseType_t ) 0U;
+        pxNewTCB->ucRcuPreemptedPhase = taskRCU_NOT_PREEMPTED;
+    }
+    #endif
+
+    #if ( configUSE_STACK_TIERING == 1 )
+    {
+        pxNewTCB->pxStackBackingStore = NULL;
+    }
+    #endif
+
+    #if ( configUSE_TASK_NOTIFY_WAIT_BITS == 1 )
+    {
+        pxNewTCB->ulNotifyWaitBits = 0UL;
+        pxNewTCB->xNotifyWaitForAllBits = pdFALSE;
+    }
+    #endif
+
     #if ( portUSING_MPU_WRAPPERS == 1 )
     {
         vPortStoreTaskMPUSettings( &( pxNewTCB->xMPUSettings ), xRegions, pxNewTCB->pxStack, ulStackDepth );
@@ -1031,6 +1576,14 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
     {
         uxCurrentNumberOfTasks++;
 
+        #if ( configUSE_PROPORTIONAL_SHARE == 1 )
+        {
+            /* A new task starts level with the tasks already in the band
+             * rather than owed all the time since the scheduler started. */
+            pxNewTCB->ullSharePass = ullShareVirtualTime;
+        }
+        #endif
+
         if( pxCurrentTCB == NULL )
         {
             /* There are no other tasks, or all the other tasks are in
@@ -1139,24 +1692,109 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
                 mtCOVERAGE_TEST_MARKER();
             }
 
-            /* Increment the uxTaskNumber also so kernel aware debuggers can
-             * detect that the task lists need re-generating.  This is done before
-             * portPRE_TASK_DELETE_HOOK() as in the Windows port that macro will
-             * not return. */
-            uxTaskNumber++;
+            #if ( configUSE_TASK_GROUPS == 1 )
+            {
+                /* Is the task a member of a task group? */
+                if( listLIST_ITEM_CONTAINER( &( pxTCB->xGroupListItem ) ) != NULL )
+                {
+                    ( void ) uxListRemove( &( pxTCB->xGroupListItem ) );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif
 
-            if( pxTCB == pxCurrentTCB )
+            #if ( configUSE_STACK_TIERING == 1 )
             {
-                /* A task is deleting itself.  This cannot complete within the
-                 * task itself, as a context switch to another task is required.
-                 * Place the task in the termination list.  The idle task will
-                 * check the termination list and free up any memory allocated by
-                 * the scheduler for the TCB and stack of the deleted task. */
-                vListInsertEnd( &xTasksWaitingTermination, &( pxTCB->xStateListItem ) );
+                StackTierSlot_t * pxSlot;
 
-                /* Increment the ucTasksDeleted variable so the idle task knows
-                 * there is a task that has been deleted and that it should therefore
-                 * check the xTasksWaitingTermination list. */
+                if( pxTCB->pxStackBackingStore != NULL )
+                {
+                    pxSlot = &( xStackTierSlots[ pxTCB->uxStackTierSlot ] );
+
+                    /* The slot no longer holds a stack that must be kept.  A
+                     * task deleting itself keeps running on the slot until it
+                     * is switched out, after which nothing uses the stack. */
+                    ( pxSlot->uxTasks )--;
+
+                    if( pxSlot->pxResident == pxTCB )
+                    {
+                        pxSlot->pxResident = NULL;
+                        pxSlot->xDirty = pdFALSE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif
+
+            #if ( configUSE_RCU == 1 )
+            {
+                /* A task deleted inside a read-side critical section must not
+                 * hold up grace periods forever.  Clearing the nesting count
+                 * also stops a task that deletes itself from being counted when
+                 * it is switched out. */
+                if( pxTCB->ucRcuPreemptedPhase != taskRCU_NOT_PREEMPTED )
+                {
+                    uxRcuPreemptedReaders[ pxTCB->ucRcuPreemptedPhase ]--;
+                    pxTCB->ucRcuPreemptedPhase = taskRCU_NOT_PREEMPTED;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                pxTCB->uxRcuReadNesting = ( UBaseType_t ) 0U;
+            }
+            #endif
+
+            #if ( configUSE_TIME_TRIGGERED_SCHEDULE == 1 )
+            {
+                UBaseType_t uxSlot;
+
+                /* Give up any time triggered slots owned by the task so
+                 * another task can wait for them. */
+                for( uxSlot = ( UBaseType_t ) 0U; uxSlot < uxTimeTriggeredSlots; uxSlot++ )
+                {
+                    if( xTimeTriggeredSlotStates[ uxSlot ].pxTask == pxTCB )
+                    {
+                        xTimeTriggeredSlotStates[ uxSlot ].pxTask = NULL;
+                        xTimeTriggeredSlotStates[ uxSlot ].ucState = taskSLOT_IDLE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            }
+            #endif
+
+            /* Increment the uxTaskNumber also so kernel aware debuggers can
+             * detect that the task lists need re-generating.  This is done before
+             * portPRE_TASK_DELETE_HOOK() as in the Windows port that macro will
+             * not return. */
+            uxTaskNumber++;
+
+            if( pxTCB == pxCurrentTCB )
+            {
+                /* A task is deleting itself.  This cannot complete within the
+                 * task itself, as a context switch to another task is required.
+                 * Place the task in the termination list.  The idle task will
+                 * check the termination list and free up any memory allocated by
+                 * the scheduler for the TCB and stack of the deleted task. */
+                vListInsertEnd( &xTasksWaitingTermination, &( pxTCB->xStateListItem ) );
+
+                /* Increment the ucTasksDeleted variable so the idle task knows
+                 * there is a task that has been deleted and that it should therefore
+                 * check the xTasksWaitingTermination list. */
                 ++uxDeletedTasksWaitingCleanUp;
 
                 /* Call the delete hook before portPRE_TASK_DELETE_HOOK() as
@@ -1223,9 +1861,15 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
 
         vTaskSuspendAll();
         {
+            TickType_t xConstTickCount;
+
+            /* Restored after suspending the scheduler, so the tick cannot be
+             * deferred again before the count is read. */
+            taskEXIT_ADAPTIVE_TICK();
+
             /* Minor optimisation.  The tick count cannot change in this
              * block. */
-            const TickType_t xConstTickCount = xTickCount;
+            xConstTickCount = xTickCount;
 
             /* Generate the tick time at which the task wants to wake. */
             xTimeToWake = *pxPreviousWakeTime + xTimeIncrement;
@@ -1274,7 +1918,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
             }
             else
             {
-                mtCOVERAGE_TEST_MARKER();
+                traceTASK_DELAY_UNTIL_MISSED( xTimeToWake );
             }
         }
         xAlreadyYielded = xTaskResumeAll();
@@ -1375,6 +2019,15 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
                 eReturn = eBlocked;
             }
 
+            #if ( configUSE_TIME_TRIGGERED_SCHEDULE == 1 )
+                else if( pxStateList == &xTimeTriggeredWaitingList )
+                {
+                    /* The task being queried is waiting for its time
+                     * triggered slot to be released. */
+                    eReturn = eBlocked;
+                }
+            #endif
+
             #if ( INCLUDE_vTaskSuspend == 1 )
                 else if( pxStateList == &xSuspendedTaskList )
                 {
@@ -1504,271 +2157,228 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
 
 #if ( INCLUDE_vTaskPrioritySet == 1 )
 
-    void vTaskPrioritySet( TaskHandle_t xTask,
-                           UBaseType_t uxNewPriority )
+    static BaseType_t prvSetBasePriority( TCB_t * pxTCB,
+                                          UBaseType_t uxNewPriority )
     {
-        TCB_t * pxTCB;
         UBaseType_t uxCurrentBasePriority, uxPriorityUsedOnEntry;
         BaseType_t xYieldRequired = pdFALSE;
 
-        configASSERT( uxNewPriority < configMAX_PRIORITIES );
-
-        /* Ensure the new priority is valid. */
-        if( uxNewPriority >= ( UBaseType_t ) configMAX_PRIORITIES )
+        #if ( configUSE_MUTEXES == 1 )
         {
-            uxNewPriority = ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) 1U;
+            uxCurrentBasePriority = pxTCB->uxBasePriority;
         }
-        else
+        #else
         {
-            mtCOVERAGE_TEST_MARKER();
+            uxCurrentBasePriority = pxTCB->uxPriority;
         }
+        #endif
 
-        taskENTER_CRITICAL();
+        if( uxCurrentBasePriority != uxNewPriority )
         {
-            /* If null is passed in here then it is the priority of the calling
-             * task that is being changed. */
-            pxTCB = prvGetTCBFromHandle( xTask );
-
-            traceTASK_PRIORITY_SET( pxTCB, uxNewPriority );
-
-            #if ( configUSE_MUTEXES == 1 )
-            {
-                uxCurrentBasePriority = pxTCB->uxBasePriority;
-            }
-            #else
-            {
-                uxCurrentBasePriority = pxTCB->uxPriority;
-            }
-            #endif
-
-            if( uxCurrentBasePriority != uxNewPriority )
+            /* The priority change may have readied a task of higher
+             * priority than the calling task. */
+            if( uxNewPriority > uxCurrentBasePriority )
             {
-                /* The priority change may have readied a task of higher
-                 * priority than the calling task. */
-                if( uxNewPriority > uxCurrentBasePriority )
+                if( pxTCB != pxCurrentTCB )
                 {
-                    if( pxTCB != pxCurrentTCB )
+                    /* The priority of a task other than the currently
+                     * running task is being raised.  Is the priority being
+                     * raised above that of the running task? */
+                    if( uxNewPriority >= pxCurrentTCB->uxPriority )
                     {
-                        /* The priority of a task other than the currently
-                         * running task is being raised.  Is the priority being
-                         * raised above that of the running task? */
-                        if( uxNewPriority >= pxCurrentTCB->uxPriority )
-                        {
-                            xYieldRequired = pdTRUE;
-                        }
-                        else
-                        {
-                            mtCOVERAGE_TEST_MARKER();
-                        }
+                        xYieldRequired = pdTRUE;
                     }
                     else
                     {
-                        /* The priority of the running task is being raised,
-                         * but the running task must already be the highest
-                         * priority task able to run so no yield is required. */
+                        mtCOVERAGE_TEST_MARKER();
                     }
                 }
-                else if( pxTCB == pxCurrentTCB )
-                {
-                    /* Setting the priority of the running task down means
-                     * there may now be another task of higher priority that
-                     * is ready to execute. */
-                    xYieldRequired = pdTRUE;
-                }
                 else
                 {
-                    /* Setting the priority of any other task down does not
-                     * require a yield as the running task must be above the
-                     * new priority of the task being modified. */
+                    /* The priority of the running task is being raised,
+                     * but the running task must already be the highest
+                     * priority task able to run so no yield is required. */
                 }
+            }
+            else if( pxTCB == pxCurrentTCB )
+            {
+                /* Setting the priority of the running task down means
+                 * there may now be another task of higher priority that
+                 * is ready to execute. */
+                xYieldRequired = pdTRUE;
+            }
+            else
+            {
+                /* Setting the priority of any other task down does not
+                 * require a yield as the running task must be above the
+                 * new priority of the task being modified. */
+            }
 
-                /* Remember the ready list the task might be referenced from
-                 * before its uxPriority member is changed so the
-                 * taskRESET_READY_PRIORITY() macro can function correctly. */
-                uxPriorityUsedOnEntry = pxTCB->uxPriority;
-
-                #if ( configUSE_MUTEXES == 1 )
-                {
-                    /* Only change the priority being used if the task is not
-                     * currently using an inherited priority. */
-                    if( pxTCB->uxBasePriority == pxTCB->uxPriority )
-                    {
-                        pxTCB->uxPriority = uxNewPriority;
-                    }
-                    else
-                    {
-                        mtCOVERAGE_TEST_MARKER();
-                    }
+            /* Remember the ready list the task might be referenced from
+             * before its uxPriority member is changed so the
+             * taskRESET_READY_PRIORITY() macro can function correctly. */
+            uxPriorityUsedOnEntry = pxTCB->uxPriority;
 
-                    /* The base priority gets set whatever. */
-                    pxTCB->uxBasePriority = uxNewPriority;
-                }
-                #else /* if ( configUSE_MUTEXES == 1 ) */
+            #if ( configUSE_MUTEXES == 1 )
+            {
+                /* Only change the priority being used if the task is not
+                 * currently using an inherited priority. */
+                if( pxTCB->uxBasePriority == pxTCB->uxPriority )
                 {
                     pxTCB->uxPriority = uxNewPriority;
                 }
-                #endif /* if ( configUSE_MUTEXES == 1 ) */
-
-                /* Only reset the event list item value if the value is not
-                 * being used for anything else. */
-                if( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
-                {
-                    listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxNewPriority ) ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
-                }
                 else
                 {
                     mtCOVERAGE_TEST_MARKER();
                 }
 
-                /* If the task is in the blocked or suspended list we need do
-                 * nothing more than change its priority variable. However, if
-                 * the task is in a ready list it needs to be removed and placed
-                 * in the list appropriate to its new priority. */
-                if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ uxPriorityUsedOnEntry ] ), &( pxTCB->xStateListItem ) ) != pdFALSE )
-                {
-                    /* The task is currently in its ready list - remove before
-                     * adding it to its new ready list.  As we are in a critical
-                     * section we can do this even if the scheduler is suspended. */
-                    if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
-                    {
-                        /* It is known that the task is in its ready list so
-                         * there is no need to check again and the port level
-                         * reset macro can be called directly. */
-                        portRESET_READY_PRIORITY( uxPriorityUsedOnEntry, uxTopReadyPriority );
-                    }
-                    else
-                    {
-                        mtCOVERAGE_TEST_MARKER();
-                    }
+                /* The base priority gets set whatever. */
+                pxTCB->uxBasePriority = uxNewPriority;
+            }
+            #else /* if ( configUSE_MUTEXES == 1 ) */
+            {
+                pxTCB->uxPriority = uxNewPriority;
+            }
+            #endif /* if ( configUSE_MUTEXES == 1 ) */
 
-                    prvAddTaskToReadyList( pxTCB );
-                }
-                else
-                {
-                    mtCOVERAGE_TEST_MARKER();
-                }
+            /* Only reset the event list item value if the value is not
+             * being used for anything else. */
+            if( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
+            {
+                listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxNewPriority ) ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
 
-                if( xYieldRequired != pdFALSE )
+            /* If the task is in the blocked or suspended list we need do
+             * nothing more than change its priority variable. However, if
+             * the task is in a ready list it needs to be removed and placed
+             * in the list appropriate to its new priority. */
+            if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ uxPriorityUsedOnEntry ] ), &( pxTCB->xStateListItem ) ) != pdFALSE )
+            {
+                /* The task is currently in its ready list - remove before
+                 * adding it to its new ready list.  As we are in a critical
+                 * section we can do this even if the scheduler is suspended. */
+                if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
                 {
-                    taskYIELD_IF_USING_PREEMPTION();
+                    /* It is known that the task is in its ready list so
+                     * there is no need to check again and the port level
+                     * reset macro can be called directly. */
+                    portRESET_READY_PRIORITY( uxPriorityUsedOnEntry, uxTopReadyPriority );
                 }
                 else
                 {
                     mtCOVERAGE_TEST_MARKER();
                 }
 
-                /* Remove compiler warning about unused variables when the port
-                 * optimised task selection is not being used. */
-                ( void ) uxPriorityUsedOnEntry;
+                prvAddTaskToReadyList( pxTCB );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
             }
+
+            /* Remove compiler warning about unused variables when the port
+             * optimised task selection is not being used. */
+            ( void ) uxPriorityUsedOnEntry;
         }
-        taskEXIT_CRITICAL();
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xYieldRequired;
     }
 
 #endif /* INCLUDE_vTaskPrioritySet */
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_vTaskSuspend == 1 )
+#if ( INCLUDE_vTaskPrioritySet == 1 )
 
-    void vTaskSuspend( TaskHandle_t xTaskToSuspend )
+    void vTaskPrioritySet( TaskHandle_t xTask,
+                           UBaseType_t uxNewPriority )
     {
         TCB_t * pxTCB;
 
-        taskENTER_CRITICAL();
+        configASSERT( uxNewPriority < configMAX_PRIORITIES );
+
+        /* Ensure the new priority is valid. */
+        if( uxNewPriority >= ( UBaseType_t ) configMAX_PRIORITIES )
         {
-            /* If null is passed in here then it is the running task that is
-             * being suspended. */
-            pxTCB = prvGetTCBFromHandle( xTaskToSuspend );
+            uxNewPriority = ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) 1U;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
 
-            traceTASK_SUSPEND( pxTCB );
+        taskENTER_CRITICAL();
+        {
+            /* If null is passed in here then it is the priority of the calling
+             * task that is being changed. */
+            pxTCB = prvGetTCBFromHandle( xTask );
 
-            /* Remove task from the ready/delayed list and place in the
-             * suspended list. */
-            if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
-            {
-                taskRESET_READY_PRIORITY( pxTCB->uxPriority );
-            }
-            else
-            {
-                mtCOVERAGE_TEST_MARKER();
-            }
+            traceTASK_PRIORITY_SET( pxTCB, uxNewPriority );
 
-            /* Is the task waiting on an event also? */
-            if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+            if( prvSetBasePriority( pxTCB, uxNewPriority ) != pdFALSE )
             {
-                ( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+                taskYIELD_IF_USING_PREEMPTION();
             }
             else
             {
                 mtCOVERAGE_TEST_MARKER();
             }
+        }
+        taskEXIT_CRITICAL();
+    }
 
-            vListInsertEnd( &xSuspendedTaskList, &( pxTCB->xStateListItem ) );
+#endif /* INCLUDE_vTaskPrioritySet */
+/*-----------------------------------------------------------*/
 
-            #if ( configUSE_TASK_NOTIFICATIONS == 1 )
-            {
-                BaseType_t x;
+#if ( INCLUDE_vTaskSuspend == 1 )
 
-                for( x = 0; x < configTASK_NOTIFICATION_ARRAY_ENTRIES; x++ )
-                {
-                    if( pxTCB->ucNotifyState[ x ] == taskWAITING_NOTIFICATION )
-                    {
-                        /* The task was blocked to wait for a notification, but is
-                         * now suspended, so no notification was received. */
-                        pxTCB->ucNotifyState[ x ] = taskNOT_WAITING_NOTIFICATION;
-                    }
-                }
-            }
-            #endif /* if ( configUSE_TASK_NOTIFICATIONS == 1 ) */
+    static void prvSuspendTask( TCB_t * pxTCB )
+    {
+        /* Remove task from the ready/delayed list and place in the
+         * suspended list. */
+        if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+        {
+            taskRESET_READY_PRIORITY( pxTCB->uxPriority );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
         }
-        taskEXIT_CRITICAL();
 
-        if( xSchedulerRunning != pdFALSE )
+        /* Is the task waiting on an event also? */
+        if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
         {
-            /* Reset the next expected unblock time in case it referred to the
-             * task that is now in the Suspended state. */
-            taskENTER_CRITICAL();
-            {
-                prvResetNextTaskUnblockTime();
-            }
-            taskEXIT_CRITICAL();
+            ( void ) uxListRemove( &( pxTCB->xEventListItem ) );
         }
         else
         {
             mtCOVERAGE_TEST_MARKER();
         }
 
-        if( pxTCB == pxCurrentTCB )
+        vListInsertEnd( &xSuspendedTaskList, &( pxTCB->xStateListItem ) );
+
+        #if ( configUSE_TASK_NOTIFICATIONS == 1 )
         {
-            if( xSchedulerRunning != pdFALSE )
-            {
-                /* The current task has just been suspended. */
-                configASSERT( uxSchedulerSuspended == 0 );
-                portYIELD_WITHIN_API();
-            }
-            else
+            BaseType_t x;
+
+            for( x = 0; x < configTASK_NOTIFICATION_ARRAY_ENTRIES; x++ )
             {
-                /* The scheduler is not running, but the task that was pointed
-                 * to by pxCurrentTCB has just been suspended and pxCurrentTCB
-                 * must be adjusted to point to a different task. */
-                if( listCURRENT_LIST_LENGTH( &xSuspendedTaskList ) == uxCurrentNumberOfTasks ) /*lint !e931 Right has no side effect, just volatile. */
+                if( pxTCB->ucNotifyState[ x ] == taskWAITING_NOTIFICATION )
                 {
-                    /* No other tasks are ready, so set pxCurrentTCB back to
-                     * NULL so when the next task is created pxCurrentTCB will
-                     * be set to point to it no matter what its relative priority
-                     * is. */
-                    pxCurrentTCB = NULL;
-                }
-                else
-                {
-                    vTaskSwitchContext();
+                    /* The task was blocked to wait for a notification, but is
+                     * now suspended, so no notification was received. */
+                    pxTCB->ucNotifyState[ x ] = taskNOT_WAITING_NOTIFICATION;
                 }
             }
         }
-        else
-        {
-            mtCOVERAGE_TEST_MARKER();
-        }
+        #endif /* if ( configUSE_TASK_NOTIFICATIONS == 1 ) */
     }
 
 #endif /* INCLUDE_vTaskSuspend */
@@ -1776,16 +2386,95 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
 
 #if ( INCLUDE_vTaskSuspend == 1 )
 
-    static BaseType_t prvTaskIsTaskSuspended( const TaskHandle_t xTask )
+    static void prvSwitchAwayFromSuspendedTask( void )
     {
-        BaseType_t xReturn = pdFALSE;
-        const TCB_t * const pxTCB = xTask;
-
-        /* Accesses xPendingReadyList so must be called from a critical
-         * section. */
-
-        /* It does not make sense to check if the calling task is suspended. */
-        configASSERT( xTask );
+        if( xSchedulerRunning != pdFALSE )
+        {
+            /* The current task has just been suspended. */
+            configASSERT( uxSchedulerSuspended == 0 );
+            portYIELD_WITHIN_API();
+        }
+        else
+        {
+            /* The scheduler is not running, but the task that was pointed
+             * to by pxCurrentTCB has just been suspended and pxCurrentTCB
+             * must be adjusted to point to a different task. */
+            if( listCURRENT_LIST_LENGTH( &xSuspendedTaskList ) == uxCurrentNumberOfTasks ) /*lint !e931 Right has no side effect, just volatile. */
+            {
+                /* No other tasks are ready, so set pxCurrentTCB back to
+                 * NULL so when the next task is created pxCurrentTCB will
+                 * be set to point to it no matter what its relative priority
+                 * is. */
+                pxCurrentTCB = NULL;
+            }
+            else
+            {
+                vTaskSwitchContext();
+            }
+        }
+    }
+
+#endif /* INCLUDE_vTaskSuspend */
+/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_vTaskSuspend == 1 )
+
+    void vTaskSuspend( TaskHandle_t xTaskToSuspend )
+    {
+        TCB_t * pxTCB;
+
+        taskENTER_CRITICAL();
+        {
+            /* If null is passed in here then it is the running task that is
+             * being suspended. */
+            pxTCB = prvGetTCBFromHandle( xTaskToSuspend );
+
+            traceTASK_SUSPEND( pxTCB );
+
+            prvSuspendTask( pxTCB );
+        }
+        taskEXIT_CRITICAL();
+
+        if( xSchedulerRunning != pdFALSE )
+        {
+            /* Reset the next expected unblock time in case it referred to the
+             * task that is now in the Suspended state. */
+            taskENTER_CRITICAL();
+            {
+                prvResetNextTaskUnblockTime();
+            }
+            taskEXIT_CRITICAL();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( pxTCB == pxCurrentTCB )
+        {
+            prvSwitchAwayFromSuspendedTask();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+#endif /* INCLUDE_vTaskSuspend */
+/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_vTaskSuspend == 1 )
+
+    static BaseType_t prvTaskIsTaskSuspended( const TaskHandle_t xTask )
+    {
+        BaseType_t xReturn = pdFALSE;
+        const TCB_t * const pxTCB = xTask;
+
+        /* Accesses xPendingReadyList so must be called from a critical
+         * section. */
+
+        /* It does not make sense to check if the calling task is suspended. */
+        configASSERT( xTask );
 
         /* Is the task being resumed actually in the suspended list? */
         if( listIS_CONTAINED_WITHIN( &xSuspendedTaskList, &( pxTCB->xStateListItem ) ) != pdFALSE )
@@ -1820,6 +2509,33 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
 #endif /* INCLUDE_vTaskSuspend */
 /*-----------------------------------------------------------*/
 
+#if ( INCLUDE_vTaskSuspend == 1 )
+
+    static BaseType_t prvResumeTask( TCB_t * pxTCB )
+    {
+        BaseType_t xYieldRequired = pdFALSE;
+
+        /* The ready list can be accessed even if the scheduler is suspended
+         * because this is called from inside a critical section. */
+        ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+        prvAddTaskToReadyList( pxTCB );
+
+        /* A higher priority task may have just been resumed. */
+        if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+        {
+            xYieldRequired = pdTRUE;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xYieldRequired;
+    }
+
+#endif /* INCLUDE_vTaskSuspend */
+/*-----------------------------------------------------------*/
+
 #if ( INCLUDE_vTaskSuspend == 1 )
 
     void vTaskResume( TaskHandle_t xTaskToResume )
@@ -1839,13 +2555,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
                 {
                     traceTASK_RESUME( pxTCB );
 
-                    /* The ready list can be accessed even if the scheduler is
-                     * suspended because this is inside a critical section. */
-                    ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
-                    prvAddTaskToReadyList( pxTCB );
-
-                    /* A higher priority task may have just been resumed. */
-                    if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+                    if( prvResumeTask( pxTCB ) != pdFALSE )
                     {
                         /* This yield may not cause the task just resumed to run,
                          * but will leave the lists in the correct state for the
@@ -1951,751 +2661,2679 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
 #endif /* ( ( INCLUDE_xTaskResumeFromISR == 1 ) && ( INCLUDE_vTaskSuspend == 1 ) ) */
 /*-----------------------------------------------------------*/
 
-void vTaskStartScheduler( void )
-{
-    BaseType_t xReturn;
+#if ( ( configUSE_TASK_GROUPS == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
 
-    /* Add the idle task at the lowest priority. */
-    #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+    TaskGroupHandle_t xTaskGroupCreateStatic( StaticTaskGroup_t * pxTaskGroupBuffer )
     {
-        StaticTask_t * pxIdleTaskTCBBuffer = NULL;
-        StackType_t * pxIdleTaskStackBuffer = NULL;
-        uint32_t ulIdleTaskStackSize;
+        TaskGroup_t * pxTaskGroup;
 
-        /* The Idle task is created using user provided RAM - obtain the
-         * address of the RAM then create the idle task. */
-        vApplicationGetIdleTaskMemory( &pxIdleTaskTCBBuffer, &pxIdleTaskStackBuffer, &ulIdleTaskStackSize );
-        xIdleTaskHandle = xTaskCreateStatic( prvIdleTask,
-                                             configIDLE_TASK_NAME,
-                                             ulIdleTaskStackSize,
-                                             ( void * ) NULL,       /*lint !e961.  The cast is not redundant for all compilers. */
-                                             portPRIVILEGE_BIT,     /* In effect ( tskIDLE_PRIORITY | portPRIVILEGE_BIT ), but tskIDLE_PRIORITY is zero. */
-                                             pxIdleTaskStackBuffer,
-                                             pxIdleTaskTCBBuffer ); /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
+        /* A StaticTaskGroup_t object must be provided. */
+        configASSERT( pxTaskGroupBuffer );
 
-        if( xIdleTaskHandle != NULL )
+        #if ( configASSERT_DEFINED == 1 )
         {
-            xReturn = pdPASS;
+            /* Sanity check that the size of the structure used to declare a
+             * variable of type StaticTaskGroup_t equals the size of the real
+             * task group structure. */
+            volatile size_t xSize = sizeof( StaticTaskGroup_t );
+            configASSERT( xSize == sizeof( TaskGroup_t ) );
+            ( void ) xSize; /* Prevent lint warning when configASSERT() is not used. */
+        }
+        #endif /* configASSERT_DEFINED */
+
+        pxTaskGroup = ( TaskGroup_t * ) pxTaskGroupBuffer; /*lint !e740 !e9087 TaskGroup_t and StaticTaskGroup_t are deliberately aliased for data hiding purposes and guaranteed to have the same size and alignment requirement - checked by configASSERT(). */
+
+        if( pxTaskGroup != NULL )
+        {
+            vListInitialise( &( pxTaskGroup->xMemberList ) );
+
+            #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+            {
+                /* Both static and dynamic allocation can be used, so note that
+                 * this group was created statically in case it is later
+                 * deleted. */
+                pxTaskGroup->ucStaticallyAllocated = pdTRUE;
+            }
+            #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
         }
         else
         {
-            xReturn = pdFAIL;
+            mtCOVERAGE_TEST_MARKER();
         }
+
+        return pxTaskGroup;
     }
-    #else /* if ( configSUPPORT_STATIC_ALLOCATION == 1 ) */
-    {
-        /* The Idle task is being created using dynamically allocated RAM. */
-        xReturn = xTaskCreate( prvIdleTask,
-                               configIDLE_TASK_NAME,
-                               configMINIMAL_STACK_SIZE,
-                               ( void * ) NULL,
-                               portPRIVILEGE_BIT,  /* In effect ( tskIDLE_PRIORITY | portPRIVILEGE_BIT ), but tskIDLE_PRIORITY is zero. */
-                               &xIdleTaskHandle ); /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
-    }
-    #endif /* configSUPPORT_STATIC_ALLOCATION */
 
-    #if ( configUSE_TIMERS == 1 )
+#endif /* ( ( configUSE_TASK_GROUPS == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_TASK_GROUPS == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+
+    TaskGroupHandle_t xTaskGroupCreate( void )
     {
-        if( xReturn == pdPASS )
+        TaskGroup_t * pxTaskGroup;
+
+        pxTaskGroup = ( TaskGroup_t * ) pvPortMalloc( sizeof( TaskGroup_t ) ); /*lint !e9087 !e9079 All values returned by pvPortMalloc() have at least the alignment required by the MCU's stack, and the first member of TaskGroup_t is always a pointer. */
+
+        if( pxTaskGroup != NULL )
         {
-            xReturn = xTimerCreateTimerTask();
+            vListInitialise( &( pxTaskGroup->xMemberList ) );
+
+            #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+            {
+                /* Both static and dynamic allocation can be used, so note this
+                 * group was allocated dynamically in case it is later deleted. */
+                pxTaskGroup->ucStaticallyAllocated = pdFALSE;
+            }
+            #endif /* configSUPPORT_STATIC_ALLOCATION */
         }
         else
         {
             mtCOVERAGE_TEST_MARKER();
         }
+
+        return pxTaskGroup;
     }
-    #endif /* configUSE_TIMERS */
 
-    if( xReturn == pdPASS )
+#endif /* ( ( configUSE_TASK_GROUPS == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TASK_GROUPS == 1 )
+
+    void vTaskGroupDelete( TaskGroupHandle_t xTaskGroup )
     {
-        /* freertos_tasks_c_additions_init() should only be called if the user
-         * definable macro FREERTOS_TASKS_C_ADDITIONS_INIT() is defined, as that is
-         * the only macro called by the function. */
-        #ifdef FREERTOS_TASKS_C_ADDITIONS_INIT
+        TaskGroup_t * const pxTaskGroup = xTaskGroup;
+
+        configASSERT( pxTaskGroup );
+
+        taskENTER_CRITICAL();
         {
-            freertos_tasks_c_additions_init();
+            /* The member tasks are not affected other than no longer being
+             * part of a group. */
+            while( listLIST_IS_EMPTY( &( pxTaskGroup->xMemberList ) ) == pdFALSE )
+            {
+                ( void ) uxListRemove( listGET_HEAD_ENTRY( &( pxTaskGroup->xMemberList ) ) );
+            }
         }
-        #endif
-
-        /* Interrupts are turned off here, to ensure a tick does not occur
-         * before or during the call to xPortStartScheduler().  The stacks of
-         * the created tasks contain a status word with interrupts switched on
-         * so interrupts will automatically get re-enabled when the first task
-         * starts to run. */
-        portDISABLE_INTERRUPTS();
+        taskEXIT_CRITICAL();
 
-        #if ( ( configUSE_NEWLIB_REENTRANT == 1 ) || ( configUSE_C_RUNTIME_TLS_SUPPORT == 1 ) )
+        #if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) )
         {
-            /* Switch C-Runtime's TLS Block to point to the TLS
-             * block specific to the task that will run first. */
-            configSET_TLS_BLOCK( pxCurrentTCB->xTLSBlock );
+            /* The group can only have been allocated dynamically - free it
+             * again. */
+            vPortFree( pxTaskGroup );
         }
-        #endif
+        #elif ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+        {
+            /* The group could have been allocated statically or dynamically,
+             * so check before attempting to free the memory. */
+            if( pxTaskGroup->ucStaticallyAllocated == ( uint8_t ) pdFALSE )
+            {
+                vPortFree( pxTaskGroup );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+    }
 
-        xNextTaskUnblockTime = portMAX_DELAY;
-        xSchedulerRunning = pdTRUE;
-        xTickCount = ( TickType_t ) configINITIAL_TICK_COUNT;
+#endif /* configUSE_TASK_GROUPS */
+/*-----------------------------------------------------------*/
 
-        /* If configGENERATE_RUN_TIME_STATS is defined then the following
-         * macro must be defined to configure the timer/counter used to generate
-         * the run time counter time base.   NOTE:  If configGENERATE_RUN_TIME_STATS
-         * is set to 0 and the following line fails to build then ensure you do not
-         * have portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() defined in your
-         * FreeRTOSConfig.h file. */
-        portCONFIGURE_TIMER_FOR_RUN_TIME_STATS();
+#if ( configUSE_TASK_GROUPS == 1 )
 
-        traceTASK_SWITCHED_IN();
+    void vTaskGroupAddTask( TaskGroupHandle_t xTaskGroup,
+                            TaskHandle_t xTask )
+    {
+        TaskGroup_t * const pxTaskGroup = xTaskGroup;
+        TCB_t * pxTCB;
 
-        /* Setting up the timer tick is hardware specific and thus in the
-         * portable interface. */
-        xPortStartScheduler();
+        configASSERT( pxTaskGroup );
 
-        /* In most cases, xPortStartScheduler() will not return. If it
-         * returns pdTRUE then there was not enough heap memory available
-         * to create either the Idle or the Timer task. If it returned
-         * pdFALSE, then the application called xTaskEndScheduler().
-         * Most ports don't implement xTaskEndScheduler() as there is
-         * nothing to return to. */
-    }
-    else
-    {
-        /* This line will only be reached if the kernel could not be started,
-         * because there was not enough FreeRTOS heap to create the idle task
-         * or the timer task. */
-        configASSERT( xReturn != errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY );
-    }
+        taskENTER_CRITICAL();
+        {
+            /* If null is passed in here then it is the calling task that is
+             * being added. */
+            pxTCB = prvGetTCBFromHandle( xTask );
 
-    /* Prevent compiler warnings if INCLUDE_xTaskGetIdleTaskHandle is set to 0,
-     * meaning xIdleTaskHandle is not used anywhere else. */
-    ( void ) xIdleTaskHandle;
+            /* A task can only be in one group, so leave any previous group
+             * first. */
+            if( listLIST_ITEM_CONTAINER( &( pxTCB->xGroupListItem ) ) != NULL )
+            {
+                ( void ) uxListRemove( &( pxTCB->xGroupListItem ) );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
 
-    /* OpenOCD makes use of uxTopUsedPriority for thread debugging. Prevent uxTopUsedPriority
-     * from getting optimized out as it is no longer used by the kernel. */
-    ( void ) uxTopUsedPriority;
-}
+            vListInsertEnd( &( pxTaskGroup->xMemberList ), &( pxTCB->xGroupListItem ) );
+        }
+        taskEXIT_CRITICAL();
+    }
+
+#endif /* configUSE_TASK_GROUPS */
 /*-----------------------------------------------------------*/
 
-void vTaskEndScheduler( void )
-{
-    /* Stop the scheduler interrupts and call the portable scheduler end
-     * routine so the original ISRs can be restored if necessary.  The port
-     * layer must ensure interrupts enable  bit is left in the correct state. */
-    portDISABLE_INTERRUPTS();
-    xSchedulerRunning = pdFALSE;
-    vPortEndScheduler();
-}
-/*----------------------------------------------------------*/
+#if ( configUSE_TASK_GROUPS == 1 )
 
-void vTaskSuspendAll( void )
-{
-    /* A critical section is not required as the variable is of type
-     * BaseType_t.  Please read Richard Barry's reply in the following link to a
-     * post in the FreeRTOS support forum before reporting this as a bug! -
-     * https://goo.gl/wu4acr */
+    void vTaskGroupRemoveTask( TaskHandle_t xTask )
+    {
+        TCB_t * pxTCB;
 
-    /* portSOFTWARE_BARRIER() is only implemented for emulated/simulated ports that
-     * do not otherwise exhibit real time behaviour. */
-    portSOFTWARE_BARRIER();
+        taskENTER_CRITICAL();
+        {
+            pxTCB = prvGetTCBFromHandle( xTask );
 
-    /* The scheduler is suspended if uxSchedulerSuspended is non-zero.  An increment
-     * is used to allow calls to vTaskSuspendAll() to nest. */
-    ++uxSchedulerSuspended;
+            if( listLIST_ITEM_CONTAINER( &( pxTCB->xGroupListItem ) ) != NULL )
+            {
+                ( void ) uxListRemove( &( pxTCB->xGroupListItem ) );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+    }
 
-    /* Enforces ordering for ports and optimised compilers that may otherwise place
-     * the above increment elsewhere. */
-    portMEMORY_BARRIER();
-}
-/*----------------------------------------------------------*/
+#endif /* configUSE_TASK_GROUPS */
+/*-----------------------------------------------------------*/
 
-#if ( configUSE_TICKLESS_IDLE != 0 )
+#if ( configUSE_TASK_GROUPS == 1 )
 
-    static TickType_t prvGetExpectedIdleTime( void )
+    UBaseType_t uxTaskGroupGetMemberCount( TaskGroupHandle_t xTaskGroup )
     {
-        TickType_t xReturn;
-        UBaseType_t uxHigherPriorityReadyTasks = pdFALSE;
+        TaskGroup_t const * const pxTaskGroup = xTaskGroup;
 
-        /* uxHigherPriorityReadyTasks takes care of the case where
-         * configUSE_PREEMPTION is 0, so there may be tasks above the idle priority
-         * task that are in the Ready state, even though the idle task is
-         * running. */
-        #if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 )
+        configASSERT( pxTaskGroup );
+
+        return listCURRENT_LIST_LENGTH( &( pxTaskGroup->xMemberList ) );
+    }
+
+#endif /* configUSE_TASK_GROUPS */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_TASK_GROUPS == 1 ) && ( INCLUDE_vTaskSuspend == 1 ) )
+
+    void vTaskGroupSuspend( TaskGroupHandle_t xTaskGroup )
+    {
+        TaskGroup_t * const pxTaskGroup = xTaskGroup;
+        ListItem_t const * pxEndMarker;
+        ListItem_t * pxIterator;
+        TCB_t * pxTCB;
+        BaseType_t xCallingTaskSuspended = pdFALSE;
+
+        configASSERT( pxTaskGroup );
+
+        taskENTER_CRITICAL();
         {
-            if( uxTopReadyPriority > tskIDLE_PRIORITY )
+            /* Every member is moved to the Suspended state before the
+             * scheduler gets to run again, so no other task observes the
+             * group partially suspended. */
+            pxEndMarker = listGET_END_MARKER( &( pxTaskGroup->xMemberList ) );
+
+            for( pxIterator = listGET_HEAD_ENTRY( &( pxTaskGroup->xMemberList ) ); pxIterator != pxEndMarker; pxIterator = listGET_NEXT( pxIterator ) )
             {
-                uxHigherPriorityReadyTasks = pdTRUE;
+                pxTCB = listGET_LIST_ITEM_OWNER( pxIterator );
+
+                traceTASK_SUSPEND( pxTCB );
+                prvSuspendTask( pxTCB );
+
+                if( pxTCB == pxCurrentTCB )
+                {
+                    xCallingTaskSuspended = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
             }
-        }
-        #else
-        {
-            const UBaseType_t uxLeastSignificantBit = ( UBaseType_t ) 0x01;
 
-            /* When port optimised task selection is used the uxTopReadyPriority
-             * variable is used as a bit map.  If bits other than the least
-             * significant bit are set then there are tasks that have a priority
-             * above the idle priority that are in the Ready state.  This takes
-             * care of the case where the co-operative scheduler is in use. */
-            if( uxTopReadyPriority > uxLeastSignificantBit )
+            if( xSchedulerRunning != pdFALSE )
             {
-                uxHigherPriorityReadyTasks = pdTRUE;
+                /* Reset the next expected unblock time in case it referred to
+                 * a task that is now in the Suspended state. */
+                prvResetNextTaskUnblockTime();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
             }
         }
-        #endif /* if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 ) */
+        taskEXIT_CRITICAL();
 
-        if( pxCurrentTCB->uxPriority > tskIDLE_PRIORITY )
-        {
-            xReturn = 0;
-        }
-        else if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ tskIDLE_PRIORITY ] ) ) > 1 )
-        {
-            /* There are other idle priority tasks in the ready state.  If
-             * time slicing is used then the very next tick interrupt must be
-             * processed. */
-            xReturn = 0;
-        }
-        else if( uxHigherPriorityReadyTasks != pdFALSE )
+        /* Suspending tasks other than the calling task never makes a higher
+         * priority task ready, so a context switch is only needed if the
+         * calling task is a member. */
+        if( xCallingTaskSuspended != pdFALSE )
         {
-            /* There are tasks in the Ready state that have a priority above the
-             * idle priority.  This path can only be reached if
-             * configUSE_PREEMPTION is 0. */
-            xReturn = 0;
+            prvSwitchAwayFromSuspendedTask();
         }
         else
         {
-            xReturn = xNextTaskUnblockTime - xTickCount;
+            mtCOVERAGE_TEST_MARKER();
         }
-
-        return xReturn;
     }
 
-#endif /* configUSE_TICKLESS_IDLE */
-/*----------------------------------------------------------*/
-
-BaseType_t xTaskResumeAll( void )
-{
-    TCB_t * pxTCB = NULL;
-    BaseType_t xAlreadyYielded = pdFALSE;
+#endif /* ( ( configUSE_TASK_GROUPS == 1 ) && ( INCLUDE_vTaskSuspend == 1 ) ) */
+/*-----------------------------------------------------------*/
 
-    /* If uxSchedulerSuspended is zero then this function does not match a
-     * previous call to vTaskSuspendAll(). */
-    configASSERT( uxSchedulerSuspended );
+#if ( ( configUSE_TASK_GROUPS == 1 ) && ( INCLUDE_vTaskSuspend == 1 ) )
 
-    /* It is possible that an ISR caused a task to be removed from an event
-     * list while the scheduler was suspended.  If this was the case then the
-     * removed task will have been added to the xPendingReadyList.  Once the
-     * scheduler has been resumed it is safe to move all the pending ready
-     * tasks from this list into their appropriate ready list. */
-    taskENTER_CRITICAL();
+    void vTaskGroupResume( TaskGroupHandle_t xTaskGroup )
     {
-        --uxSchedulerSuspended;
+        TaskGroup_t * const pxTaskGroup = xTaskGroup;
+        ListItem_t const * pxEndMarker;
+        ListItem_t * pxIterator;
+        TCB_t * pxTCB;
+        BaseType_t xYieldRequired = pdFALSE;
 
-        if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+        configASSERT( pxTaskGroup );
+
+        taskENTER_CRITICAL();
         {
-            if( uxCurrentNumberOfTasks > ( UBaseType_t ) 0U )
+            pxEndMarker = listGET_END_MARKER( &( pxTaskGroup->xMemberList ) );
+
+            for( pxIterator = listGET_HEAD_ENTRY( &( pxTaskGroup->xMemberList ) ); pxIterator != pxEndMarker; pxIterator = listGET_NEXT( pxIterator ) )
             {
-                /* Move any readied tasks from the pending list into the
-                 * appropriate ready list. */
-                while( listLIST_IS_EMPTY( &xPendingReadyList ) == pdFALSE )
+                pxTCB = listGET_LIST_ITEM_OWNER( pxIterator );
+
+                /* The calling task cannot be suspended, and tasks that are
+                 * blocked with no timeout are left blocked. */
+                if( ( pxTCB != pxCurrentTCB ) && ( prvTaskIsTaskSuspended( pxTCB ) != pdFALSE ) )
                 {
-                    pxTCB = listGET_OWNER_OF_HEAD_ENTRY( ( &xPendingReadyList ) ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
-                    listREMOVE_ITEM( &( pxTCB->xEventListItem ) );
-                    portMEMORY_BARRIER();
-                    listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
-                    prvAddTaskToReadyList( pxTCB );
+                    traceTASK_RESUME( pxTCB );
 
-                    /* If the moved task has a priority higher than or equal to
-                     * the current task then a yield must be performed. */
-                    if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+                    if( prvResumeTask( pxTCB ) != pdFALSE )
                     {
-                        xYieldPending = pdTRUE;
+                        xYieldRequired = pdTRUE;
                     }
                     else
                     {
                         mtCOVERAGE_TEST_MARKER();
                     }
                 }
-
-                if( pxTCB != NULL )
+                else
                 {
-                    /* A task was unblocked while the scheduler was suspended,
-                     * which may have prevented the next unblock time from being
-                     * re-calculated, in which case re-calculate it now.  Mainly
-                     * important for low power tickless implementations, where
-                     * this can prevent an unnecessary exit from low power
-                     * state. */
-                    prvResetNextTaskUnblockTime();
+                    mtCOVERAGE_TEST_MARKER();
                 }
+            }
 
-                /* If any ticks occurred while the scheduler was suspended then
-                 * they should be processed now.  This ensures the tick count does
-                 * not  slip, and that any delayed tasks are resumed at the correct
-                 * time. */
-                {
-                    TickType_t xPendedCounts = xPendedTicks; /* Non-volatile copy. */
+            /* One scheduling decision is made once all the members are
+             * ready. */
+            if( xYieldRequired != pdFALSE )
+            {
+                taskYIELD_IF_USING_PREEMPTION();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+    }
 
-                    if( xPendedCounts > ( TickType_t ) 0U )
-                    {
-                        do
-                        {
-                            if( xTaskIncrementTick() != pdFALSE )
-                            {
-                                xYieldPending = pdTRUE;
-                            }
-                            else
-                            {
-                                mtCOVERAGE_TEST_MARKER();
-                            }
+#endif /* ( ( configUSE_TASK_GROUPS == 1 ) && ( INCLUDE_vTaskSuspend == 1 ) ) */
+/*-----------------------------------------------------------*/
 
-                            --xPendedCounts;
-                        } while( xPendedCounts > ( TickType_t ) 0U );
+#if ( ( configUSE_TASK_GROUPS == 1 ) && ( INCLUDE_vTaskPrioritySet == 1 ) )
 
-                        xPendedTicks = 0;
+    void vTaskGroupPriorityOffset( TaskGroupHandle_t xTaskGroup,
+                                   BaseType_t xOffset )
+    {
+        TaskGroup_t * const pxTaskGroup = xTaskGroup;
+        ListItem_t const * pxEndMarker;
+        ListItem_t * pxIterator;
+        TCB_t * pxTCB;
+        UBaseType_t uxBasePriority, uxNewPriority;
+        BaseType_t xYieldRequired = pdFALSE;
+
+        configASSERT( pxTaskGroup );
+
+        taskENTER_CRITICAL();
+        {
+            pxEndMarker = listGET_END_MARKER( &( pxTaskGroup->xMemberList ) );
+
+            for( pxIterator = listGET_HEAD_ENTRY( &( pxTaskGroup->xMemberList ) ); pxIterator != pxEndMarker; pxIterator = listGET_NEXT( pxIterator ) )
+            {
+                pxTCB = listGET_LIST_ITEM_OWNER( pxIterator );
+
+                #if ( configUSE_MUTEXES == 1 )
+                {
+                    uxBasePriority = pxTCB->uxBasePriority;
+                }
+                #else
+                {
+                    uxBasePriority = pxTCB->uxPriority;
+                }
+                #endif
+
+                /* The offset is applied to the base priority, and the result
+                 * is clamped to the range of valid priorities. */
+                if( xOffset < 0 )
+                {
+                    if( ( UBaseType_t ) -xOffset >= uxBasePriority )
+                    {
+                        uxNewPriority = tskIDLE_PRIORITY;
                     }
                     else
                     {
-                        mtCOVERAGE_TEST_MARKER();
+                        uxNewPriority = uxBasePriority - ( UBaseType_t ) -xOffset;
                     }
                 }
-
-                if( xYieldPending != pdFALSE )
+                else
                 {
-                    #if ( configUSE_PREEMPTION != 0 )
+                    if( ( UBaseType_t ) xOffset >= ( ( UBaseType_t ) configMAX_PRIORITIES - uxBasePriority ) )
                     {
-                        xAlreadyYielded = pdTRUE;
+                        uxNewPriority = ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) 1U;
                     }
-                    #endif
-                    taskYIELD_IF_USING_PREEMPTION();
+                    else
+                    {
+                        uxNewPriority = uxBasePriority + ( UBaseType_t ) xOffset;
+                    }
+                }
+
+                traceTASK_PRIORITY_SET( pxTCB, uxNewPriority );
+
+                if( prvSetBasePriority( pxTCB, uxNewPriority ) != pdFALSE )
+                {
+                    xYieldRequired = pdTRUE;
                 }
                 else
                 {
                     mtCOVERAGE_TEST_MARKER();
                 }
             }
+
+            /* One scheduling decision is made once all the members have their
+             * new priority. */
+            if( xYieldRequired != pdFALSE )
+            {
+                taskYIELD_IF_USING_PREEMPTION();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
         }
-        else
-        {
-            mtCOVERAGE_TEST_MARKER();
-        }
+        taskEXIT_CRITICAL();
     }
-    taskEXIT_CRITICAL();
 
-    return xAlreadyYielded;
-}
+#endif /* ( ( configUSE_TASK_GROUPS == 1 ) && ( INCLUDE_vTaskPrioritySet == 1 ) ) */
 /*-----------------------------------------------------------*/
 
-TickType_t xTaskGetTickCount( void )
-{
-    TickType_t xTicks;
+#if ( configUSE_DEADLINE_TIMERS == 1 )
 
-    /* Critical section required if running on a 16 bit processor. */
-    portTICK_TYPE_ENTER_CRITICAL();
+    DeadlineTimerHandle_t xTaskDeadlineTimerInit( StaticDeadlineTimer_t * pxTimerBuffer,
+                                                  DeadlineTimerCallback_t pxCallback,
+                                                  void * pvContext )
     {
-        xTicks = xTickCount;
+        DeadlineTimer_t * pxTimer;
+
+        configASSERT( pxTimerBuffer );
+        configASSERT( pxCallback );
+
+        #if ( configASSERT_DEFINED == 1 )
+        {
+            /* Sanity check that the size of the structure used to declare a
+             * variable of type StaticDeadlineTimer_t equals the size of the
+             * real deadline timer structure. */
+            volatile size_t xSize = sizeof( StaticDeadlineTimer_t );
+            configASSERT( xSize == sizeof( DeadlineTimer_t ) );
+            ( void ) xSize; /* Prevent lint warning when configASSERT() is not used. */
+        }
+        #endif /* configASSERT_DEFINED */
+
+        pxTimer = ( DeadlineTimer_t * ) pxTimerBuffer; /*lint !e740 !e9087 DeadlineTimer_t and StaticDeadlineTimer_t are deliberately aliased for data hiding purposes and guaranteed to have the same size and alignment requirement - checked by configASSERT(). */
+
+        pxTimer->pvTag = ( const void * ) &ucDeadlineTimerTag;
+        vListInitialiseItem( &( pxTimer->xDeadlineListItem ) );
+        listSET_LIST_ITEM_OWNER( &( pxTimer->xDeadlineListItem ), pxTimer );
+        pxTimer->xPeriod = ( TickType_t ) 0U;
+        pxTimer->pxCallback = pxCallback;
+        pxTimer->pvContext = pvContext;
+        pxTimer->pxNextRequest = NULL;
+        pxTimer->xRequestDelay = ( TickType_t ) 0U;
+        pxTimer->xRequestPeriod = ( TickType_t ) 0U;
+        pxTimer->ucRequest = taskDEADLINE_TIMER_NO_REQUEST;
+
+        return pxTimer;
     }
-    portTICK_TYPE_EXIT_CRITICAL();
 
-    return xTicks;
-}
+#endif /* configUSE_DEADLINE_TIMERS */
 /*-----------------------------------------------------------*/
 
-TickType_t xTaskGetTickCountFromISR( void )
-{
-    TickType_t xReturn;
-    UBaseType_t uxSavedInterruptStatus;
+#if ( configUSE_DEADLINE_TIMERS == 1 )
 
-    /* RTOS ports that support interrupt nesting have the concept of a maximum
-     * system call (or maximum API call) interrupt priority.  Interrupts that are
-     * above the maximum system call priority are kept permanently enabled, even
-     * when the RTOS kernel is in a critical section, but cannot make any calls to
-     * FreeRTOS API functions.  If configASSERT() is defined in FreeRTOSConfig.h
-     * then portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
-     * failure if a FreeRTOS API function is called from an interrupt that has been
-     * assigned a priority above the configured maximum system call priority.
-     * Only FreeRTOS functions that end in FromISR can be called from interrupts
-     * that have been assigned a priority at or (logically) below the maximum
-     * system call  interrupt priority.  FreeRTOS maintains a separate interrupt
-     * safe API to ensure interrupt entry is as fast and as simple as possible.
-     * More information (albeit Cortex-M specific) is provided on the following
-     * link: https://www.FreeRTOS.org/RTOS-Cortex-M3-M4.html */
-    portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
-
-    uxSavedInterruptStatus = portTICK_TYPE_SET_INTERRUPT_MASK_FROM_ISR();
+    void vTaskDeadlineTimerStart( DeadlineTimerHandle_t xTimer,
+                                  TickType_t xDelay,
+                                  TickType_t xPeriod )
     {
-        xReturn = xTickCount;
-    }
-    portTICK_TYPE_CLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+        DeadlineTimer_t * const pxTimer = xTimer;
 
-    return xReturn;
-}
-/*-----------------------------------------------------------*/
-
-UBaseType_t uxTaskGetNumberOfTasks( void )
-{
-    /* A critical section is not required because the variables are of type
-     * BaseType_t. */
-    return uxCurrentNumberOfTasks;
-}
-/*-----------------------------------------------------------*/
+        configASSERT( pxTimer );
+        configASSERT( xDelay > ( TickType_t ) 0U );
 
-char * pcTaskGetName( TaskHandle_t xTaskToQuery ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
-{
-    TCB_t * pxTCB;
+        taskENTER_CRITICAL();
+        {
+            prvStartDeadlineTimer( pxTimer, xDelay, xPeriod );
+        }
+        taskEXIT_CRITICAL();
+    }
 
-    /* If null is passed in here then the name of the calling task is being
-     * queried. */
-    pxTCB = prvGetTCBFromHandle( xTaskToQuery );
-    configASSERT( pxTCB );
-    return &( pxTCB->pcTaskName[ 0 ] );
-}
+#endif /* configUSE_DEADLINE_TIMERS */
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_xTaskGetHandle == 1 )
+#if ( configUSE_DEADLINE_TIMERS == 1 )
 
-    static TCB_t * prvSearchForNameWithinSingleList( List_t * pxList,
-                                                     const char pcNameToQuery[] )
+    void vTaskDeadlineTimerStartFromISR( DeadlineTimerHandle_t xTimer,
+                                         TickType_t xDelay,
+                                         TickType_t xPeriod )
     {
-        TCB_t * pxNextTCB;
-        TCB_t * pxFirstTCB;
-        TCB_t * pxReturn = NULL;
-        UBaseType_t x;
-        char cNextChar;
-        BaseType_t xBreakLoop;
+        DeadlineTimer_t * const pxTimer = xTimer;
+        UBaseType_t uxSavedInterruptStatus;
 
-        /* This function is called with the scheduler suspended. */
+        configASSERT( pxTimer );
+        configASSERT( xDelay > ( TickType_t ) 0U );
 
-        if( listCURRENT_LIST_LENGTH( pxList ) > ( UBaseType_t ) 0 )
-        {
-            listGET_OWNER_OF_NEXT_ENTRY( pxFirstTCB, pxList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+        /* RTOS ports that support interrupt nesting have the concept of a
+         * maximum system call (or maximum API call) interrupt priority.
+         * Interrupts that are above the maximum system call priority are keep
+         * permanently enabled, even when the RTOS kernel is in a critical section,
+         * but cannot make any calls to FreeRTOS API functions.  See the comments
+         * in xTaskResumeFromISR() for more information. */
+        portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
 
-            do
+        uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+        {
+            if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
             {
-                listGET_OWNER_OF_NEXT_ENTRY( pxNextTCB, pxList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
-
-                /* Check each character in the name looking for a match or
-                 * mismatch. */
-                xBreakLoop = pdFALSE;
-
-                for( x = ( UBaseType_t ) 0; x < ( UBaseType_t ) configMAX_TASK_NAME_LEN; x++ )
+                prvStartDeadlineTimer( pxTimer, xDelay, xPeriod );
+            }
+            else
+            {
+                /* A task can walk the delayed lists with only the scheduler
+                 * suspended, so the timer cannot be moved until the
+                 * scheduler is resumed.  Only the latest request is kept. */
+                if( pxTimer->ucRequest == taskDEADLINE_TIMER_NO_REQUEST )
                 {
-                    cNextChar = pxNextTCB->pcTaskName[ x ];
-
-                    if( cNextChar != pcNameToQuery[ x ] )
-                    {
-                        /* Characters didn't match. */
-                        xBreakLoop = pdTRUE;
-                    }
-                    else if( cNextChar == ( char ) 0x00 )
-                    {
-                        /* Both strings terminated, a match must have been
-                         * found. */
-                        pxReturn = pxNextTCB;
-                        xBreakLoop = pdTRUE;
-                    }
-                    else
-                    {
-                        mtCOVERAGE_TEST_MARKER();
-                    }
-
-                    if( xBreakLoop != pdFALSE )
-                    {
-                        break;
-                    }
+                    pxTimer->pxNextRequest = pxDeadlineTimerRequests;
+                    pxDeadlineTimerRequests = pxTimer;
                 }
-
-                if( pxReturn != NULL )
+                else
                 {
-                    /* The handle has been found. */
-                    break;
+                    mtCOVERAGE_TEST_MARKER();
                 }
-            } while( pxNextTCB != pxFirstTCB );
-        }
-        else
-        {
-            mtCOVERAGE_TEST_MARKER();
-        }
 
-        return pxReturn;
+                pxTimer->xRequestDelay = xDelay;
+                pxTimer->xRequestPeriod = xPeriod;
+                pxTimer->ucRequest = taskDEADLINE_TIMER_START_REQUESTED;
+            }
+        }
+        taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
     }
 
-#endif /* INCLUDE_xTaskGetHandle */
+#endif /* configUSE_DEADLINE_TIMERS */
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_xTaskGetHandle == 1 )
+#if ( configUSE_DEADLINE_TIMERS == 1 )
 
-    TaskHandle_t xTaskGetHandle( const char * pcNameToQuery ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+    void vTaskDeadlineTimerStop( DeadlineTimerHandle_t xTimer )
     {
-        UBaseType_t uxQueue = configMAX_PRIORITIES;
-        TCB_t * pxTCB;
+        DeadlineTimer_t * const pxTimer = xTimer;
 
-        /* Task names will be truncated to configMAX_TASK_NAME_LEN - 1 bytes. */
-        configASSERT( strlen( pcNameToQuery ) < configMAX_TASK_NAME_LEN );
+        configASSERT( pxTimer );
 
-        vTaskSuspendAll();
+        taskENTER_CRITICAL();
         {
-            /* Search the ready lists. */
-            do
-            {
-                uxQueue--;
-                pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) &( pxReadyTasksLists[ uxQueue ] ), pcNameToQuery );
+            prvStopDeadlineTimer( pxTimer );
+        }
+        taskEXIT_CRITICAL();
+    }
 
-                if( pxTCB != NULL )
-                {
-                    /* Found the handle. */
-                    break;
-                }
-            } while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+#endif /* configUSE_DEADLINE_TIMERS */
+/*-----------------------------------------------------------*/
 
-            /* Search the delayed lists. */
-            if( pxTCB == NULL )
-            {
-                pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxDelayedTaskList, pcNameToQuery );
-            }
+#if ( configUSE_DEADLINE_TIMERS == 1 )
 
-            if( pxTCB == NULL )
+    void vTaskDeadlineTimerStopFromISR( DeadlineTimerHandle_t xTimer )
+    {
+        DeadlineTimer_t * const pxTimer = xTimer;
+        UBaseType_t uxSavedInterruptStatus;
+
+        configASSERT( pxTimer );
+
+        portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+        uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+        {
+            if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
             {
-                pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxOverflowDelayedTaskList, pcNameToQuery );
+                prvStopDeadlineTimer( pxTimer );
             }
-
-            #if ( INCLUDE_vTaskSuspend == 1 )
+            else
             {
-                if( pxTCB == NULL )
+                /* As in vTaskDeadlineTimerStartFromISR(). */
+                if( pxTimer->ucRequest == taskDEADLINE_TIMER_NO_REQUEST )
                 {
-                    /* Search the suspended list. */
-                    pxTCB = prvSearchForNameWithinSingleList( &xSuspendedTaskList, pcNameToQuery );
+                    pxTimer->pxNextRequest = pxDeadlineTimerRequests;
+                    pxDeadlineTimerRequests = pxTimer;
                 }
-            }
-            #endif
-
-            #if ( INCLUDE_vTaskDelete == 1 )
-            {
-                if( pxTCB == NULL )
+                else
                 {
-                    /* Search the deleted list. */
-                    pxTCB = prvSearchForNameWithinSingleList( &xTasksWaitingTermination, pcNameToQuery );
+                    mtCOVERAGE_TEST_MARKER();
                 }
+
+                pxTimer->ucRequest = taskDEADLINE_TIMER_STOP_REQUESTED;
             }
-            #endif
         }
-        ( void ) xTaskResumeAll();
-
-        return pxTCB;
+        taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
     }
 
-#endif /* INCLUDE_xTaskGetHandle */
+#endif /* configUSE_DEADLINE_TIMERS */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_TRACE_FACILITY == 1 )
+#if ( configUSE_DEADLINE_TIMERS == 1 )
 
-    UBaseType_t uxTaskGetSystemState( TaskStatus_t * const pxTaskStatusArray,
-                                      const UBaseType_t uxArraySize,
-                                      configRUN_TIME_COUNTER_TYPE * const pulTotalRunTime )
+    BaseType_t xTaskDeadlineTimerIsActive( DeadlineTimerHandle_t xTimer )
     {
-        UBaseType_t uxTask = 0, uxQueue = configMAX_PRIORITIES;
+        BaseType_t xReturn;
+        DeadlineTimer_t * const pxTimer = xTimer;
 
-        vTaskSuspendAll();
+        configASSERT( pxTimer );
+
+        taskENTER_CRITICAL();
         {
-            /* Is there a space in the array for each task in the system? */
-            if( uxArraySize >= uxCurrentNumberOfTasks )
+            if( listLIST_ITEM_CONTAINER( &( pxTimer->xDeadlineListItem ) ) != NULL )
             {
-                /* Fill in an TaskStatus_t structure with information on each
-                 * task in the Ready state. */
-                do
-                {
-                    uxQueue--;
-                    uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( pxReadyTasksLists[ uxQueue ] ), eReady );
-                } while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
-
-                /* Fill in an TaskStatus_t structure with information on each
-                 * task in the Blocked state. */
-                uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxDelayedTaskList, eBlocked );
-                uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxOverflowDelayedTaskList, eBlocked );
-
-                #if ( INCLUDE_vTaskDelete == 1 )
-                {
-                    /* Fill in an TaskStatus_t structure with information on
-                     * each task that has been deleted but not yet cleaned up. */
-                    uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &xTasksWaitingTermination, eDeleted );
-                }
-                #endif
-
-                #if ( INCLUDE_vTaskSuspend == 1 )
-                {
-                    /* Fill in an TaskStatus_t structure with information on
-                     * each task in the Suspended state. */
-                    uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &xSuspendedTaskList, eSuspended );
-                }
-                #endif
-
-                #if ( configGENERATE_RUN_TIME_STATS == 1 )
-                {
-                    if( pulTotalRunTime != NULL )
-                    {
-                        #ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
-                            portALT_GET_RUN_TIME_COUNTER_VALUE( ( *pulTotalRunTime ) );
-                        #else
-                            *pulTotalRunTime = portGET_RUN_TIME_COUNTER_VALUE();
-                        #endif
-                    }
-                }
-                #else /* if ( configGENERATE_RUN_TIME_STATS == 1 ) */
-                {
-                    if( pulTotalRunTime != NULL )
-                    {
-                        *pulTotalRunTime = 0;
-                    }
-                }
-                #endif /* if ( configGENERATE_RUN_TIME_STATS == 1 ) */
+                xReturn = pdTRUE;
             }
             else
             {
-                mtCOVERAGE_TEST_MARKER();
+                xReturn = pdFALSE;
             }
         }
-        ( void ) xTaskResumeAll();
+        taskEXIT_CRITICAL();
 
-        return uxTask;
+        return xReturn;
     }
 
-#endif /* configUSE_TRACE_FACILITY */
-/*----------------------------------------------------------*/
+#endif /* configUSE_DEADLINE_TIMERS */
+/*-----------------------------------------------------------*/
 
-#if ( INCLUDE_xTaskGetIdleTaskHandle == 1 )
+#if ( configUSE_DEADLINE_TIMERS == 1 )
 
-    TaskHandle_t xTaskGetIdleTaskHandle( void )
+    void * pvTaskDeadlineTimerGetContext( DeadlineTimerHandle_t xTimer )
     {
-        /* If xTaskGetIdleTaskHandle() is called before the scheduler has been
-         * started, then xIdleTaskHandle will be NULL. */
-        configASSERT( ( xIdleTaskHandle != NULL ) );
-        return xIdleTaskHandle;
-    }
+        DeadlineTimer_t * const pxTimer = xTimer;
 
-#endif /* INCLUDE_xTaskGetIdleTaskHandle */
-/*----------------------------------------------------------*/
+        configASSERT( pxTimer );
 
-/* This conditional compilation should use inequality to 0, not equality to 1.
- * This is to ensure vTaskStepTick() is available when user defined low power mode
- * implementations require configUSE_TICKLESS_IDLE to be set to a value other than
- * 1. */
-#if ( configUSE_TICKLESS_IDLE != 0 )
+        return pxTimer->pvContext;
+    }
 
-    void vTaskStepTick( TickType_t xTicksToJump )
-    {
+#endif /* configUSE_DEADLINE_TIMERS */
+/*-----------------------------------------------------------*/
+
+void vTaskStartScheduler( void )
+{
+    BaseType_t xReturn;
+
+    /* Add the idle task at the lowest priority. */
+    #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+    {
+        StaticTask_t * pxIdleTaskTCBBuffer = NULL;
+        StackType_t * pxIdleTaskStackBuffer = NULL;
+        uint32_t ulIdleTaskStackSize;
+
+        /* The Idle task is created using user provided RAM - obtain the
+         * address of the RAM then create the idle task. */
+        vApplicationGetIdleTaskMemory( &pxIdleTaskTCBBuffer, &pxIdleTaskStackBuffer, &ulIdleTaskStackSize );
+        xIdleTaskHandle = xTaskCreateStatic( prvIdleTask,
+                                             configIDLE_TASK_NAME,
+                                             ulIdleTaskStackSize,
+                                             ( void * ) NULL,       /*lint !e961.  The cast is not redundant for all compilers. */
+                                             portPRIVILEGE_BIT,     /* In effect ( tskIDLE_PRIORITY | portPRIVILEGE_BIT ), but tskIDLE_PRIORITY is zero. */
+                                             pxIdleTaskStackBuffer,
+                                             pxIdleTaskTCBBuffer ); /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
+
+        if( xIdleTaskHandle != NULL )
+        {
+            xReturn = pdPASS;
+        }
+        else
+        {
+            xReturn = pdFAIL;
+        }
+    }
+    #else /* if ( configSUPPORT_STATIC_ALLOCATION == 1 ) */
+    {
+        /* The Idle task is being created using dynamically allocated RAM. */
+        xReturn = xTaskCreate( prvIdleTask,
+                               configIDLE_TASK_NAME,
+                               configMINIMAL_STACK_SIZE,
+                               ( void * ) NULL,
+                               portPRIVILEGE_BIT,  /* In effect ( tskIDLE_PRIORITY | portPRIVILEGE_BIT ), but tskIDLE_PRIORITY is zero. */
+                               &xIdleTaskHandle ); /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
+    }
+    #endif /* configSUPPORT_STATIC_ALLOCATION */
+
+    #if ( configUSE_TIMERS == 1 )
+    {
+        if( xReturn == pdPASS )
+        {
+            xReturn = xTimerCreateTimerTask();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    #endif /* configUSE_TIMERS */
+
+    #if ( configUSE_RCU == 1 )
+    {
+        if( xReturn == pdPASS )
+        {
+            xReturn = xRcuCreateReclaimerTask();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    #endif /* configUSE_RCU */
+
+    if( xReturn == pdPASS )
+    {
+        /* freertos_tasks_c_additions_init() should only be called if the user
+         * definable macro FREERTOS_TASKS_C_ADDITIONS_INIT() is defined, as that is
+         * the only macro called by the function. */
+        #ifdef FREERTOS_TASKS_C_ADDITIONS_INIT
+        {
+            freertos_tasks_c_additions_init();
+        }
+        #endif
+
+        /* Interrupts are turned off here, to ensure a tick does not occur
+         * before or during the call to xPortStartScheduler().  The stacks of
+         * the created tasks contain a status word with interrupts switched on
+         * so interrupts will automatically get re-enabled when the first task
+         * starts to run. */
+        portDISABLE_INTERRUPTS();
+
+        #if ( configUSE_STACK_TIERING == 1 )
+        {
+            /* The first task is started without a context switch. */
+            if( pxCurrentTCB->pxStackBackingStore != NULL )
+            {
+                prvLoadTieredStack( pxCurrentTCB );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif
+
+        #if ( ( configUSE_NEWLIB_REENTRANT == 1 ) || ( configUSE_C_RUNTIME_TLS_SUPPORT == 1 ) )
+        {
+            /* Switch C-Runtime's TLS Block to point to the TLS
+             * block specific to the task that will run first. */
+            configSET_TLS_BLOCK( pxCurrentTCB->xTLSBlock );
+        }
+        #endif
+
+        #if ( configUSE_PROPORTIONAL_SHARE == 1 )
+        {
+            /* The default credit is derived from the CPU clock frequency,
+             * which is too expensive to read on every context switch. */
+            ulShareMaxCredit = ( uint32_t ) ( configPROPORTIONAL_SHARE_MAX_CREDIT );
+        }
+        #endif
+
+        xNextTaskUnblockTime = portMAX_DELAY;
+        xSchedulerRunning = pdTRUE;
+        xTickCount = ( TickType_t ) configINITIAL_TICK_COUNT;
+
+        /* If configGENERATE_RUN_TIME_STATS is defined then the following
+         * macro must be defined to configure the timer/counter used to generate
+         * the run time counter time base.   NOTE:  If configGENERATE_RUN_TIME_STATS
+         * is set to 0 and the following line fails to build then ensure you do not
+         * have portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() defined in your
+         * FreeRTOSConfig.h file. */
+        portCONFIGURE_TIMER_FOR_RUN_TIME_STATS();
+
+        traceTASK_SWITCHED_IN();
+
+        /* Setting up the timer tick is hardware specific and thus in the
+         * portable interface. */
+        xPortStartScheduler();
+
+        /* In most cases, xPortStartScheduler() will not return. If it
+         * returns pdTRUE then there was not enough heap memory available
+         * to create either the Idle or the Timer task. If it returned
+         * pdFALSE, then the application called xTaskEndScheduler().
+         * Most ports don't implement xTaskEndScheduler() as there is
+         * nothing to return to. */
+    }
+    else
+    {
+        /* This line will only be reached if the kernel could not be started,
+         * because there was not enough FreeRTOS heap to create the idle task
+         * or the timer task. */
+        configASSERT( xReturn != errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY );
+    }
+
+    /* Prevent compiler warnings if INCLUDE_xTaskGetIdleTaskHandle is set to 0,
+     * meaning xIdleTaskHandle is not used anywhere else. */
+    ( void ) xIdleTaskHandle;
+
+    /* OpenOCD makes use of uxTopUsedPriority for thread debugging. Prevent uxTopUsedPriority
+     * from getting optimized out as it is no longer used by the kernel. */
+    ( void ) uxTopUsedPriority;
+}
+/*-----------------------------------------------------------*/
+
+void vTaskEndScheduler( void )
+{
+    /* Stop the scheduler interrupts and call the portable scheduler end
+     * routine so the original ISRs can be restored if necessary.  The port
+     * layer must ensure interrupts enable  bit is left in the correct state. */
+    portDISABLE_INTERRUPTS();
+    xSchedulerRunning = pdFALSE;
+    vPortEndScheduler();
+}
+/*----------------------------------------------------------*/
+
+void vTaskSuspendAll( void )
+{
+    /* A critical section is not required as the variable is of type
+     * BaseType_t.  Please read Richard Barry's reply in the following link to a
+     * post in the FreeRTOS support forum before reporting this as a bug! -
+     * https://goo.gl/wu4acr */
+
+    /* portSOFTWARE_BARRIER() is only implemented for emulated/simulated ports that
+     * do not otherwise exhibit real time behaviour. */
+    portSOFTWARE_BARRIER();
+
+    /* The scheduler is suspended if uxSchedulerSuspended is non-zero.  An increment
+     * is used to allow calls to vTaskSuspendAll() to nest. */
+    ++uxSchedulerSuspended;
+
+    /* Enforces ordering for ports and optimised compilers that may otherwise place
+     * the above increment elsewhere. */
+    portMEMORY_BARRIER();
+}
+/*----------------------------------------------------------*/
+
+#if ( configUSE_TICKLESS_IDLE != 0 )
+
+    static TickType_t prvGetExpectedIdleTime( void )
+    {
+        TickType_t xReturn;
+        UBaseType_t uxHigherPriorityReadyTasks = pdFALSE;
+
+        /* uxHigherPriorityReadyTasks takes care of the case where
+         * configUSE_PREEMPTION is 0, so there may be tasks above the idle priority
+         * task that are in the Ready state, even though the idle task is
+         * running. */
+        #if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 )
+        {
+            if( uxTopReadyPriority > tskIDLE_PRIORITY )
+            {
+                uxHigherPriorityReadyTasks = pdTRUE;
+            }
+        }
+        #else
+        {
+            const UBaseType_t uxLeastSignificantBit = ( UBaseType_t ) 0x01;
+
+            /* When port optimised task selection is used the uxTopReadyPriority
+             * variable is used as a bit map.  If bits other than the least
+             * significant bit are set then there are tasks that have a priority
+             * above the idle priority that are in the Ready state.  This takes
+             * care of the case where the co-operative scheduler is in use. */
+            if( uxTopReadyPriority > uxLeastSignificantBit )
+            {
+                uxHigherPriorityReadyTasks = pdTRUE;
+            }
+        }
+        #endif /* if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 ) */
+
+        if( pxCurrentTCB->uxPriority > tskIDLE_PRIORITY )
+        {
+            xReturn = 0;
+        }
+        else if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ tskIDLE_PRIORITY ] ) ) > 1 )
+        {
+            /* There are other idle priority tasks in the ready state.  If
+             * time slicing is used then the very next tick interrupt must be
+             * processed. */
+            xReturn = 0;
+        }
+        else if( uxHigherPriorityReadyTasks != pdFALSE )
+        {
+            /* There are tasks in the Ready state that have a priority above the
+             * idle priority.  This path can only be reached if
+             * configUSE_PREEMPTION is 0. */
+            xReturn = 0;
+        }
+        else
+        {
+            xReturn = xNextTaskUnblockTime - xTickCount;
+
+            #if ( configUSE_TIME_TRIGGERED_SCHEDULE == 1 )
+            {
+                /* Time triggered slots are released by the tick interrupt, so
+                 * the tick on which the next slot falls due must not be
+                 * suppressed. */
+                if( ( pxTimeTriggeredSchedule != NULL ) && ( ( TickType_t ) ( xNextTimeTriggeredRelease - xTickCount ) < xReturn ) )
+                {
+                    xReturn = xNextTimeTriggeredRelease - xTickCount;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif
+        }
+
+        return xReturn;
+    }
+
+#endif /* configUSE_TICKLESS_IDLE */
+/*----------------------------------------------------------*/
+
+BaseType_t xTaskResumeAll( void )
+{
+    TCB_t * pxTCB = NULL;
+    BaseType_t xAlreadyYielded = pdFALSE;
+
+    /* If uxSchedulerSuspended is zero then this function does not match a
+     * previous call to vTaskSuspendAll(). */
+    configASSERT( uxSchedulerSuspended );
+
+    /* It is possible that an ISR caused a task to be removed from an event
+     * list while the scheduler was suspended.  If this was the case then the
+     * removed task will have been added to the xPendingReadyList.  Once the
+     * scheduler has been resumed it is safe to move all the pending ready
+     * tasks from this list into their appropriate ready list. */
+    taskENTER_CRITICAL();
+    {
+        --uxSchedulerSuspended;
+
+        if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+        {
+            if( uxCurrentNumberOfTasks > ( UBaseType_t ) 0U )
+            {
+                /* Move any readied tasks from the pending list into the
+                 * appropriate ready list. */
+                while( listLIST_IS_EMPTY( &xPendingReadyList ) == pdFALSE )
+                {
+                    pxTCB = listGET_OWNER_OF_HEAD_ENTRY( ( &xPendingReadyList ) ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+                    listREMOVE_ITEM( &( pxTCB->xEventListItem ) );
+                    portMEMORY_BARRIER();
+                    listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
+                    prvAddTaskToReadyList( pxTCB );
+
+                    /* If the moved task has a priority higher than or equal to
+                     * the current task then a yield must be performed. */
+                    if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+                    {
+                        xYieldPending = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+
+                if( pxTCB != NULL )
+                {
+                    /* A task was unblocked while the scheduler was suspended,
+                     * which may have prevented the next unblock time from being
+                     * re-calculated, in which case re-calculate it now.  Mainly
+                     * important for low power tickless implementations, where
+                     * this can prevent an unnecessary exit from low power
+                     * state. */
+                    prvResetNextTaskUnblockTime();
+                }
+
+                #if ( configUSE_DEADLINE_TIMERS == 1 )
+                {
+                    /* Start or stop any deadline timers an interrupt asked for
+                     * while the scheduler was suspended.  This is done before
+                     * the pended ticks are processed, so their expiry times are
+                     * calculated from a tick count close to when they were
+                     * requested. */
+                    prvProcessDeadlineTimerRequests();
+                }
+                #endif /* configUSE_DEADLINE_TIMERS */
+
+                /* If any ticks occurred while the scheduler was suspended then
+                 * they should be processed now.  This ensures the tick count does
+                 * not  slip, and that any delayed tasks are resumed at the correct
+                 * time. */
+                {
+                    TickType_t xPendedCounts = xPendedTicks; /* Non-volatile copy. */
+
+                    if( xPendedCounts > ( TickType_t ) 0U )
+                    {
+                        do
+                        {
+                            if( xTaskIncrementTick() != pdFALSE )
+                            {
+                                xYieldPending = pdTRUE;
+                            }
+                            else
+                            {
+                                mtCOVERAGE_TEST_MARKER();
+                            }
+
+                            --xPendedCounts;
+                        } while( xPendedCounts > ( TickType_t ) 0U );
+
+                        xPendedTicks = 0;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+
+                if( xYieldPending != pdFALSE )
+                {
+                    #if ( configUSE_PREEMPTION != 0 )
+                    {
+                        xAlreadyYielded = pdTRUE;
+                    }
+                    #endif
+                    taskYIELD_IF_USING_PREEMPTION();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    taskEXIT_CRITICAL();
+
+    return xAlreadyYielded;
+}
+/*-----------------------------------------------------------*/
+
+TickType_t xTaskGetTickCount( void )
+{
+    TickType_t xTicks;
+
+    #if ( configUSE_ADAPTIVE_TICK == 1 )
+    {
+        UBaseType_t uxSavedInterruptStatus;
+
+        /* Add the tick periods that have passed while the tick was deferred,
+         * without restoring the tick.  The mask keeps the tick interrupt from
+         * counting them between the two reads. */
+        uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            xTicks = xTickCount;
+
+            if( xAdaptiveTickActive != pdFALSE )
+            {
+                xTicks += portADAPTIVE_TICK_ELAPSED();
+            }
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+    }
+    #else
+    {
+        /* Critical section required if running on a 16 bit processor. */
+        portTICK_TYPE_ENTER_CRITICAL();
+        {
+            xTicks = xTickCount;
+        }
+        portTICK_TYPE_EXIT_CRITICAL();
+    }
+    #endif /* configUSE_ADAPTIVE_TICK */
+
+    return xTicks;
+}
+/*-----------------------------------------------------------*/
+
+TickType_t xTaskGetTickCountFromISR( void )
+{
+    TickType_t xReturn;
+    UBaseType_t uxSavedInterruptStatus;
+
+    /* RTOS ports that support interrupt nesting have the concept of a maximum
+     * system call (or maximum API call) interrupt priority.  Interrupts that are
+     * above the maximum system call priority are kept permanently enabled, even
+     * when the RTOS kernel is in a critical section, but cannot make any calls to
+     * FreeRTOS API functions.  If configASSERT() is defined in FreeRTOSConfig.h
+     * then portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
+     * failure if a FreeRTOS API function is called from an interrupt that has been
+     * assigned a priority above the configured maximum system call priority.
+     * Only FreeRTOS functions that end in FromISR can be called from interrupts
+     * that have been assigned a priority at or (logically) below the maximum
+     * system call  interrupt priority.  FreeRTOS maintains a separate interrupt
+     * safe API to ensure interrupt entry is as fast and as simple as possible.
+     * More information (albeit Cortex-M specific) is provided on the following
+     * link: https://www.FreeRTOS.org/RTOS-Cortex-M3-M4.html */
+    portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+    #if ( configUSE_ADAPTIVE_TICK == 1 )
+    {
+        /* As xTaskGetTickCount(). */
+        uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            xReturn = xTickCount;
+
+            if( xAdaptiveTickActive != pdFALSE )
+            {
+                xReturn += portADAPTIVE_TICK_ELAPSED();
+            }
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+    }
+    #else
+    {
+        uxSavedInterruptStatus = portTICK_TYPE_SET_INTERRUPT_MASK_FROM_ISR();
+        {
+            xReturn = xTickCount;
+        }
+        portTICK_TYPE_CLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+    }
+    #endif /* configUSE_ADAPTIVE_TICK */
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxTaskGetNumberOfTasks( void )
+{
+    /* A critical section is not required because the variables are of type
+     * BaseType_t. */
+    return uxCurrentNumberOfTasks;
+}
+/*-----------------------------------------------------------*/
+
+char * pcTaskGetName( TaskHandle_t xTaskToQuery ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+{
+    TCB_t * pxTCB;
+
+    /* If null is passed in here then the name of the calling task is being
+     * queried. */
+    pxTCB = prvGetTCBFromHandle( xTaskToQuery );
+    configASSERT( pxTCB );
+    return &( pxTCB->pcTaskName[ 0 ] );
+}
+/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_xTaskGetHandle == 1 )
+
+    static TCB_t * prvSearchForNameWithinSingleList( List_t * pxList,
+                                                     const char pcNameToQuery[] )
+    {
+        TCB_t * pxNextTCB;
+        TCB_t * pxFirstTCB;
+        TCB_t * pxReturn = NULL;
+        UBaseType_t x;
+        char cNextChar;
+        BaseType_t xBreakLoop;
+
+        /* This function is called with the scheduler suspended. */
+
+        if( listCURRENT_LIST_LENGTH( pxList ) > ( UBaseType_t ) 0 )
+        {
+            listGET_OWNER_OF_NEXT_ENTRY( pxFirstTCB, pxList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+            do
+            {
+                listGET_OWNER_OF_NEXT_ENTRY( pxNextTCB, pxList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+                /* The delayed lists can also hold deadline timers, which have
+                 * no name. */
+                if( taskIS_DEADLINE_TIMER( pxNextTCB ) )
+                {
+                    continue;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                /* Check each character in the name looking for a match or
+                 * mismatch. */
+                xBreakLoop = pdFALSE;
+
+                for( x = ( UBaseType_t ) 0; x < ( UBaseType_t ) configMAX_TASK_NAME_LEN; x++ )
+                {
+                    cNextChar = pxNextTCB->pcTaskName[ x ];
+
+                    if( cNextChar != pcNameToQuery[ x ] )
+                    {
+                        /* Characters didn't match. */
+                        xBreakLoop = pdTRUE;
+                    }
+                    else if( cNextChar == ( char ) 0x00 )
+                    {
+                        /* Both strings terminated, a match must have been
+                         * found. */
+                        pxReturn = pxNextTCB;
+                        xBreakLoop = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    if( xBreakLoop != pdFALSE )
+                    {
+                        break;
+                    }
+                }
+
+                if( pxReturn != NULL )
+                {
+                    /* The handle has been found. */
+                    break;
+                }
+            } while( pxNextTCB != pxFirstTCB );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return pxReturn;
+    }
+
+#endif /* INCLUDE_xTaskGetHandle */
+/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_xTaskGetHandle == 1 )
+
+    TaskHandle_t xTaskGetHandle( const char * pcNameToQuery ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+    {
+        UBaseType_t uxQueue = configMAX_PRIORITIES;
+        TCB_t * pxTCB;
+
+        /* Task names will be truncated to configMAX_TASK_NAME_LEN - 1 bytes. */
+        configASSERT( strlen( pcNameToQuery ) < configMAX_TASK_NAME_LEN );
+
+        vTaskSuspendAll();
+        {
+            /* Search the ready lists. */
+            do
+            {
+                uxQueue--;
+                pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) &( pxReadyTasksLists[ uxQueue ] ), pcNameToQuery );
+
+                if( pxTCB != NULL )
+                {
+                    /* Found the handle. */
+                    break;
+                }
+            } while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+
+            /* Search the delayed lists. */
+            if( pxTCB == NULL )
+            {
+                pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxDelayedTaskList, pcNameToQuery );
+            }
+
+            if( pxTCB == NULL )
+            {
+                pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxOverflowDelayedTaskList, pcNameToQuery );
+            }
+
+            #if ( configUSE_TIME_TRIGGERED_SCHEDULE == 1 )
+            {
+                if( pxTCB == NULL )
+                {
+                    /* Search the list of tasks waiting for a slot. */
+                    pxTCB = prvSearchForNameWithinSingleList( &xTimeTriggeredWaitingList, pcNameToQuery );
+                }
+            }
+            #endif
+
+            #if ( INCLUDE_vTaskSuspend == 1 )
+            {
+                if( pxTCB == NULL )
+                {
+                    /* Search the suspended list. */
+                    pxTCB = prvSearchForNameWithinSingleList( &xSuspendedTaskList, pcNameToQuery );
+                }
+            }
+            #endif
+
+            #if ( INCLUDE_vTaskDelete == 1 )
+            {
+                if( pxTCB == NULL )
+                {
+                    /* Search the deleted list. */
+                    pxTCB = prvSearchForNameWithinSingleList( &xTasksWaitingTermination, pcNameToQuery );
+                }
+            }
+            #endif
+        }
+        ( void ) xTaskResumeAll();
+
+        return pxTCB;
+    }
+
+#endif /* INCLUDE_xTaskGetHandle */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRACE_FACILITY == 1 )
+
+    UBaseType_t uxTaskGetSystemState( TaskStatus_t * const pxTaskStatusArray,
+                                      const UBaseType_t uxArraySize,
+                                      configRUN_TIME_COUNTER_TYPE * const pulTotalRunTime )
+    {
+        UBaseType_t uxTask = 0, uxQueue = configMAX_PRIORITIES;
+
+        vTaskSuspendAll();
+        {
+            /* Is there a space in the array for each task in the system? */
+            if( uxArraySize >= uxCurrentNumberOfTasks )
+            {
+                /* Fill in an TaskStatus_t structure with information on each
+                 * task in the Ready state. */
+                do
+                {
+                    uxQueue--;
+                    uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( pxReadyTasksLists[ uxQueue ] ), eReady );
+                } while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+
+                /* Fill in an TaskStatus_t structure with information on each
+                 * task in the Blocked state. */
+                uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxDelayedTaskList, eBlocked );
+                uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxOverflowDelayedTaskList, eBlocked );
+
+                #if ( configUSE_TIME_TRIGGERED_SCHEDULE == 1 )
+                {
+                    /* Fill in an TaskStatus_t structure with information on
+                     * each task waiting for a time triggered slot. */
+                    uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &xTimeTriggeredWaitingList, eBlocked );
+                }
+                #endif
+
+                #if ( INCLUDE_vTaskDelete == 1 )
+                {
+                    /* Fill in an TaskStatus_t structure with information on
+                     * each task that has been deleted but not yet cleaned up. */
+                    uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &xTasksWaitingTermination, eDeleted );
+                }
+                #endif
+
+                #if ( INCLUDE_vTaskSuspend == 1 )
+                {
+                    /* Fill in an TaskStatus_t structure with information on
+                     * each task in the Suspended state. */
+                    uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &xSuspendedTaskList, eSuspended );
+                }
+                #endif
+
+                #if ( configGENERATE_RUN_TIME_STATS == 1 )
+                {
+                    if( pulTotalRunTime != NULL )
+                    {
+                        #ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+                            portALT_GET_RUN_TIME_COUNTER_VALUE( ( *pulTotalRunTime ) );
+                        #else
+                            *pulTotalRunTime = portGET_RUN_TIME_COUNTER_VALUE();
+                        #endif
+                    }
+                }
+                #else /* if ( configGENERATE_RUN_TIME_STATS == 1 ) */
+                {
+                    if( pulTotalRunTime != NULL )
+                    {
+                        *pulTotalRunTime = 0;
+                    }
+                }
+                #endif /* if ( configGENERATE_RUN_TIME_STATS == 1 ) */
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        ( void ) xTaskResumeAll();
+
+        return uxTask;
+    }
+
+#endif /* configUSE_TRACE_FACILITY */
+/*----------------------------------------------------------*/
+
+#if ( INCLUDE_xTaskGetIdleTaskHandle == 1 )
+
+    TaskHandle_t xTaskGetIdleTaskHandle( void )
+    {
+        /* If xTaskGetIdleTaskHandle() is called before the scheduler has been
+         * started, then xIdleTaskHandle will be NULL. */
+        configASSERT( ( xIdleTaskHandle != NULL ) );
+        return xIdleTaskHandle;
+    }
+
+#endif /* INCLUDE_xTaskGetIdleTaskHandle */
+/*----------------------------------------------------------*/
+
+/* This conditional compilation should use inequality to 0, not equality to 1.
+ * This is to ensure vTaskStepTick() is available when user defined low power mode
+ * implementations require configUSE_TICKLESS_IDLE to be set to a value other than
+ * 1. */
+#if ( configUSE_TICKLESS_IDLE != 0 )
+
+    void vTaskStepTick( TickType_t xTicksToJump )
+    {
         /* Correct the tick count value after a period during which the tick
          * was suppressed.  Note this does *not* call the tick hook function for
          * each stepped tick. */
         configASSERT( ( xTickCount + xTicksToJump ) <= xNextTaskUnblockTime );
 
-        if( ( xTickCount + xTicksToJump ) == xNextTaskUnblockTime )
+        if( ( xTickCount + xTicksToJump ) == xNextTaskUnblockTime )
+        {
+            /* Arrange for xTickCount to reach xNextTaskUnblockTime in
+             * xTaskIncrementTick() when the scheduler resumes.  This ensures
+             * that any delayed tasks are resumed at the correct time. */
+            configASSERT( uxSchedulerSuspended );
+            configASSERT( xTicksToJump != ( TickType_t ) 0 );
+
+            /* Prevent the tick interrupt modifying xPendedTicks simultaneously. */
+            taskENTER_CRITICAL();
+            {
+                xPendedTicks++;
+            }
+            taskEXIT_CRITICAL();
+            xTicksToJump--;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        xTickCount += xTicksToJump;
+        traceINCREASE_TICK_COUNT( xTicksToJump );
+    }
+
+#endif /* configUSE_TICKLESS_IDLE */
+/*----------------------------------------------------------*/
+
+BaseType_t xTaskCatchUpTicks( TickType_t xTicksToCatchUp )
+{
+    BaseType_t xYieldOccurred;
+
+    /* Must not be called with the scheduler suspended as the implementation
+     * relies on xPendedTicks being wound down to 0 in xTaskResumeAll(). */
+    configASSERT( uxSchedulerSuspended == 0 );
+
+    /* Use xPendedTicks to mimic xTicksToCatchUp number of ticks occurring when
+     * the scheduler is suspended so the ticks are executed in xTaskResumeAll(). */
+    vTaskSuspendAll();
+
+    /* The ticks being caught up are in addition to any counted while the
+     * tick was deferred.  Restored after suspending the scheduler so the tick
+     * cannot be deferred again before the pended ticks are processed. */
+    taskEXIT_ADAPTIVE_TICK();
+
+    /* Prevent the tick interrupt modifying xPendedTicks simultaneously. */
+    taskENTER_CRITICAL();
+    {
+        xPendedTicks += xTicksToCatchUp;
+    }
+    taskEXIT_CRITICAL();
+    xYieldOccurred = xTaskResumeAll();
+
+    return xYieldOccurred;
+}
+/*----------------------------------------------------------*/
+
+#if ( INCLUDE_xTaskAbortDelay == 1 )
+
+    BaseType_t xTaskAbortDelay( TaskHandle_t xTask )
+    {
+        TCB_t * pxTCB = xTask;
+        BaseType_t xReturn;
+
+        configASSERT( pxTCB );
+
+        vTaskSuspendAll();
+        {
+            /* A task can only be prematurely removed from the Blocked state if
+             * it is actually in the Blocked state. */
+            if( eTaskGetState( xTask ) == eBlocked )
+            {
+                xReturn = pdPASS;
+
+                /* Remove the reference to the task from the blocked list.  An
+                 * interrupt won't touch the xStateListItem because the
+                 * scheduler is suspended. */
+                ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+
+                /* Is the task waiting on an event also?  If so remove it from
+                 * the event list too.  Interrupts can touch the event list item,
+                 * even though the scheduler is suspended, so a critical section
+                 * is used. */
+                taskENTER_CRITICAL();
+                {
+                    if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+                    {
+                        ( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+
+                        /* This lets the task know it was forcibly removed from the
+                         * blocked state so it should not re-evaluate its block time and
+                         * then block again. */
+                        pxTCB->ucDelayAborted = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                taskEXIT_CRITICAL();
+
+                /* Place the unblocked task into the appropriate ready list. */
+                prvAddTaskToReadyList( pxTCB );
+
+                /* A task being unblocked cannot cause an immediate context
+                 * switch if preemption is turned off. */
+                #if ( configUSE_PREEMPTION == 1 )
+                {
+                    /* Preemption is on, but a context switch should only be
+                     * performed if the unblocked task has a priority that is
+                     * higher than the currently executing task. */
+                    if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                    {
+                        /* Pend the yield to be performed when the scheduler
+                         * is unsuspended. */
+                        xYieldPending = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                #endif /* configUSE_PREEMPTION */
+            }
+            else
+            {
+                xReturn = pdFAIL;
+            }
+        }
+        ( void ) xTaskResumeAll();
+
+        return xReturn;
+    }
+
+#endif /* INCLUDE_xTaskAbortDelay */
+/*----------------------------------------------------------*/
+
+BaseType_t xTaskIncrementTick( void )
+{
+    TCB_t * pxTCB;
+    TickType_t xItemValue;
+    BaseType_t xSwitchRequired = pdFALSE;
+
+    /* Called by the portable layer each time a tick interrupt occurs.
+     * Increments the tick then checks to see if the new tick value will cause any
+     * tasks to be unblocked. */
+    traceTASK_INCREMENT_TICK( xTickCount );
+
+    if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+    {
+        /* Minor optimisation.  The tick count cannot change in this
+         * block. */
+        const TickType_t xConstTickCount = xTickCount + ( TickType_t ) 1;
+
+        /* Increment the RTOS tick, switching the delayed and overflowed
+         * delayed lists if it wraps to 0. */
+        xTickCount = xConstTickCount;
+
+        if( xConstTickCount == ( TickType_t ) 0U ) /*lint !e774 'if' does not always evaluate to false as it is looking for an overflow. */
+        {
+            taskSWITCH_DELAYED_LISTS();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        /* See if this tick has made a timeout expire.  Tasks are stored in
+         * the  queue in the order of their wake time - meaning once one task
+         * has been found whose block time has not expired there is no need to
+         * look any further down the list. */
+        if( xConstTickCount >= xNextTaskUnblockTime )
+        {
+            for( ; ; )
+            {
+                if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
+                {
+                    /* The delayed list is empty.  Set xNextTaskUnblockTime
+                     * to the maximum possible value so it is extremely
+                     * unlikely that the
+                     * if( xTickCount >= xNextTaskUnblockTime ) test will pass
+                     * next time through. */
+                    xNextTaskUnblockTime = portMAX_DELAY; /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+                    break;
+                }
+                else
+                {
+                    /* The delayed list is not empty, get the value of the
+                     * item at the head of the delayed list.  This is the time
+                     * at which the task at the head of the delayed list must
+                     * be removed from the Blocked state. */
+                    pxTCB = listGET_OWNER_OF_HEAD_ENTRY( pxDelayedTaskList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+                    xItemValue = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxDelayedTaskList );
+
+                    if( xConstTickCount < xItemValue )
+                    {
+                        /* It is not time to unblock this item yet, but the
+                         * item value is the time at which the task at the head
+                         * of the blocked list must be removed from the Blocked
+                         * state -  so record the item value in
+                         * xNextTaskUnblockTime. */
+                        xNextTaskUnblockTime = xItemValue;
+                        break; /*lint !e9011 Code structure here is deemed easier to understand with multiple breaks. */
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    #if ( configUSE_DEADLINE_TIMERS == 1 )
+                    {
+                        /* Deadline timers share the delayed list with the
+                         * blocked tasks, so are called in the same pass. */
+                        if( taskIS_DEADLINE_TIMER( pxTCB ) )
+                        {
+                            if( prvExpireDeadlineTimer( ( DeadlineTimer_t * ) ( void * ) pxTCB ) != pdFALSE )
+                            {
+                                xSwitchRequired = pdTRUE;
+                            }
+                            else
+                            {
+                                mtCOVERAGE_TEST_MARKER();
+                            }
+
+                            continue;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    #endif /* configUSE_DEADLINE_TIMERS */
+
+                    /* It is time to remove the item from the Blocked state. */
+                    listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
+
+                    /* Is the task waiting on an event also?  If so remove
+                     * it from the event list. */
+                    if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+                    {
+                        listREMOVE_ITEM( &( pxTCB->xEventListItem ) );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    /* Place the unblocked task into the appropriate ready
+                     * list. */
+                    prvAddTaskToReadyList( pxTCB );
+
+                    /* A task being unblocked cannot cause an immediate
+                     * context switch if preemption is turned off. */
+                    #if ( configUSE_PREEMPTION == 1 )
+                    {
+                        /* Preemption is on, but a context switch should
+                         * only be performed if the unblocked task's
+                         * priority is higher than the currently executing
+                         * task.
+                         * The case of equal priority tasks sharing
+                         * processing time (which happens when both
+                         * preemption and time slicing are on) is
+                         * handled below.*/
+                        if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                        {
+                            xSwitchRequired = pdTRUE;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    #endif /* configUSE_PREEMPTION */
+                }
+            }
+        }
+
+        #if ( configUSE_TIME_TRIGGERED_SCHEDULE == 1 )
+        {
+            /* Release any time triggered slots that fall due on this tick. */
+            if( ( pxTimeTriggeredSchedule != NULL ) && ( xConstTickCount == xNextTimeTriggeredRelease ) )
+            {
+                if( prvReleaseTimeTriggeredSlots( xConstTickCount ) != pdFALSE )
+                {
+                    xSwitchRequired = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* configUSE_TIME_TRIGGERED_SCHEDULE */
+
+        #if ( configUSE_TIME_PARTITIONS == 1 )
+        {
+            if( pxPartitionWindows != NULL )
+            {
+                if( prvUpdatePartitionWindow() != pdFALSE )
+                {
+                    xSwitchRequired = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* configUSE_TIME_PARTITIONS */
+
+        /* Tasks of equal priority to the currently running task will share
+         * processing time (time slice) if preemption is on, and the application
+         * writer has not explicitly turned time slicing off. */
+        #if ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) )
+        {
+            if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ) ) > ( UBaseType_t ) 1 )
+            {
+                xSwitchRequired = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) ) */
+
+        #if ( configUSE_TICK_HOOK == 1 )
+        {
+            /* Guard against the tick hook being called when the pended tick
+             * count is being unwound (when the scheduler is being unlocked). */
+            if( xPendedTicks == ( TickType_t ) 0 )
+            {
+                vApplicationTickHook();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* configUSE_TICK_HOOK */
+
+        #if ( configUSE_PREEMPTION == 1 )
+        {
+            if( xYieldPending != pdFALSE )
+            {
+                xSwitchRequired = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* configUSE_PREEMPTION */
+    }
+    else
+    {
+        ++xPendedTicks;
+
+        /* The tick hook gets called at regular intervals, even if the
+         * scheduler is locked. */
+        #if ( configUSE_TICK_HOOK == 1 )
+        {
+            vApplicationTickHook();
+        }
+        #endif
+    }
+
+    return xSwitchRequired;
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_DEFERRED_TICK_PROCESSING == 1 )
+
+    void vTaskDeferTickFromISR( void )
+    {
+        /* The tick interrupt cannot preempt vTaskProcessDeferredTicks() as
+         * both run at the same priority, so no further protection is needed. */
+        xDeferredTicks++;
+    }
+
+#endif /* configUSE_DEFERRED_TICK_PROCESSING */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_DEFERRED_TICK_PROCESSING == 1 )
+
+    void vTaskProcessDeferredTicks( void )
+    {
+        TCB_t * pxTCB;
+        TickType_t xNextTickCount;
+        UBaseType_t uxUnblocked;
+        UBaseType_t uxSavedInterruptStatus;
+
+        while( xDeferredTicks > ( TickType_t ) 0U )
+        {
+            xNextTickCount = xTickCount + ( TickType_t ) 1;
+
+            /* Move the tasks that the next tick unblocks to the ready lists a
+             * batch at a time, leaving interrupts enabled between batches.
+             * Tasks cannot run until this function returns, so the only other
+             * writers of the delayed list are interrupts.  They can remove
+             * items from it and, with deadline timers, insert them, but only
+             * with interrupts masked, and each batch reads the head of the
+             * list again under the mask.  An item inserted between batches is
+             * therefore either expired by a later batch or left for
+             * xTaskIncrementTick().  When the scheduler is suspended
+             * xTaskIncrementTick() just pends the tick, and when the tick count
+             * wraps the delayed lists must be switched first, so in both cases
+             * the expiry is left to xTaskIncrementTick(). */
+            if( ( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE ) && ( xNextTickCount != ( TickType_t ) 0U ) )
+            {
+                do
+                {
+                    uxUnblocked = ( UBaseType_t ) 0U;
+
+                    uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+                    {
+                        while( ( uxUnblocked < ( UBaseType_t ) configDEFERRED_TICK_UNBLOCK_BATCH ) &&
+                               ( listLIST_IS_EMPTY( pxDelayedTaskList ) == pdFALSE ) )
+                        {
+                            pxTCB = listGET_OWNER_OF_HEAD_ENTRY( pxDelayedTaskList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+                            if( listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxDelayedTaskList ) > xNextTickCount )
+                            {
+                                break;
+                            }
+                            else
+                            {
+                                mtCOVERAGE_TEST_MARKER();
+                            }
+
+                            #if ( configUSE_DEADLINE_TIMERS == 1 )
+                            {
+                                if( taskIS_DEADLINE_TIMER( pxTCB ) )
+                                {
+                                    /* The caller performs a context switch
+                                     * anyway. */
+                                    ( void ) prvExpireDeadlineTimer( ( DeadlineTimer_t * ) ( void * ) pxTCB );
+                                    uxUnblocked++;
+                                    continue;
+                                }
+                                else
+                                {
+                                    mtCOVERAGE_TEST_MARKER();
+                                }
+                            }
+                            #endif /* configUSE_DEADLINE_TIMERS */
+
+                            listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
+
+                            if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+                            {
+                                listREMOVE_ITEM( &( pxTCB->xEventListItem ) );
+                            }
+                            else
+                            {
+                                mtCOVERAGE_TEST_MARKER();
+                            }
+
+                            /* The context switch, if one is needed, is
+                             * performed by the caller. */
+                            prvAddTaskToReadyList( pxTCB );
+                            uxUnblocked++;
+                        }
+                    }
+                    taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+                } while( uxUnblocked == ( UBaseType_t ) configDEFERRED_TICK_UNBLOCK_BATCH );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            /* Advance the tick count and do the remaining per tick processing.
+             * No delayed task is still due, so this takes bounded time. */
+            uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+            {
+                xDeferredTicks--;
+                ( void ) xTaskIncrementTick();
+            }
+            taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+        }
+    }
+
+#endif /* configUSE_DEFERRED_TICK_PROCESSING */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_ADAPTIVE_TICK == 1 )
+
+    void vTaskEnterAdaptiveTick( void )
+    {
+        TickType_t xTicks;
+
+        /* Called by the tick interrupt, with interrupts masked, after a tick
+         * that did not request a context switch.  The next tick can only be
+         * deferred if nothing is waiting to be processed on it, the running
+         * task has no time slicing partner, and no tick driven decision is due
+         * before the deadline. */
+        if( ( uxSchedulerSuspended != ( UBaseType_t ) pdFALSE ) ||
+            ( xPendedTicks != ( TickType_t ) 0U ) ||
+            ( xYieldPending != pdFALSE ) ||
+            ( listLIST_IS_EMPTY( &xPendingReadyList ) == pdFALSE ) ||
+            ( xNextTaskUnblockTime <= xTickCount ) )
+        {
+            xTicks = ( TickType_t ) 0U;
+        }
+        else
+        {
+            /* The tick on which the next task unblocks is processed as
+             * normal, as is the tick on which the count wraps, so the ticks
+             * counted on exit never unblock a task or switch the delayed
+             * lists. */
+            xTicks = xNextTaskUnblockTime - xTickCount;
+
+            if( xTicks > ( portMAX_DELAY - xTickCount ) )
+            {
+                xTicks = portMAX_DELAY - xTickCount;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            #if ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) )
+            {
+                if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ) ) > ( UBaseType_t ) 1 )
+                {
+                    xTicks = ( TickType_t ) 0U;
+                }
+            }
+            #endif
+
+            #if ( configUSE_TICKLESS_IDLE != 0 )
+            {
+                /* Idle time is left to portSUPPRESS_TICKS_AND_SLEEP(). */
+                if( pxCurrentTCB->uxPriority == tskIDLE_PRIORITY )
+                {
+                    xTicks = ( TickType_t ) 0U;
+                }
+            }
+            #endif
+
+            #if ( configUSE_TIME_TRIGGERED_SCHEDULE == 1 )
+            {
+                if( ( pxTimeTriggeredSchedule != NULL ) && ( xTicks > ( TickType_t ) ( xNextTimeTriggeredRelease - xTickCount ) ) )
+                {
+                    xTicks = xNextTimeTriggeredRelease - xTickCount;
+                }
+            }
+            #endif
+
+            #if ( configUSE_TIME_PARTITIONS == 1 )
+            {
+                /* Partition windows are opened and closed on every tick. */
+                if( pxPartitionWindows != NULL )
+                {
+                    xTicks = ( TickType_t ) 0U;
+                }
+            }
+            #endif
+        }
+
+        /* Deferring a single tick saves nothing. */
+        if( xTicks > ( TickType_t ) 1U )
+        {
+            if( portADAPTIVE_TICK_START( xTicks ) != ( TickType_t ) 0U )
+            {
+                xAdaptiveTickActive = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+#endif /* configUSE_ADAPTIVE_TICK */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_ADAPTIVE_TICK == 1 )
+
+    void vTaskExitAdaptiveTick( void )
+    {
+        UBaseType_t uxSavedInterruptStatus;
+        TickType_t xTicks;
+
+        uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            if( xAdaptiveTickActive != pdFALSE )
+            {
+                xAdaptiveTickActive = pdFALSE;
+
+                /* The deferred ticks end before xNextTaskUnblockTime and
+                 * before the count wraps, so only the count has to move. */
+                xTicks = portADAPTIVE_TICK_STOP();
+                xTickCount += xTicks;
+                traceINCREASE_TICK_COUNT( xTicks );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+    }
+
+#endif /* configUSE_ADAPTIVE_TICK */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+
+    void vTaskSetApplicationTaskTag( TaskHandle_t xTask,
+                                     TaskHookFunction_t pxHookFunction )
+    {
+        TCB_t * xTCB;
+
+        /* If xTask is NULL then it is the task hook of the calling task that is
+         * getting set. */
+        if( xTask == NULL )
+        {
+            xTCB = ( TCB_t * ) pxCurrentTCB;
+        }
+        else
+        {
+            xTCB = xTask;
+        }
+
+        /* Save the hook function in the TCB.  A critical section is required as
+         * the value can be accessed from an interrupt. */
+        taskENTER_CRITICAL();
+        {
+            xTCB->pxTaskTag = pxHookFunction;
+        }
+        taskEXIT_CRITICAL();
+    }
+
+#endif /* configUSE_APPLICATION_TASK_TAG */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+
+    TaskHookFunction_t xTaskGetApplicationTaskTag( TaskHandle_t xTask )
+    {
+        TCB_t * pxTCB;
+        TaskHookFunction_t xReturn;
+
+        /* If xTask is NULL then set the calling task's hook. */
+        pxTCB = prvGetTCBFromHandle( xTask );
+
+        /* Save the hook function in the TCB.  A critical section is required as
+         * the value can be accessed from an interrupt. */
+        taskENTER_CRITICAL();
+        {
+            xReturn = pxTCB->pxTaskTag;
+        }
+        taskEXIT_CRITICAL();
+
+        return xReturn;
+    }
+
+#endif /* configUSE_APPLICATION_TASK_TAG */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+
+    TaskHookFunction_t xTaskGetApplicationTaskTagFromISR( TaskHandle_t xTask )
+    {
+        TCB_t * pxTCB;
+        TaskHookFunction_t xReturn;
+        UBaseType_t uxSavedInterruptStatus;
+
+        /* If xTask is NULL then set the calling task's hook. */
+        pxTCB = prvGetTCBFromHandle( xTask );
+
+        /* Save the hook function in the TCB.  A critical section is required as
+         * the value can be accessed from an interrupt. */
+        uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            xReturn = pxTCB->pxTaskTag;
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+        return xReturn;
+    }
+
+#endif /* configUSE_APPLICATION_TASK_TAG */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+
+    BaseType_t xTaskCallApplicationTaskHook( TaskHandle_t xTask,
+                                             void * pvParameter )
+    {
+        TCB_t * xTCB;
+        BaseType_t xReturn;
+
+        /* If xTask is NULL then we are calling our own task hook. */
+        if( xTask == NULL )
+        {
+            xTCB = pxCurrentTCB;
+        }
+        else
+        {
+            xTCB = xTask;
+        }
+
+        if( xTCB->pxTaskTag != NULL )
+        {
+            xReturn = xTCB->pxTaskTag( pvParameter );
+        }
+        else
+        {
+            xReturn = pdFAIL;
+        }
+
+        return xReturn;
+    }
+
+#endif /* configUSE_APPLICATION_TASK_TAG */
+/*-----------------------------------------------------------*/
+
+void vTaskSwitchContext( void )
+{
+    if( uxSchedulerSuspended != ( UBaseType_t ) pdFALSE )
+    {
+        /* The scheduler is currently suspended - do not allow a context
+         * switch. */
+        xYieldPending = pdTRUE;
+    }
+    else
+    {
+        xYieldPending = pdFALSE;
+        traceTASK_SWITCHED_OUT();
+
+        /* The next task may need the tick, and xTickCount is read below. */
+        taskEXIT_ADAPTIVE_TICK();
+
+        #if ( configGENERATE_RUN_TIME_STATS == 1 )
+        {
+            #ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+                portALT_GET_RUN_TIME_COUNTER_VALUE( ulTotalRunTime );
+            #else
+                ulTotalRunTime = portGET_RUN_TIME_COUNTER_VALUE();
+            #endif
+
+            /* Add the amount of time the task has been running to the
+             * accumulated time so far.  The time the task started running was
+             * stored in ulTaskSwitchedInTime.  Note that there is no overflow
+             * protection here so count values are only valid until the timer
+             * overflows.  The guard against negative values is to protect
+             * against suspect run time stat counter implementations - which
+             * are provided by the application, not the kernel. */
+            if( ulTotalRunTime > ulTaskSwitchedInTime )
+            {
+                pxCurrentTCB->ulRunTimeCounter += ( ulTotalRunTime - ulTaskSwitchedInTime );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            ulTaskSwitchedInTime = ulTotalRunTime;
+        }
+        #endif /* configGENERATE_RUN_TIME_STATS */
+
+        /* Check for stack overflow, if configured. */
+        taskCHECK_FOR_STACK_OVERFLOW();
+
+        /* Before the currently running task is switched out, save its errno. */
+        #if ( configUSE_POSIX_ERRNO == 1 )
+        {
+            pxCurrentTCB->iTaskErrno = FreeRTOS_errno;
+        }
+        #endif
+
+        #if ( configUSE_PROPORTIONAL_SHARE == 1 )
+        {
+            prvChargeProportionalShare();
+        }
+        #endif
+
+        #if ( configUSE_STACK_TIERING == 1 )
         {
-            /* Arrange for xTickCount to reach xNextTaskUnblockTime in
-             * xTaskIncrementTick() when the scheduler resumes.  This ensures
-             * that any delayed tasks are resumed at the correct time. */
-            configASSERT( uxSchedulerSuspended );
-            configASSERT( xTicksToJump != ( TickType_t ) 0 );
+            pxCurrentTCB->xStackTierLastRun = xTickCount;
+        }
+        #endif
+
+        #if ( configUSE_RCU == 1 )
+        {
+            /* A task switched out inside a read-side critical section holds up
+             * the grace period that follows the current phase until it leaves
+             * the section.  A task that is not switched out inside a section
+             * cannot be inside one when another task runs, so nothing else is
+             * needed to track the readers. */
+            if( ( pxCurrentTCB->uxRcuReadNesting > ( UBaseType_t ) 0U ) && ( pxCurrentTCB->ucRcuPreemptedPhase == taskRCU_NOT_PREEMPTED ) )
+            {
+                pxCurrentTCB->ucRcuPreemptedPhase = ( uint8_t ) uxRcuPhase;
+                uxRcuPreemptedReaders[ uxRcuPhase ]++;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif
+
+        /* Select a new task to run using either the generic C or port
+         * optimised asm code. */
+        taskSELECT_HIGHEST_PRIORITY_TASK(); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+        #if ( configUSE_PROPORTIONAL_SHARE == 1 )
+        {
+            /* Tasks in the proportional share band are not time sliced in
+             * turn, but chosen by pass. */
+            if( pxCurrentTCB->uxPriority == ( UBaseType_t ) configPROPORTIONAL_SHARE_PRIORITY )
+            {
+                prvSelectProportionalShareTask();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif
+
+        #if ( configUSE_TIME_PARTITIONS == 1 )
+        {
+            /* Only the tasks of the partition that owns the open window, and
+             * the background tasks using its slack, can be selected. */
+            if( ( uxActivePartition < ( UBaseType_t ) configNUM_PARTITIONS ) && ( pxCurrentTCB->uxPartition != uxActivePartition ) )
+            {
+                prvSelectPartitionTask();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif
+
+        #if ( configUSE_STACK_TIERING == 1 )
+        {
+            /* The context of the task switched out has already been saved to
+             * its stack, so its slot can be reused. */
+            if( pxCurrentTCB->pxStackBackingStore != NULL )
+            {
+                prvLoadTieredStack( pxCurrentTCB );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif
+
+        traceTASK_SWITCHED_IN();
+
+        /* After the new task is switched in, update the global errno. */
+        #if ( configUSE_POSIX_ERRNO == 1 )
+        {
+            FreeRTOS_errno = pxCurrentTCB->iTaskErrno;
+        }
+        #endif
+
+        #if ( ( configUSE_NEWLIB_REENTRANT == 1 ) || ( configUSE_C_RUNTIME_TLS_SUPPORT == 1 ) )
+        {
+            /* Switch C-Runtime's TLS Block to point to the TLS
+             * Block specific to this task. */
+            configSET_TLS_BLOCK( pxCurrentTCB->xTLSBlock );
+        }
+        #endif
+    }
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_PROPORTIONAL_SHARE == 1 )
+
+    static void prvChargeProportionalShare( void )
+    {
+        uint32_t ulNow, ulCycles;
+
+        /* The counter is 32 bits, so the subtraction is correct across one
+         * wrap.  A task at configPROPORTIONAL_SHARE_PRIORITY that runs for
+         * longer than a full counter period without a context switch can only
+         * be alone in the band, so undercharging it has no effect on the
+         * selection. */
+        ulNow = portGET_CYCLE_COUNTER();
+        ulCycles = ulNow - ulShareSwitchedInCycles;
+        ulShareSwitchedInCycles = ulNow;
+
+        if( pxCurrentTCB->uxPriority == ( UBaseType_t ) configPROPORTIONAL_SHARE_PRIORITY )
+        {
+            pxCurrentTCB->ullSharePass += ( uint64_t ) ulCycles * ( uint64_t ) pxCurrentTCB->ulShareStride;
+            pxCurrentTCB->ullShareCycles += ( uint64_t ) ulCycles;
+            ullShareBandCycles += ( uint64_t ) ulCycles;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+#endif /* configUSE_PROPORTIONAL_SHARE */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_PROPORTIONAL_SHARE == 1 )
+
+    static void prvSelectProportionalShareTask( void )
+    {
+        List_t * const pxBandList = &( pxReadyTasksLists[ configPROPORTIONAL_SHARE_PRIORITY ] );
+        ListItem_t const * const pxEndMarker = listGET_END_MARKER( pxBandList );
+        ListItem_t * pxIterator;
+        TCB_t * pxTCB;
+        TCB_t * pxSelectedTCB = pxCurrentTCB;
+        uint64_t ullCredit;
+
+        for( pxIterator = listGET_HEAD_ENTRY( pxBandList ); pxIterator != pxEndMarker; pxIterator = listGET_NEXT( pxIterator ) )
+        {
+            pxTCB = listGET_LIST_ITEM_OWNER( pxIterator );
+
+            /* A task that was blocked did not accumulate pass, so it is owed
+             * the CPU time it missed.  Limit the debt to
+             * configPROPORTIONAL_SHARE_MAX_CREDIT cycles so a task that slept
+             * for a long time cannot monopolise the band when it wakes.
+             *
+             * Passes are compared through their signed difference so the
+             * comparisons remain correct when the 64-bit values wrap, which
+             * can happen after some hours for a task with a low weight. */
+            ullCredit = ( uint64_t ) ulShareMaxCredit * ( uint64_t ) pxTCB->ulShareStride;
+
+            if( ( int64_t ) ( pxTCB->ullSharePass - ( ullShareVirtualTime - ullCredit ) ) < 0 )
+            {
+                pxTCB->ullSharePass = ullShareVirtualTime - ullCredit;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( ( int64_t ) ( pxTCB->ullSharePass - pxSelectedTCB->ullSharePass ) < 0 )
+            {
+                pxSelectedTCB = pxTCB;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        pxCurrentTCB = pxSelectedTCB;
+
+        if( ( int64_t ) ( pxSelectedTCB->ullSharePass - ullShareVirtualTime ) > 0 )
+        {
+            ullShareVirtualTime = pxSelectedTCB->ullSharePass;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+#endif /* configUSE_PROPORTIONAL_SHARE */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_PROPORTIONAL_SHARE == 1 )
+
+    void vTaskSetShareWeight( TaskHandle_t xTask,
+                              uint32_t ulWeight )
+    {
+        TCB_t * pxTCB;
+
+        configASSERT( ( ulWeight > 0UL ) && ( ulWeight <= taskSHARE_MAX_WEIGHT ) );
+
+        /* Ensure the weight is valid. */
+        if( ulWeight == 0UL )
+        {
+            ulWeight = 1UL;
+        }
+        else if( ulWeight > taskSHARE_MAX_WEIGHT )
+        {
+            ulWeight = taskSHARE_MAX_WEIGHT;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        taskENTER_CRITICAL();
+        {
+            /* If null is passed in here then it is the weight of the calling
+             * task that is being changed.  The pass already accumulated is
+             * kept, so the new weight only applies to future run time. */
+            pxTCB = prvGetTCBFromHandle( xTask );
+            pxTCB->ulShareWeight = ulWeight;
+            pxTCB->ulShareStride = taskSHARE_STRIDE1 / ulWeight;
+        }
+        taskEXIT_CRITICAL();
+    }
+
+#endif /* configUSE_PROPORTIONAL_SHARE */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_PROPORTIONAL_SHARE == 1 )
+
+    uint32_t ulTaskGetShareWeight( TaskHandle_t xTask )
+    {
+        TCB_t const * pxTCB;
+
+        pxTCB = prvGetTCBFromHandle( xTask );
+
+        return pxTCB->ulShareWeight;
+    }
+
+#endif /* configUSE_PROPORTIONAL_SHARE */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_PROPORTIONAL_SHARE == 1 )
+
+    void vTaskGetShareCycles( TaskHandle_t xTask,
+                              uint64_t * pullTaskCycles,
+                              uint64_t * pullBandCycles )
+    {
+        TCB_t const * pxTCB;
+
+        configASSERT( pullTaskCycles );
+        configASSERT( pullBandCycles );
+
+        /* The counters are 64 bits, so must be read together within a
+         * critical section to be consistent with each other. */
+        taskENTER_CRITICAL();
+        {
+            pxTCB = prvGetTCBFromHandle( xTask );
+            *pullTaskCycles = pxTCB->ullShareCycles;
+            *pullBandCycles = ullShareBandCycles;
+        }
+        taskEXIT_CRITICAL();
+    }
+
+#endif /* configUSE_PROPORTIONAL_SHARE */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_PROPORTIONAL_SHARE == 1 )
+
+    uint32_t ulTaskGetAchievedShare( TaskHandle_t xTask )
+    {
+        uint64_t ullTaskCycles, ullBandCycles;
+        uint32_t ulReturn = 0UL;
+
+        vTaskGetShareCycles( xTask, &ullTaskCycles, &ullBandCycles );
+
+        if( ullBandCycles > 0ULL )
+        {
+            ulReturn = ( uint32_t ) ( ( ullTaskCycles * 1000ULL ) / ullBandCycles );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return ulReturn;
+    }
+
+#endif /* configUSE_PROPORTIONAL_SHARE */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TIME_TRIGGERED_SCHEDULE == 1 )
+
+    void vTaskStartTimeTriggeredSchedule( const TimeTriggeredSlot_t * const pxSchedule,
+                                          const UBaseType_t uxSlots,
+                                          const TickType_t xMajorFrameTicks )
+    {
+        UBaseType_t uxSlot;
+        TimeTriggeredSlotState_t * pxSlot;
+
+        configASSERT( pxSchedule );
+        configASSERT( ( uxSlots > ( UBaseType_t ) 0U ) && ( uxSlots <= ( UBaseType_t ) configTIME_TRIGGERED_MAX_SLOTS ) );
+        configASSERT( xMajorFrameTicks > ( TickType_t ) 0U );
+        configASSERT( xSchedulerRunning != pdFALSE );
+
+        /* The slots are released in table order, so the offsets must ascend
+         * and fall within the major frame. */
+        for( uxSlot = ( UBaseType_t ) 0U; uxSlot < uxSlots; uxSlot++ )
+        {
+            configASSERT( pxSchedule[ uxSlot ].xOffset < xMajorFrameTicks );
+            configASSERT( ( uxSlot == ( UBaseType_t ) 0U ) || ( pxSchedule[ uxSlot ].xOffset >= pxSchedule[ uxSlot - 1U ].xOffset ) );
+        }
+
+        taskENTER_CRITICAL();
+        {
+            /* The schedule can only be started once. */
+            configASSERT( pxTimeTriggeredSchedule == NULL );
+
+            for( uxSlot = ( UBaseType_t ) 0U; uxSlot < uxSlots; uxSlot++ )
+            {
+                pxSlot = &( xTimeTriggeredSlotStates[ uxSlot ] );
+                pxSlot->pxTask = NULL;
+                pxSlot->xReleaseTick = ( TickType_t ) 0U;
+                pxSlot->ulReleaseCycles = 0UL;
+                pxSlot->ucState = taskSLOT_IDLE;
+                pxSlot->xStats.ulReleases = 0UL;
+                pxSlot->xStats.ulMissedReleases = 0UL;
+                pxSlot->xStats.ulOverruns = 0UL;
+                pxSlot->xStats.ulMinReleaseLatency = UINT32_MAX;
+                pxSlot->xStats.ulMaxReleaseLatency = 0UL;
+                pxSlot->xStats.ulReleaseJitter = 0UL;
+            }
+
+            uxTimeTriggeredSlots = uxSlots;
+            xTimeTriggeredMajorFrame = xMajorFrameTicks;
+
+            /* The first major frame starts on the next tick. */
+            xTimeTriggeredFrameStart = xTickCount + ( TickType_t ) 1U;
+            uxNextTimeTriggeredSlot = ( UBaseType_t ) 0U;
+            xNextTimeTriggeredRelease = xTimeTriggeredFrameStart + pxSchedule[ 0 ].xOffset;
+
+            /* Set last as the tick interrupt only looks at the schedule once
+             * this is not NULL. */
+            pxTimeTriggeredSchedule = pxSchedule;
+        }
+        taskEXIT_CRITICAL();
+    }
+
+#endif /* configUSE_TIME_TRIGGERED_SCHEDULE */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TIME_TRIGGERED_SCHEDULE == 1 )
+
+    BaseType_t xTaskWaitForSlot( const UBaseType_t uxSlot )
+    {
+        TimeTriggeredSlotState_t * pxSlot;
+        uint32_t ulLatency;
+        BaseType_t xReturn;
+
+        configASSERT( pxTimeTriggeredSchedule );
+        configASSERT( uxSlot < uxTimeTriggeredSlots );
+        configASSERT( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE );
+
+        pxSlot = &( xTimeTriggeredSlotStates[ uxSlot ] );
+
+        taskENTER_CRITICAL();
+        {
+            prvCompleteTimeTriggeredSlots( pxCurrentTCB );
+
+            /* A slot belongs to the first task that waits for it. */
+            configASSERT( ( pxSlot->pxTask == NULL ) || ( pxSlot->pxTask == pxCurrentTCB ) );
+            pxSlot->pxTask = pxCurrentTCB;
+            pxSlot->ucState = taskSLOT_WAITING;
+
+            /* Move the task out of the ready list and into the list of tasks
+             * waiting for a slot, where the tick interrupt will find it. */
+            if( uxListRemove( &( pxCurrentTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+            {
+                portRESET_READY_PRIORITY( pxCurrentTCB->uxPriority, uxTopReadyPriority );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            vListInsertEnd( &xTimeTriggeredWaitingList, &( pxCurrentTCB->xStateListItem ) );
+
+            portYIELD_WITHIN_API();
+        }
+        taskEXIT_CRITICAL();
+
+        /* Read the counter before the critical section so the time taken to
+         * enter it is not counted as release latency. */
+        ulLatency = ( uint32_t ) portGET_CYCLE_COUNTER();
+
+        taskENTER_CRITICAL();
+        {
+            if( pxSlot->ucState == taskSLOT_ACTIVE )
+            {
+                ulLatency -= pxSlot->ulReleaseCycles;
+
+                if( ulLatency < pxSlot->xStats.ulMinReleaseLatency )
+                {
+                    pxSlot->xStats.ulMinReleaseLatency = ulLatency;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                if( ulLatency > pxSlot->xStats.ulMaxReleaseLatency )
+                {
+                    pxSlot->xStats.ulMaxReleaseLatency = ulLatency;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                pxSlot->xStats.ulReleaseJitter = pxSlot->xStats.ulMaxReleaseLatency - pxSlot->xStats.ulMinReleaseLatency;
+                xReturn = pdTRUE;
+            }
+            else
+            {
+                /* The task was not released by the slot.  It was either
+                 * suspended when the slot fell due, or was made ready by
+                 * xTaskAbortDelay() while waiting. */
+                pxSlot->ucState = taskSLOT_IDLE;
+
+                #if ( INCLUDE_xTaskAbortDelay == 1 )
+                {
+                    pxCurrentTCB->ucDelayAborted = pdFALSE;
+                }
+                #endif
 
-            /* Prevent the tick interrupt modifying xPendedTicks simultaneously. */
-            taskENTER_CRITICAL();
-            {
-                xPendedTicks++;
+                xReturn = pdFALSE;
             }
-            taskEXIT_CRITICAL();
-            xTicksToJump--;
-        }
-        else
-        {
-            mtCOVERAGE_TEST_MARKER();
         }
+        taskEXIT_CRITICAL();
 
-        xTickCount += xTicksToJump;
-        traceINCREASE_TICK_COUNT( xTicksToJump );
+        return xReturn;
     }
 
-#endif /* configUSE_TICKLESS_IDLE */
-/*----------------------------------------------------------*/
+#endif /* configUSE_TIME_TRIGGERED_SCHEDULE */
+/*-----------------------------------------------------------*/
 
-BaseType_t xTaskCatchUpTicks( TickType_t xTicksToCatchUp )
-{
-    BaseType_t xYieldOccurred;
+#if ( configUSE_TIME_TRIGGERED_SCHEDULE == 1 )
 
-    /* Must not be called with the scheduler suspended as the implementation
-     * relies on xPendedTicks being wound down to 0 in xTaskResumeAll(). */
-    configASSERT( uxSchedulerSuspended == 0 );
+    void vTaskGetSlotStats( const UBaseType_t uxSlot,
+                            TimeTriggeredSlotStats_t * const pxSlotStats )
+    {
+        configASSERT( pxTimeTriggeredSchedule );
+        configASSERT( uxSlot < uxTimeTriggeredSlots );
+        configASSERT( pxSlotStats );
 
-    /* Use xPendedTicks to mimic xTicksToCatchUp number of ticks occurring when
-     * the scheduler is suspended so the ticks are executed in xTaskResumeAll(). */
-    vTaskSuspendAll();
+        taskENTER_CRITICAL();
+        {
+            *pxSlotStats = xTimeTriggeredSlotStates[ uxSlot ].xStats;
+        }
+        taskEXIT_CRITICAL();
 
-    /* Prevent the tick interrupt modifying xPendedTicks simultaneously. */
-    taskENTER_CRITICAL();
-    {
-        xPendedTicks += xTicksToCatchUp;
+        if( pxSlotStats->ulMinReleaseLatency > pxSlotStats->ulMaxReleaseLatency )
+        {
+            /* No release latency has been measured yet. */
+            pxSlotStats->ulMinReleaseLatency = 0UL;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
     }
-    taskEXIT_CRITICAL();
-    xYieldOccurred = xTaskResumeAll();
 
-    return xYieldOccurred;
-}
-/*----------------------------------------------------------*/
+#endif /* configUSE_TIME_TRIGGERED_SCHEDULE */
+/*-----------------------------------------------------------*/
 
-#if ( INCLUDE_xTaskAbortDelay == 1 )
+#if ( configUSE_TIME_TRIGGERED_SCHEDULE == 1 )
 
-    BaseType_t xTaskAbortDelay( TaskHandle_t xTask )
+    static BaseType_t prvReleaseTimeTriggeredSlots( const TickType_t xConstTickCount )
     {
-        TCB_t * pxTCB = xTask;
-        BaseType_t xReturn;
-
-        configASSERT( pxTCB );
+        TimeTriggeredSlotState_t * pxSlot;
+        TCB_t * pxTCB;
+        const uint32_t ulNow = ( uint32_t ) portGET_CYCLE_COUNTER();
+        BaseType_t xSwitchRequired = pdFALSE;
 
-        vTaskSuspendAll();
+        /* Several slots can share an offset, so keep going until the next slot
+         * is due on a later tick. */
+        while( xConstTickCount == xNextTimeTriggeredRelease )
         {
-            /* A task can only be prematurely removed from the Blocked state if
-             * it is actually in the Blocked state. */
-            if( eTaskGetState( xTask ) == eBlocked )
-            {
-                xReturn = pdPASS;
-
-                /* Remove the reference to the task from the blocked list.  An
-                 * interrupt won't touch the xStateListItem because the
-                 * scheduler is suspended. */
-                ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
-
-                /* Is the task waiting on an event also?  If so remove it from
-                 * the event list too.  Interrupts can touch the event list item,
-                 * even though the scheduler is suspended, so a critical section
-                 * is used. */
-                taskENTER_CRITICAL();
-                {
-                    if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
-                    {
-                        ( void ) uxListRemove( &( pxTCB->xEventListItem ) );
-
-                        /* This lets the task know it was forcibly removed from the
-                         * blocked state so it should not re-evaluate its block time and
-                         * then block again. */
-                        pxTCB->ucDelayAborted = pdTRUE;
-                    }
-                    else
-                    {
-                        mtCOVERAGE_TEST_MARKER();
-                    }
-                }
-                taskEXIT_CRITICAL();
+            pxSlot = &( xTimeTriggeredSlotStates[ uxNextTimeTriggeredSlot ] );
+            pxTCB = pxSlot->pxTask;
 
-                /* Place the unblocked task into the appropriate ready list. */
+            if( ( pxSlot->ucState == taskSLOT_WAITING ) && ( listLIST_ITEM_CONTAINER( &( pxTCB->xStateListItem ) ) == &xTimeTriggeredWaitingList ) )
+            {
+                listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
                 prvAddTaskToReadyList( pxTCB );
 
-                /* A task being unblocked cannot cause an immediate context
-                 * switch if preemption is turned off. */
+                pxSlot->ucState = taskSLOT_ACTIVE;
+                pxSlot->xReleaseTick = xConstTickCount;
+                pxSlot->ulReleaseCycles = ulNow;
+                ( pxSlot->xStats.ulReleases )++;
+
                 #if ( configUSE_PREEMPTION == 1 )
                 {
-                    /* Preemption is on, but a context switch should only be
-                     * performed if the unblocked task has a priority that is
-                     * higher than the currently executing task. */
                     if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
                     {
-                        /* Pend the yield to be performed when the scheduler
-                         * is unsuspended. */
-                        xYieldPending = pdTRUE;
+                        xSwitchRequired = pdTRUE;
                     }
                     else
                     {
@@ -2704,380 +5342,665 @@ BaseType_t xTaskCatchUpTicks( TickType_t xTicksToCatchUp )
                 }
                 #endif /* configUSE_PREEMPTION */
             }
+            else if( pxTCB != NULL )
+            {
+                /* The task that owns the slot is still running an earlier
+                 * slot, or was suspended while waiting for this one. */
+                ( pxSlot->xStats.ulMissedReleases )++;
+
+                if( pxSlot->ucState == taskSLOT_WAITING )
+                {
+                    pxSlot->ucState = taskSLOT_IDLE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
             else
             {
-                xReturn = pdFAIL;
+                /* No task has waited for the slot yet. */
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            uxNextTimeTriggeredSlot++;
+
+            if( uxNextTimeTriggeredSlot >= uxTimeTriggeredSlots )
+            {
+                uxNextTimeTriggeredSlot = ( UBaseType_t ) 0U;
+                xTimeTriggeredFrameStart += xTimeTriggeredMajorFrame;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
             }
+
+            xNextTimeTriggeredRelease = xTimeTriggeredFrameStart + pxTimeTriggeredSchedule[ uxNextTimeTriggeredSlot ].xOffset;
         }
-        ( void ) xTaskResumeAll();
 
-        return xReturn;
+        return xSwitchRequired;
     }
 
-#endif /* INCLUDE_xTaskAbortDelay */
-/*----------------------------------------------------------*/
+#endif /* configUSE_TIME_TRIGGERED_SCHEDULE */
+/*-----------------------------------------------------------*/
 
-BaseType_t xTaskIncrementTick( void )
-{
-    TCB_t * pxTCB;
-    TickType_t xItemValue;
-    BaseType_t xSwitchRequired = pdFALSE;
+#if ( configUSE_TIME_TRIGGERED_SCHEDULE == 1 )
 
-    /* Called by the portable layer each time a tick interrupt occurs.
-     * Increments the tick then checks to see if the new tick value will cause any
-     * tasks to be unblocked. */
-    traceTASK_INCREMENT_TICK( xTickCount );
+    static void prvCompleteTimeTriggeredSlots( const TCB_t * const pxTCB )
+    {
+        UBaseType_t uxSlot;
+        TimeTriggeredSlotState_t * pxSlot;
+        TickType_t xBudget;
 
-    if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+        for( uxSlot = ( UBaseType_t ) 0U; uxSlot < uxTimeTriggeredSlots; uxSlot++ )
+        {
+            pxSlot = &( xTimeTriggeredSlotStates[ uxSlot ] );
+
+            if( ( pxSlot->pxTask == pxTCB ) && ( pxSlot->ucState == taskSLOT_ACTIVE ) )
+            {
+                xBudget = pxTimeTriggeredSchedule[ uxSlot ].xBudget;
+
+                if( ( xBudget > ( TickType_t ) 0U ) && ( ( TickType_t ) ( xTickCount - pxSlot->xReleaseTick ) > xBudget ) )
+                {
+                    ( pxSlot->xStats.ulOverruns )++;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                pxSlot->ucState = taskSLOT_IDLE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+    }
+
+#endif /* configUSE_TIME_TRIGGERED_SCHEDULE */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TIME_PARTITIONS == 1 )
+
+    void vTaskStartPartitionSchedule( const PartitionWindow_t * const pxWindows,
+                                      const UBaseType_t uxWindows )
     {
-        /* Minor optimisation.  The tick count cannot change in this
-         * block. */
-        const TickType_t xConstTickCount = xTickCount + ( TickType_t ) 1;
+        UBaseType_t uxWindow;
 
-        /* Increment the RTOS tick, switching the delayed and overflowed
-         * delayed lists if it wraps to 0. */
-        xTickCount = xConstTickCount;
+        configASSERT( pxWindows );
+        configASSERT( uxWindows > ( UBaseType_t ) 0U );
 
-        if( xConstTickCount == ( TickType_t ) 0U ) /*lint !e774 'if' does not always evaluate to false as it is looking for an overflow. */
+        for( uxWindow = ( UBaseType_t ) 0U; uxWindow < uxWindows; uxWindow++ )
         {
-            taskSWITCH_DELAYED_LISTS();
+            configASSERT( pxWindows[ uxWindow ].uxPartition < ( UBaseType_t ) configNUM_PARTITIONS );
+            configASSERT( pxWindows[ uxWindow ].xDuration > ( TickType_t ) 0U );
         }
-        else
+
+        taskENTER_CRITICAL();
         {
-            mtCOVERAGE_TEST_MARKER();
+            /* The partition schedule can only be started once. */
+            configASSERT( pxPartitionWindows == NULL );
+
+            for( uxWindow = ( UBaseType_t ) 0U; uxWindow < ( UBaseType_t ) configNUM_PARTITIONS; uxWindow++ )
+            {
+                xPartitionStats[ uxWindow ].ulWindowTicks = 0UL;
+                xPartitionStats[ uxWindow ].ulRunTicks = 0UL;
+                xPartitionStats[ uxWindow ].ulSlackTicks = 0UL;
+            }
+
+            pxPartitionWindows = pxWindows;
+            uxPartitionWindows = uxWindows;
+            uxCurrentPartitionWindow = ( UBaseType_t ) 0U;
+            xPartitionWindowTicksLeft = pxWindows[ 0 ].xDuration;
+            uxActivePartition = pxWindows[ 0 ].uxPartition;
+
+            /* The running task might not belong to the first window. */
+            if( xSchedulerRunning != pdFALSE )
+            {
+                taskYIELD_IF_USING_PREEMPTION();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
         }
+        taskEXIT_CRITICAL();
+    }
 
-        /* See if this tick has made a timeout expire.  Tasks are stored in
-         * the  queue in the order of their wake time - meaning once one task
-         * has been found whose block time has not expired there is no need to
-         * look any further down the list. */
-        if( xConstTickCount >= xNextTaskUnblockTime )
+#endif /* configUSE_TIME_PARTITIONS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TIME_PARTITIONS == 1 )
+
+    void vTaskSetPartition( TaskHandle_t xTask,
+                            UBaseType_t uxPartition )
+    {
+        TCB_t * pxTCB;
+
+        configASSERT( uxPartition < ( UBaseType_t ) configNUM_PARTITIONS );
+
+        taskENTER_CRITICAL();
         {
-            for( ; ; )
+            /* If null is passed in here then it is the calling task that is
+             * being moved. */
+            pxTCB = prvGetTCBFromHandle( xTask );
+
+            /* The idle task must always be selectable. */
+            configASSERT( ( pxTCB != xIdleTaskHandle ) || ( uxPartition == ( UBaseType_t ) 0U ) );
+
+            pxTCB->uxPartition = uxPartition;
+
+            /* The move can change which task should be running. */
+            if( xSchedulerRunning != pdFALSE )
             {
-                if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
-                {
-                    /* The delayed list is empty.  Set xNextTaskUnblockTime
-                     * to the maximum possible value so it is extremely
-                     * unlikely that the
-                     * if( xTickCount >= xNextTaskUnblockTime ) test will pass
-                     * next time through. */
-                    xNextTaskUnblockTime = portMAX_DELAY; /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
-                    break;
-                }
-                else
-                {
-                    /* The delayed list is not empty, get the value of the
-                     * item at the head of the delayed list.  This is the time
-                     * at which the task at the head of the delayed list must
-                     * be removed from the Blocked state. */
-                    pxTCB = listGET_OWNER_OF_HEAD_ENTRY( pxDelayedTaskList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
-                    xItemValue = listGET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ) );
+                taskYIELD_IF_USING_PREEMPTION();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+    }
+
+#endif /* configUSE_TIME_PARTITIONS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TIME_PARTITIONS == 1 )
+
+    UBaseType_t uxTaskGetPartition( TaskHandle_t xTask )
+    {
+        TCB_t const * pxTCB;
+        UBaseType_t uxReturn;
+
+        taskENTER_CRITICAL();
+        {
+            /* If null is passed in here then it is the partition of the
+             * calling task that is being queried. */
+            pxTCB = prvGetTCBFromHandle( xTask );
+            uxReturn = pxTCB->uxPartition;
+        }
+        taskEXIT_CRITICAL();
+
+        return uxReturn;
+    }
+
+#endif /* configUSE_TIME_PARTITIONS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TIME_PARTITIONS == 1 )
+
+    void vTaskGetPartitionStats( UBaseType_t uxPartition,
+                                 PartitionStats_t * const pxPartitionStats )
+    {
+        configASSERT( uxPartition < ( UBaseType_t ) configNUM_PARTITIONS );
+        configASSERT( pxPartitionStats );
+
+        taskENTER_CRITICAL();
+        {
+            *pxPartitionStats = xPartitionStats[ uxPartition ];
+        }
+        taskEXIT_CRITICAL();
+    }
 
-                    if( xConstTickCount < xItemValue )
-                    {
-                        /* It is not time to unblock this item yet, but the
-                         * item value is the time at which the task at the head
-                         * of the blocked list must be removed from the Blocked
-                         * state -  so record the item value in
-                         * xNextTaskUnblockTime. */
-                        xNextTaskUnblockTime = xItemValue;
-                        break; /*lint !e9011 Code structure here is deemed easier to understand with multiple breaks. */
-                    }
-                    else
-                    {
-                        mtCOVERAGE_TEST_MARKER();
-                    }
+#endif /* configUSE_TIME_PARTITIONS */
+/*-----------------------------------------------------------*/
 
-                    /* It is time to remove the item from the Blocked state. */
-                    listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
+#if ( configUSE_TIME_PARTITIONS == 1 )
 
-                    /* Is the task waiting on an event also?  If so remove
-                     * it from the event list. */
-                    if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+    static void prvSelectPartitionTask( void )
+    {
+        List_t * pxList;
+        TCB_t * pxTCB;
+        TCB_t * pxSelectedTCB = NULL;
+        UBaseType_t uxPartition = uxActivePartition;
+        UBaseType_t uxPriority, uxEntries;
+
+        /* Look for a ready task of the window's partition first, then reclaim
+         * the window's slack for the background partition.  The idle task is
+         * in the background partition, so the second search always succeeds.
+         * No ready task has a priority above that of the task chosen by
+         * taskSELECT_HIGHEST_PRIORITY_TASK(). */
+        for( ; ; )
+        {
+            uxPriority = pxCurrentTCB->uxPriority + ( UBaseType_t ) 1U;
+
+            do
+            {
+                uxPriority--;
+                pxList = &( pxReadyTasksLists[ uxPriority ] );
+
+                /* Indexing through the list keeps the round robin order
+                 * between the partition's tasks of equal priority. */
+                for( uxEntries = listCURRENT_LIST_LENGTH( pxList ); uxEntries > ( UBaseType_t ) 0U; uxEntries-- )
+                {
+                    listGET_OWNER_OF_NEXT_ENTRY( pxTCB, pxList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+                    if( pxTCB->uxPartition == uxPartition )
                     {
-                        listREMOVE_ITEM( &( pxTCB->xEventListItem ) );
+                        pxSelectedTCB = pxTCB;
+                        break;
                     }
                     else
                     {
                         mtCOVERAGE_TEST_MARKER();
                     }
-
-                    /* Place the unblocked task into the appropriate ready
-                     * list. */
-                    prvAddTaskToReadyList( pxTCB );
-
-                    /* A task being unblocked cannot cause an immediate
-                     * context switch if preemption is turned off. */
-                    #if ( configUSE_PREEMPTION == 1 )
-                    {
-                        /* Preemption is on, but a context switch should
-                         * only be performed if the unblocked task's
-                         * priority is higher than the currently executing
-                         * task.
-                         * The case of equal priority tasks sharing
-                         * processing time (which happens when both
-                         * preemption and time slicing are on) is
-                         * handled below.*/
-                        if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
-                        {
-                            xSwitchRequired = pdTRUE;
-                        }
-                        else
-                        {
-                            mtCOVERAGE_TEST_MARKER();
-                        }
-                    }
-                    #endif /* configUSE_PREEMPTION */
                 }
-            }
-        }
+            } while( ( pxSelectedTCB == NULL ) && ( uxPriority > tskIDLE_PRIORITY ) );
 
-        /* Tasks of equal priority to the currently running task will share
-         * processing time (time slice) if preemption is on, and the application
-         * writer has not explicitly turned time slicing off. */
-        #if ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) )
-        {
-            if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ) ) > ( UBaseType_t ) 1 )
+            if( ( pxSelectedTCB != NULL ) || ( uxPartition == ( UBaseType_t ) 0U ) )
             {
-                xSwitchRequired = pdTRUE;
+                break;
             }
             else
             {
-                mtCOVERAGE_TEST_MARKER();
+                uxPartition = ( UBaseType_t ) 0U;
             }
         }
-        #endif /* ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) ) */
 
-        #if ( configUSE_TICK_HOOK == 1 )
+        configASSERT( pxSelectedTCB );
+        pxCurrentTCB = pxSelectedTCB;
+    }
+
+#endif /* configUSE_TIME_PARTITIONS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TIME_PARTITIONS == 1 )
+
+    static BaseType_t prvUpdatePartitionWindow( void )
+    {
+        BaseType_t xReturn = pdFALSE;
+
+        /* Charge the tick that has just ended to the open window and to the
+         * partition of the task that was running through it. */
+        ( xPartitionStats[ uxActivePartition ].ulWindowTicks )++;
+
+        if( pxCurrentTCB != xIdleTaskHandle )
         {
-            /* Guard against the tick hook being called when the pended tick
-             * count is being unwound (when the scheduler is being unlocked). */
-            if( xPendedTicks == ( TickType_t ) 0 )
-            {
-                vApplicationTickHook();
-            }
-            else
-            {
-                mtCOVERAGE_TEST_MARKER();
-            }
+            ( xPartitionStats[ pxCurrentTCB->uxPartition ].ulRunTicks )++;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
         }
-        #endif /* configUSE_TICK_HOOK */
 
-        #if ( configUSE_PREEMPTION == 1 )
+        if( pxCurrentTCB->uxPartition != uxActivePartition )
         {
-            if( xYieldPending != pdFALSE )
+            ( xPartitionStats[ uxActivePartition ].ulSlackTicks )++;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        xPartitionWindowTicksLeft--;
+
+        if( xPartitionWindowTicksLeft == ( TickType_t ) 0U )
+        {
+            uxCurrentPartitionWindow++;
+
+            if( uxCurrentPartitionWindow >= uxPartitionWindows )
             {
-                xSwitchRequired = pdTRUE;
+                uxCurrentPartitionWindow = ( UBaseType_t ) 0U;
             }
             else
             {
                 mtCOVERAGE_TEST_MARKER();
             }
-        }
-        #endif /* configUSE_PREEMPTION */
-    }
-    else
-    {
-        ++xPendedTicks;
 
-        /* The tick hook gets called at regular intervals, even if the
-         * scheduler is locked. */
-        #if ( configUSE_TICK_HOOK == 1 )
+            xPartitionWindowTicksLeft = pxPartitionWindows[ uxCurrentPartitionWindow ].xDuration;
+            uxActivePartition = pxPartitionWindows[ uxCurrentPartitionWindow ].uxPartition;
+            xReturn = pdTRUE;
+        }
+        else
         {
-            vApplicationTickHook();
+            mtCOVERAGE_TEST_MARKER();
         }
-        #endif
+
+        return xReturn;
     }
 
-    return xSwitchRequired;
-}
+#endif /* configUSE_TIME_PARTITIONS */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+#if ( configUSE_RCU == 1 )
 
-    void vTaskSetApplicationTaskTag( TaskHandle_t xTask,
-                                     TaskHookFunction_t pxHookFunction )
+    void vTaskRcuReadLock( void )
     {
-        TCB_t * xTCB;
+        /* Interrupts can use read-side critical sections too.  They nest
+         * inside the section, if any, of the task they interrupt, and are left
+         * before that task can be switched out. */
+        ( pxCurrentTCB->uxRcuReadNesting )++;
+
+        /* Accesses to the protected data must not be moved in front of the
+         * lock. */
+        portMEMORY_BARRIER();
+    }
 
-        /* If xTask is NULL then it is the task hook of the calling task that is
-         * getting set. */
-        if( xTask == NULL )
+#endif /* configUSE_RCU */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_RCU == 1 )
+
+    void vTaskRcuReadUnlock( void )
+    {
+        TCB_t * const pxTCB = pxCurrentTCB;
+        UBaseType_t uxSavedInterruptStatus;
+
+        /* Accesses to the protected data must not be moved past the unlock. */
+        portMEMORY_BARRIER();
+
+        configASSERT( pxTCB->uxRcuReadNesting > ( UBaseType_t ) 0U );
+        ( pxTCB->uxRcuReadNesting )--;
+
+        /* Shared state is only written if the task was switched out inside the
+         * section, in which case a grace period may be waiting for it.  The
+         * nesting count reaches zero before the flag is read, so the flag
+         * cannot be set after this test has been made. */
+        if( ( pxTCB->uxRcuReadNesting == ( UBaseType_t ) 0U ) && ( pxTCB->ucRcuPreemptedPhase != taskRCU_NOT_PREEMPTED ) )
         {
-            xTCB = ( TCB_t * ) pxCurrentTCB;
+            /* Can be called from an interrupt that nests inside a section of
+             * the interrupted task. */
+            uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+            {
+                if( pxTCB->ucRcuPreemptedPhase != taskRCU_NOT_PREEMPTED )
+                {
+                    uxRcuPreemptedReaders[ pxTCB->ucRcuPreemptedPhase ]--;
+                    pxTCB->ucRcuPreemptedPhase = taskRCU_NOT_PREEMPTED;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
         }
         else
         {
-            xTCB = xTask;
+            mtCOVERAGE_TEST_MARKER();
         }
+    }
+
+#endif /* configUSE_RCU */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_RCU == 1 )
+
+    UBaseType_t uxTaskRcuStartGracePeriod( void )
+    {
+        UBaseType_t uxPhase;
 
-        /* Save the hook function in the TCB.  A critical section is required as
-         * the value can be accessed from an interrupt. */
         taskENTER_CRITICAL();
         {
-            xTCB->pxTaskTag = pxHookFunction;
+            uxPhase = uxRcuPhase;
+
+            /* Grace periods are run one at a time, so every reader counted
+             * against the other phase has already left its section. */
+            configASSERT( uxRcuPreemptedReaders[ uxPhase ^ ( UBaseType_t ) 1U ] == ( UBaseType_t ) 0U );
+
+            /* Readers switched out from now on hold up the next grace period
+             * rather than this one. */
+            uxRcuPhase = uxPhase ^ ( UBaseType_t ) 1U;
         }
         taskEXIT_CRITICAL();
+
+        return uxPhase;
     }
 
-#endif /* configUSE_APPLICATION_TASK_TAG */
+#endif /* configUSE_RCU */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+#if ( configUSE_RCU == 1 )
 
-    TaskHookFunction_t xTaskGetApplicationTaskTag( TaskHandle_t xTask )
+    BaseType_t xTaskRcuGracePeriodElapsed( UBaseType_t uxPhase )
     {
-        TCB_t * pxTCB;
-        TaskHookFunction_t xReturn;
+        BaseType_t xReturn;
 
-        /* If xTask is NULL then set the calling task's hook. */
-        pxTCB = prvGetTCBFromHandle( xTask );
+        configASSERT( uxPhase <= ( UBaseType_t ) 1U );
 
-        /* Save the hook function in the TCB.  A critical section is required as
-         * the value can be accessed from an interrupt. */
-        taskENTER_CRITICAL();
+        if( uxRcuPreemptedReaders[ uxPhase ] == ( UBaseType_t ) 0U )
         {
-            xReturn = pxTCB->pxTaskTag;
+            xReturn = pdTRUE;
+        }
+        else
+        {
+            xReturn = pdFALSE;
         }
-        taskEXIT_CRITICAL();
 
         return xReturn;
     }
 
-#endif /* configUSE_APPLICATION_TASK_TAG */
+#endif /* configUSE_RCU */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+#if ( configUSE_STACK_TIERING == 1 )
 
-    TaskHookFunction_t xTaskGetApplicationTaskTagFromISR( TaskHandle_t xTask )
+    BaseType_t xTaskEnableStackTiering( TaskHandle_t xTask,
+                                        configSTACK_DEPTH_TYPE uxStackDepth )
     {
-        TCB_t * pxTCB;
-        TaskHookFunction_t xReturn;
-        UBaseType_t uxSavedInterruptStatus;
+        TCB_t * const pxTCB = xTask;
+        StackTierSlot_t * pxSlot;
+        StackType_t * pxSlotStack;
+        UBaseType_t uxSlot, uxChosenSlot = ( UBaseType_t ) 0U;
+        size_t xOffset;
+        BaseType_t xReturn = pdFAIL;
+
+        /* The stack of a task that has already run might hold pointers to
+         * itself, so cannot be moved. */
+        configASSERT( pxTCB );
+        configASSERT( ( pxTCB != pxCurrentTCB ) || ( xSchedulerRunning == pdFALSE ) );
 
-        /* If xTask is NULL then set the calling task's hook. */
-        pxTCB = prvGetTCBFromHandle( xTask );
+        #if ( configRECORD_STACK_HIGH_ADDRESS == 1 )
+        {
+            configASSERT( pxTCB->pxEndOfStack == &( pxTCB->pxStack[ uxStackDepth - ( configSTACK_DEPTH_TYPE ) 1 ] ) );
+        }
+        #endif
 
-        /* Save the hook function in the TCB.  A critical section is required as
-         * the value can be accessed from an interrupt. */
-        uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+        taskENTER_CRITICAL();
         {
-            xReturn = pxTCB->pxTaskTag;
+            /* The stack keeps its alignment when it is moved to the start of a
+             * slot only if it was aligned to portBYTE_ALIGNMENT to begin with. */
+            if( ( uxStackDepth <= ( configSTACK_DEPTH_TYPE ) configSTACK_TIER_SLOT_DEPTH ) &&
+                ( pxTCB->pxStackBackingStore == NULL ) &&
+                ( ( ( portPOINTER_SIZE_TYPE ) pxTCB->pxStack & ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) == 0UL ) )
+            {
+                for( uxSlot = ( UBaseType_t ) 1U; uxSlot < ( UBaseType_t ) configSTACK_TIER_SLOTS; uxSlot++ )
+                {
+                    if( xStackTierSlots[ uxSlot ].uxTasks < xStackTierSlots[ uxChosenSlot ].uxTasks )
+                    {
+                        uxChosenSlot = uxSlot;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+
+                pxSlot = &( xStackTierSlots[ uxChosenSlot ] );
+                pxSlotStack = uxStackTierSlotStacks[ uxChosenSlot ];
+                xOffset = ( size_t ) ( pxTCB->pxTopOfStack - pxTCB->pxStack );
+
+                /* These are the only pointers to the stack that need fixing up,
+                 * as the task has not run yet. */
+                pxTCB->pxStackBackingStore = pxTCB->pxStack;
+                pxTCB->pxStack = pxSlotStack;
+                pxTCB->pxTopOfStack = &( pxSlotStack[ xOffset ] );
+
+                #if ( configRECORD_STACK_HIGH_ADDRESS == 1 )
+                {
+                    pxTCB->pxEndOfStack = &( pxSlotStack[ uxStackDepth - ( configSTACK_DEPTH_TYPE ) 1 ] );
+                }
+                #endif
+
+                pxTCB->xStackTierLastRun = xTickCount;
+                pxTCB->uxStackTierSlot = uxChosenSlot;
+                pxTCB->uxStackTierDepth = uxStackDepth;
+                ( pxSlot->uxTasks )++;
+
+                /* The initial stack frame is in the backing store already.
+                 * Also place it in the slot if the slot is free. */
+                if( pxSlot->pxResident == NULL )
+                {
+                    prvCopyTieredStack( pxTCB, pdTRUE );
+                    pxSlot->pxResident = pxTCB;
+                    pxSlot->xDirty = pdFALSE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                xReturn = pdPASS;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
         }
-        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+        taskEXIT_CRITICAL();
 
         return xReturn;
     }
 
-#endif /* configUSE_APPLICATION_TASK_TAG */
+#endif /* configUSE_STACK_TIERING */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+#if ( configUSE_STACK_TIERING == 1 )
 
-    BaseType_t xTaskCallApplicationTaskHook( TaskHandle_t xTask,
-                                             void * pvParameter )
+    void vTaskGetStackTierStats( StackTierStats_t * const pxStackTierStats )
     {
-        TCB_t * xTCB;
-        BaseType_t xReturn;
+        configASSERT( pxStackTierStats );
 
-        /* If xTask is NULL then we are calling our own task hook. */
-        if( xTask == NULL )
-        {
-            xTCB = pxCurrentTCB;
-        }
-        else
+        taskENTER_CRITICAL();
         {
-            xTCB = xTask;
+            *pxStackTierStats = xStackTierStats;
         }
+        taskEXIT_CRITICAL();
+    }
 
-        if( xTCB->pxTaskTag != NULL )
+#endif /* configUSE_STACK_TIERING */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_STACK_TIERING == 1 )
+
+    static void prvCopyTieredStack( const TCB_t * const pxTCB,
+                                    const BaseType_t xToSlot )
+    {
+        /* Only the part of the stack above the saved stack pointer is in use.
+         * It is at the same offset in the slot and in the backing store. */
+        const size_t xOffset = ( size_t ) ( pxTCB->pxTopOfStack - pxTCB->pxStack );
+        const size_t xBytes = ( ( size_t ) pxTCB->uxStackTierDepth - xOffset ) * sizeof( StackType_t );
+
+        if( xToSlot != pdFALSE )
         {
-            xReturn = xTCB->pxTaskTag( pvParameter );
+            portMEMCPY( ( void * ) &( pxTCB->pxStack[ xOffset ] ), ( const void * ) &( pxTCB->pxStackBackingStore[ xOffset ] ), xBytes );
+
+            #if ( configCHECK_FOR_STACK_OVERFLOW > 1 )
+            {
+                /* The bottom of the slot holds whatever the previous resident
+                 * left there, so restore the four words the overflow check
+                 * looks at. */
+                portMEMSET( ( void * ) pxTCB->pxStack, ( int ) tskSTACK_FILL_BYTE, 4U * sizeof( uint32_t ) );
+            }
+            #endif
         }
         else
         {
-            xReturn = pdFAIL;
+            portMEMCPY( ( void * ) &( pxTCB->pxStackBackingStore[ xOffset ] ), ( const void * ) &( pxTCB->pxStack[ xOffset ] ), xBytes );
         }
-
-        return xReturn;
     }
 
-#endif /* configUSE_APPLICATION_TASK_TAG */
+#endif /* configUSE_STACK_TIERING */
 /*-----------------------------------------------------------*/
 
-void vTaskSwitchContext( void )
-{
-    if( uxSchedulerSuspended != ( UBaseType_t ) pdFALSE )
-    {
-        /* The scheduler is currently suspended - do not allow a context
-         * switch. */
-        xYieldPending = pdTRUE;
-    }
-    else
+#if ( configUSE_STACK_TIERING == 1 )
+
+    static void prvLoadTieredStack( TCB_t * const pxTCB )
     {
-        xYieldPending = pdFALSE;
-        traceTASK_SWITCHED_OUT();
+        StackTierSlot_t * const pxSlot = &( xStackTierSlots[ pxTCB->uxStackTierSlot ] );
 
-        #if ( configGENERATE_RUN_TIME_STATS == 1 )
+        if( pxSlot->pxResident != pxTCB )
         {
-            #ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
-                portALT_GET_RUN_TIME_COUNTER_VALUE( ulTotalRunTime );
-            #else
-                ulTotalRunTime = portGET_RUN_TIME_COUNTER_VALUE();
-            #endif
-
-            /* Add the amount of time the task has been running to the
-             * accumulated time so far.  The time the task started running was
-             * stored in ulTaskSwitchedInTime.  Note that there is no overflow
-             * protection here so count values are only valid until the timer
-             * overflows.  The guard against negative values is to protect
-             * against suspect run time stat counter implementations - which
-             * are provided by the application, not the kernel. */
-            if( ulTotalRunTime > ulTaskSwitchedInTime )
+            if( ( pxSlot->pxResident != NULL ) && ( pxSlot->xDirty != pdFALSE ) )
             {
-                pxCurrentTCB->ulRunTimeCounter += ( ulTotalRunTime - ulTaskSwitchedInTime );
+                prvCopyTieredStack( pxSlot->pxResident, pdFALSE );
+                ( xStackTierStats.ulEvictions )++;
             }
             else
             {
                 mtCOVERAGE_TEST_MARKER();
             }
 
-            ulTaskSwitchedInTime = ulTotalRunTime;
+            prvCopyTieredStack( pxTCB, pdTRUE );
+            pxSlot->pxResident = pxTCB;
+            ( xStackTierStats.ulLoads )++;
         }
-        #endif /* configGENERATE_RUN_TIME_STATS */
-
-        /* Check for stack overflow, if configured. */
-        taskCHECK_FOR_STACK_OVERFLOW();
-
-        /* Before the currently running task is switched out, save its errno. */
-        #if ( configUSE_POSIX_ERRNO == 1 )
+        else
         {
-            pxCurrentTCB->iTaskErrno = FreeRTOS_errno;
+            mtCOVERAGE_TEST_MARKER();
         }
-        #endif
 
-        /* Select a new task to run using either the generic C or port
-         * optimised asm code. */
-        taskSELECT_HIGHEST_PRIORITY_TASK(); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
-        traceTASK_SWITCHED_IN();
+        /* The stack in the slot is about to change. */
+        pxSlot->xDirty = pdTRUE;
+    }
 
-        /* After the new task is switched in, update the global errno. */
-        #if ( configUSE_POSIX_ERRNO == 1 )
-        {
-            FreeRTOS_errno = pxCurrentTCB->iTaskErrno;
-        }
-        #endif
+#endif /* configUSE_STACK_TIERING */
+/*-----------------------------------------------------------*/
 
-        #if ( ( configUSE_NEWLIB_REENTRANT == 1 ) || ( configUSE_C_RUNTIME_TLS_SUPPORT == 1 ) )
+#if ( configUSE_STACK_TIERING == 1 )
+
+    /* True if the stack in the slot has changed since it was last written back and
+     * its task has not run for configSTACK_TIER_WRITE_BACK_TICKS.  Resident TCBs are
+     * only freed by the idle task, so the resident can be read safely. */
+    #define taskSTACK_TIER_WRITE_BACK_DUE( pxSlot, pxTCB )                                                  \
+        ( ( ( pxSlot )->xDirty != pdFALSE ) &&                                                                  \
+          ( ( pxTCB ) != NULL ) &&                                                                              \
+          ( ( pxTCB ) != pxCurrentTCB ) &&                                                                      \
+          ( ( TickType_t ) ( xTickCount - ( pxTCB )->xStackTierLastRun ) >= ( TickType_t ) configSTACK_TIER_WRITE_BACK_TICKS ) )
+
+    static void prvWriteBackTieredStacks( void )
+    {
+        UBaseType_t uxSlot;
+        StackTierSlot_t * pxSlot;
+        TCB_t * pxTCB;
+
+        for( uxSlot = ( UBaseType_t ) 0U; uxSlot < ( UBaseType_t ) configSTACK_TIER_SLOTS; uxSlot++ )
         {
-            /* Switch C-Runtime's TLS Block to point to the TLS
-             * Block specific to this task. */
-            configSET_TLS_BLOCK( pxCurrentTCB->xTLSBlock );
+            pxSlot = &( xStackTierSlots[ uxSlot ] );
+
+            /* Check without suspending the scheduler first, as most of the
+             * time there is nothing to do. */
+            if( taskSTACK_TIER_WRITE_BACK_DUE( pxSlot, pxSlot->pxResident ) )
+            {
+                /* Stop the resident being switched in, or another task being
+                 * loaded into the slot, while the stack is copied.  Interrupts
+                 * remain enabled as nothing else may access the stack. */
+                vTaskSuspendAll();
+                {
+                    pxTCB = pxSlot->pxResident;
+
+                    if( taskSTACK_TIER_WRITE_BACK_DUE( pxSlot, pxTCB ) )
+                    {
+                        prvCopyTieredStack( pxTCB, pdFALSE );
+                        pxSlot->xDirty = pdFALSE;
+                        ( xStackTierStats.ulWriteBacks )++;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                ( void ) xTaskResumeAll();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
         }
-        #endif
     }
-}
+
+#endif /* configUSE_STACK_TIERING */
 /*-----------------------------------------------------------*/
 
 void vTaskPlaceOnEventList( List_t * const pxEventList,
@@ -3288,6 +6211,7 @@ void vTaskSetTimeOutState( TimeOut_t * const pxTimeOut )
     configASSERT( pxTimeOut );
     taskENTER_CRITICAL();
     {
+        taskEXIT_ADAPTIVE_TICK();
         pxTimeOut->xOverflowCount = xNumOfOverflows;
         pxTimeOut->xTimeOnEntering = xTickCount;
     }
@@ -3298,6 +6222,7 @@ void vTaskSetTimeOutState( TimeOut_t * const pxTimeOut )
 void vTaskInternalSetTimeOutState( TimeOut_t * const pxTimeOut )
 {
     /* For internal use only as it does not use a critical section. */
+    taskEXIT_ADAPTIVE_TICK();
     pxTimeOut->xOverflowCount = xNumOfOverflows;
     pxTimeOut->xTimeOnEntering = xTickCount;
 }
@@ -3313,9 +6238,14 @@ BaseType_t xTaskCheckForTimeOut( TimeOut_t * const pxTimeOut,
 
     taskENTER_CRITICAL();
     {
+        TickType_t xConstTickCount;
+        TickType_t xElapsedTime;
+
+        taskEXIT_ADAPTIVE_TICK();
+
         /* Minor optimisation.  The tick count cannot change in this block. */
-        const TickType_t xConstTickCount = xTickCount;
-        const TickType_t xElapsedTime = xConstTickCount - pxTimeOut->xTimeOnEntering;
+        xConstTickCount = xTickCount;
+        xElapsedTime = xConstTickCount - pxTimeOut->xTimeOnEntering;
 
         #if ( INCLUDE_xTaskAbortDelay == 1 )
             if( pxCurrentTCB->ucDelayAborted != ( uint8_t ) pdFALSE )
@@ -3443,6 +6373,19 @@ static portTASK_FUNCTION( prvIdleTask, pvParameters )
          * is responsible for freeing the deleted task's TCB and stack. */
         prvCheckTasksWaitingTermination();
 
+        #if ( configUSE_STACK_TIERING == 1 )
+        {
+            prvWriteBackTieredStacks();
+        }
+        #endif
+
+        #if ( configUSE_HEAP_DEFERRED_FREE == 1 )
+        {
+            /* Return blocks freed from interrupts to the heap. */
+            vPortFreeDeferredBlocks();
+        }
+        #endif
+
         #if ( configUSE_PREEMPTION == 0 )
         {
             /* If we are not using preemption we keep forcing a task switch to
@@ -3571,6 +6514,15 @@ static portTASK_FUNCTION( prvIdleTask, pvParameters )
             eReturn = eAbortSleep;
         }
 
+        #if ( configUSE_DEFERRED_TICK_PROCESSING == 1 )
+            else if( xDeferredTicks != 0 )
+            {
+                /* A tick interrupt has occurred but has not been processed
+                 * yet. */
+                eReturn = eAbortSleep;
+            }
+        #endif /* configUSE_DEFERRED_TICK_PROCESSING */
+
         #if ( INCLUDE_vTaskSuspend == 1 )
             else if( listCURRENT_LIST_LENGTH( &xSuspendedTaskList ) == ( uxCurrentNumberOfTasks - uxNonApplicationTasks ) )
             {
@@ -3679,6 +6631,12 @@ static void prvInitialiseTaskLists( void )
     }
     #endif /* INCLUDE_vTaskSuspend */
 
+    #if ( configUSE_TIME_TRIGGERED_SCHEDULE == 1 )
+    {
+        vListInitialise( &xTimeTriggeredWaitingList );
+    }
+    #endif
+
     /* Start with pxDelayedTaskList using list1 and the pxOverflowDelayedTaskList
      * using list2. */
     pxDelayedTaskList = &xDelayedTaskList1;
@@ -3838,6 +6796,17 @@ static void prvCheckTasksWaitingTermination( void )
             do
             {
                 listGET_OWNER_OF_NEXT_ENTRY( pxNextTCB, pxList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+                /* Deadline timers in the delayed lists are not tasks. */
+                if( taskIS_DEADLINE_TIMER( pxNextTCB ) )
+                {
+                    continue;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
                 vTaskGetInfo( ( TaskHandle_t ) pxNextTCB, &( pxTaskStatusArray[ uxTask ] ), pdTRUE, eState );
                 uxTask++;
             } while( pxNextTCB != pxFirstTCB );
@@ -3950,6 +6919,20 @@ static void prvCheckTasksWaitingTermination( void )
          * want to allocate and clean RAM statically. */
         portCLEAN_UP_TCB( pxTCB );
 
+        #if ( configUSE_STACK_TIERING == 1 )
+        {
+            /* Free the stack the task was created with rather than its slot. */
+            if( pxTCB->pxStackBackingStore != NULL )
+            {
+                pxTCB->pxStack = pxTCB->pxStackBackingStore;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif
+
         #if ( ( configUSE_NEWLIB_REENTRANT == 1 ) || ( configUSE_C_RUNTIME_TLS_SUPPORT == 1 ) )
         {
             /* Free up the memory allocated for the task's TLS Block. */
@@ -3966,55 +6949,223 @@ static void prvCheckTasksWaitingTermination( void )
         }
         #elif ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 ) /*lint !e731 !e9029 Macro has been consolidated for readability reasons. */
         {
-            /* The task could have been allocated statically or dynamically, so
-             * check what was statically allocated before trying to free the
-             * memory. */
-            if( pxTCB->ucStaticallyAllocated == tskDYNAMICALLY_ALLOCATED_STACK_AND_TCB )
+            /* The task could have been allocated statically or dynamically, so
+             * check what was statically allocated before trying to free the
+             * memory. */
+            if( pxTCB->ucStaticallyAllocated == tskDYNAMICALLY_ALLOCATED_STACK_AND_TCB )
+            {
+                /* Both the stack and TCB were allocated dynamically, so both
+                 * must be freed. */
+                vPortFreeStack( pxTCB->pxStack );
+                vPortFree( pxTCB );
+            }
+            else if( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_ONLY )
+            {
+                /* Only the stack was statically allocated, so the TCB is the
+                 * only memory that must be freed. */
+                vPortFree( pxTCB );
+            }
+            else
+            {
+                /* Neither the stack nor the TCB were allocated dynamically, so
+                 * nothing needs to be freed. */
+                configASSERT( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_AND_TCB );
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+    }
+
+#endif /* INCLUDE_vTaskDelete */
+/*-----------------------------------------------------------*/
+
+static void prvResetNextTaskUnblockTime( void )
+{
+    if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
+    {
+        /* The new current delayed list is empty.  Set xNextTaskUnblockTime to
+         * the maximum possible value so it is  extremely unlikely that the
+         * if( xTickCount >= xNextTaskUnblockTime ) test will pass until
+         * there is an item in the delayed list. */
+        xNextTaskUnblockTime = portMAX_DELAY;
+    }
+    else
+    {
+        /* The new current delayed list is not empty, get the value of
+         * the item at the head of the delayed list.  This is the time at
+         * which the task at the head of the delayed list should be removed
+         * from the Blocked state. */
+        xNextTaskUnblockTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxDelayedTaskList );
+    }
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_DEADLINE_TIMERS == 1 )
+
+    static void prvInsertDeadlineTimer( DeadlineTimer_t * pxTimer,
+                                        TickType_t xExpiry,
+                                        TickType_t xBase )
+    {
+        listSET_LIST_ITEM_VALUE( &( pxTimer->xDeadlineListItem ), xExpiry );
+
+        if( xExpiry < xBase )
+        {
+            /* The expiry time has wrapped, so the timer goes in the overflow
+             * list, in the same way as a task whose wake time has wrapped. */
+            vListInsert( pxOverflowDelayedTaskList, &( pxTimer->xDeadlineListItem ) );
+        }
+        else
+        {
+            vListInsert( pxDelayedTaskList, &( pxTimer->xDeadlineListItem ) );
+
+            if( xExpiry < xNextTaskUnblockTime )
+            {
+                xNextTaskUnblockTime = xExpiry;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+    }
+
+#endif /* configUSE_DEADLINE_TIMERS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_DEADLINE_TIMERS == 1 )
+
+    static void prvStartDeadlineTimer( DeadlineTimer_t * pxTimer,
+                                       TickType_t xDelay,
+                                       TickType_t xPeriod )
+    {
+        TickType_t xConstTickCount;
+
+        /* The expiry is calculated from the tick count, which must be brought
+         * up to date first. */
+        taskEXIT_ADAPTIVE_TICK();
+
+        xConstTickCount = xTickCount;
+
+        if( listLIST_ITEM_CONTAINER( &( pxTimer->xDeadlineListItem ) ) != NULL )
+        {
+            listREMOVE_ITEM( &( pxTimer->xDeadlineListItem ) );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        /* A request still pending from an interrupt is older than this one. */
+        if( pxTimer->ucRequest != taskDEADLINE_TIMER_NO_REQUEST )
+        {
+            pxTimer->ucRequest = taskDEADLINE_TIMER_REQUEST_DISCARDED;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        pxTimer->xPeriod = xPeriod;
+        prvInsertDeadlineTimer( pxTimer, xConstTickCount + xDelay, xConstTickCount );
+    }
+
+#endif /* configUSE_DEADLINE_TIMERS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_DEADLINE_TIMERS == 1 )
+
+    static void prvStopDeadlineTimer( DeadlineTimer_t * pxTimer )
+    {
+        if( listLIST_ITEM_CONTAINER( &( pxTimer->xDeadlineListItem ) ) != NULL )
+        {
+            listREMOVE_ITEM( &( pxTimer->xDeadlineListItem ) );
+
+            /* The timer may have been the next item due, and the tickless idle
+             * code should not wake for it. */
+            prvResetNextTaskUnblockTime();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( pxTimer->ucRequest != taskDEADLINE_TIMER_NO_REQUEST )
+        {
+            pxTimer->ucRequest = taskDEADLINE_TIMER_REQUEST_DISCARDED;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+#endif /* configUSE_DEADLINE_TIMERS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_DEADLINE_TIMERS == 1 )
+
+    static BaseType_t prvExpireDeadlineTimer( DeadlineTimer_t * pxTimer )
+    {
+        BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+        const TickType_t xExpiry = listGET_LIST_ITEM_VALUE( &( pxTimer->xDeadlineListItem ) );
+
+        listREMOVE_ITEM( &( pxTimer->xDeadlineListItem ) );
+
+        /* Re-arm a periodic timer from its expiry time rather than the tick
+         * count so it does not drift, and before calling the callback so the
+         * callback can stop or restart it.  If expiries were missed the next
+         * one is already due, and is handled by the same pass of the delayed
+         * list. */
+        if( pxTimer->xPeriod != ( TickType_t ) 0U )
+        {
+            prvInsertDeadlineTimer( pxTimer, xExpiry + pxTimer->xPeriod, xExpiry );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        pxTimer->pxCallback( pxTimer, &xHigherPriorityTaskWoken );
+
+        return xHigherPriorityTaskWoken;
+    }
+
+#endif /* configUSE_DEADLINE_TIMERS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_DEADLINE_TIMERS == 1 )
+
+    static void prvProcessDeadlineTimerRequests( void )
+    {
+        DeadlineTimer_t * pxTimer;
+        uint8_t ucRequest;
+
+        while( pxDeadlineTimerRequests != NULL )
+        {
+            pxTimer = pxDeadlineTimerRequests;
+            pxDeadlineTimerRequests = pxTimer->pxNextRequest;
+            pxTimer->pxNextRequest = NULL;
+
+            ucRequest = pxTimer->ucRequest;
+            pxTimer->ucRequest = taskDEADLINE_TIMER_NO_REQUEST;
+
+            if( ucRequest == taskDEADLINE_TIMER_START_REQUESTED )
             {
-                /* Both the stack and TCB were allocated dynamically, so both
-                 * must be freed. */
-                vPortFreeStack( pxTCB->pxStack );
-                vPortFree( pxTCB );
+                prvStartDeadlineTimer( pxTimer, pxTimer->xRequestDelay, pxTimer->xRequestPeriod );
             }
-            else if( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_ONLY )
+            else if( ucRequest == taskDEADLINE_TIMER_STOP_REQUESTED )
             {
-                /* Only the stack was statically allocated, so the TCB is the
-                 * only memory that must be freed. */
-                vPortFree( pxTCB );
+                prvStopDeadlineTimer( pxTimer );
             }
             else
             {
-                /* Neither the stack nor the TCB were allocated dynamically, so
-                 * nothing needs to be freed. */
-                configASSERT( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_AND_TCB );
+                /* Overtaken by a request made from a task. */
                 mtCOVERAGE_TEST_MARKER();
             }
         }
-        #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
     }
 
-#endif /* INCLUDE_vTaskDelete */
-/*-----------------------------------------------------------*/
-
-static void prvResetNextTaskUnblockTime( void )
-{
-    if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
-    {
-        /* The new current delayed list is empty.  Set xNextTaskUnblockTime to
-         * the maximum possible value so it is  extremely unlikely that the
-         * if( xTickCount >= xNextTaskUnblockTime ) test will pass until
-         * there is an item in the delayed list. */
-        xNextTaskUnblockTime = portMAX_DELAY;
-    }
-    else
-    {
-        /* The new current delayed list is not empty, get the value of
-         * the item at the head of the delayed list.  This is the time at
-         * which the task at the head of the delayed list should be removed
-         * from the Blocked state. */
-        xNextTaskUnblockTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxDelayedTaskList );
-    }
-}
+#endif /* configUSE_DEADLINE_TIMERS */
 /*-----------------------------------------------------------*/
 
 #if ( ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) || ( configUSE_MUTEXES == 1 ) )
@@ -4119,6 +7270,16 @@ static void prvResetNextTaskUnblockTime( void )
 
                 traceTASK_PRIORITY_INHERIT( pxMutexHolderTCB, pxCurrentTCB->uxPriority );
 
+                #if ( configUSE_PRIORITY_INHERITANCE_CHAIN == 1 )
+                {
+                    /* The mutex holder might itself be blocked on a mutex held
+                     * by a lower priority task, in which case that task must
+                     * inherit the priority too or the mutex holder can still be
+                     * held up by medium priority tasks. */
+                    prvPropagateInheritedPriority( pxMutexHolderTCB, pxCurrentTCB->uxPriority );
+                }
+                #endif
+
                 /* Inheritance occurred. */
                 xReturn = pdTRUE;
             }
@@ -4318,6 +7479,14 @@ static void prvResetNextTaskUnblockTime( void )
                     {
                         mtCOVERAGE_TEST_MARKER();
                     }
+
+                    #if ( configUSE_PRIORITY_INHERITANCE_CHAIN == 1 )
+                    {
+                        /* Any tasks further along the chain only inherited the
+                         * priority through this task, so can drop too. */
+                        prvUnwindInheritedPriority( pxTCB );
+                    }
+                    #endif
                 }
                 else
                 {
@@ -4338,6 +7507,189 @@ static void prvResetNextTaskUnblockTime( void )
 #endif /* configUSE_MUTEXES */
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_PRIORITY_INHERITANCE_CHAIN == 1 )
+
+    static void prvResortMutexWaiter( TCB_t * pxTCB )
+    {
+        List_t * pxWaitList;
+
+        if( prvTaskIsBlockedOnMutex( pxTCB ) != pdFALSE )
+        {
+            pxWaitList = listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) );
+            ( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+            vListInsert( pxWaitList, &( pxTCB->xEventListItem ) );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+#endif /* configUSE_PRIORITY_INHERITANCE_CHAIN */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_PRIORITY_INHERITANCE_CHAIN == 1 )
+
+    static void prvSetChainedPriority( TCB_t * pxTCB,
+                                       UBaseType_t uxNewPriority )
+    {
+        /* Only reset the event list item value if the value is not being used
+         * for anything else. */
+        if( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
+        {
+            listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxNewPriority ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxTCB->uxPriority ] ), &( pxTCB->xStateListItem ) ) != pdFALSE )
+        {
+            if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+            {
+                portRESET_READY_PRIORITY( pxTCB->uxPriority, uxTopReadyPriority );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxTCB->uxPriority = uxNewPriority;
+            prvAddTaskToReadyList( pxTCB );
+        }
+        else
+        {
+            pxTCB->uxPriority = uxNewPriority;
+            prvResortMutexWaiter( pxTCB );
+        }
+    }
+
+#endif /* configUSE_PRIORITY_INHERITANCE_CHAIN */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_PRIORITY_INHERITANCE_CHAIN == 1 )
+
+    static void prvPropagateInheritedPriority( TCB_t * pxMutexHolderTCB,
+                                               UBaseType_t uxPriority )
+    {
+        TCB_t * pxTCB = pxMutexHolderTCB;
+        TCB_t * pxNextTCB;
+        UBaseType_t uxDepth = ( UBaseType_t ) 1U;
+
+        /* The caller has already raised the priority of the direct mutex
+         * holder, but not its position in any mutex wait list. */
+        prvResortMutexWaiter( pxTCB );
+
+        while( ( uxDepth < ( UBaseType_t ) configMAX_PRIORITY_INHERITANCE_CHAIN_DEPTH ) &&
+               ( prvTaskIsBlockedOnMutex( pxTCB ) != pdFALSE ) )
+        {
+            pxNextTCB = xQueueGetMutexHolderFromISR( ( QueueHandle_t ) pxTCB->pvBlockedOnMutex );
+
+            /* Stop at the end of the chain, at a task that already runs at the
+             * required priority, or if the chain leads back to the calling task
+             * (which can only happen if the application has deadlocked). */
+            if( ( pxNextTCB == NULL ) || ( pxNextTCB == pxCurrentTCB ) || ( pxNextTCB->uxPriority >= uxPriority ) )
+            {
+                break;
+            }
+
+            prvSetChainedPriority( pxNextTCB, uxPriority );
+            traceTASK_PRIORITY_INHERIT( pxNextTCB, uxPriority );
+
+            pxTCB = pxNextTCB;
+            uxDepth++;
+        }
+
+        if( uxDepth > uxInheritanceChainHighWaterMark )
+        {
+            uxInheritanceChainHighWaterMark = uxDepth;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+#endif /* configUSE_PRIORITY_INHERITANCE_CHAIN */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_PRIORITY_INHERITANCE_CHAIN == 1 )
+
+    static void prvUnwindInheritedPriority( TCB_t * pxMutexHolderTCB )
+    {
+        TCB_t * pxTCB = pxMutexHolderTCB;
+        TCB_t * pxNextTCB;
+        List_t * pxWaitList;
+        UBaseType_t uxPriorityToUse;
+        UBaseType_t uxDepth = ( UBaseType_t ) 1U;
+
+        prvResortMutexWaiter( pxTCB );
+
+        while( ( uxDepth < ( UBaseType_t ) configMAX_PRIORITY_INHERITANCE_CHAIN_DEPTH ) &&
+               ( prvTaskIsBlockedOnMutex( pxTCB ) != pdFALSE ) )
+        {
+            pxNextTCB = xQueueGetMutexHolderFromISR( ( QueueHandle_t ) pxTCB->pvBlockedOnMutex );
+
+            /* As in vTaskPriorityDisinheritAfterTimeout(), a task that holds
+             * more than one mutex keeps its priority as the other mutexes may
+             * be the reason it was raised. */
+            if( ( pxNextTCB == NULL ) || ( pxNextTCB == pxCurrentTCB ) || ( pxNextTCB->uxMutexesHeld != ( UBaseType_t ) 1 ) )
+            {
+                break;
+            }
+
+            /* pxTCB is in the wait list, so the list is not empty and its head
+             * entry is the highest priority task still waiting for the mutex. */
+            pxWaitList = listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) );
+            uxPriorityToUse = ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxWaitList );
+
+            if( uxPriorityToUse < pxNextTCB->uxBasePriority )
+            {
+                uxPriorityToUse = pxNextTCB->uxBasePriority;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( pxNextTCB->uxPriority <= uxPriorityToUse )
+            {
+                break;
+            }
+
+            traceTASK_PRIORITY_DISINHERIT( pxNextTCB, uxPriorityToUse );
+            prvSetChainedPriority( pxNextTCB, uxPriorityToUse );
+
+            pxTCB = pxNextTCB;
+            uxDepth++;
+        }
+    }
+
+#endif /* configUSE_PRIORITY_INHERITANCE_CHAIN */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_PRIORITY_INHERITANCE_CHAIN == 1 )
+
+    void vTaskSetBlockedOnMutex( void * pvMutex )
+    {
+        /* Only called from within a critical section by the running task. */
+        pxCurrentTCB->pvBlockedOnMutex = pvMutex;
+    }
+
+#endif /* configUSE_PRIORITY_INHERITANCE_CHAIN */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_PRIORITY_INHERITANCE_CHAIN == 1 )
+
+    UBaseType_t uxTaskGetPriorityInheritanceChainDepth( void )
+    {
+        return uxInheritanceChainHighWaterMark;
+    }
+
+#endif /* configUSE_PRIORITY_INHERITANCE_CHAIN */
+/*-----------------------------------------------------------*/
+
 #if ( portCRITICAL_NESTING_IN_TCB == 1 )
 
     void vTaskEnterCritical( void )
@@ -4844,6 +8196,138 @@ TickType_t uxTaskResetEventItemValue( void )
 #endif /* configUSE_TASK_NOTIFICATIONS */
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_TASK_NOTIFY_WAIT_BITS == 1 )
+
+    static BaseType_t prvNotifyWaitConditionMet( const TCB_t * const pxTCB,
+                                                 UBaseType_t uxIndex )
+    {
+        const uint32_t ulSetBits = pxTCB->ulNotifiedValue[ uxIndex ] & pxTCB->ulNotifyWaitBits;
+        BaseType_t xReturn;
+
+        if( pxTCB->ulNotifyWaitBits == 0UL )
+        {
+            /* Not waiting for particular bits, so any notification will do. */
+            xReturn = pdTRUE;
+        }
+        else if( pxTCB->xNotifyWaitForAllBits == pdFALSE )
+        {
+            xReturn = ( ulSetBits != 0UL ) ? pdTRUE : pdFALSE;
+        }
+        else
+        {
+            xReturn = ( ulSetBits == pxTCB->ulNotifyWaitBits ) ? pdTRUE : pdFALSE;
+        }
+
+        return xReturn;
+    }
+
+#endif /* configUSE_TASK_NOTIFY_WAIT_BITS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TASK_NOTIFY_WAIT_BITS == 1 )
+
+    static uint8_t prvFilterNotifyWaitBits( TCB_t * const pxTCB,
+                                            UBaseType_t uxIndex,
+                                            uint8_t ucOriginalNotifyState )
+    {
+        uint8_t ucReturn = ucOriginalNotifyState;
+
+        /* A task waiting for particular bits stays blocked, still waiting,
+         * until the notification value holds them. */
+        if( ( ucOriginalNotifyState == taskWAITING_NOTIFICATION ) &&
+            ( prvNotifyWaitConditionMet( pxTCB, uxIndex ) == pdFALSE ) )
+        {
+            pxTCB->ucNotifyState[ uxIndex ] = taskWAITING_NOTIFICATION;
+            ucReturn = taskNOT_WAITING_NOTIFICATION;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return ucReturn;
+    }
+
+#endif /* configUSE_TASK_NOTIFY_WAIT_BITS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TASK_NOTIFY_WAIT_BITS == 1 )
+
+    uint32_t ulTaskGenericNotifyWaitBits( UBaseType_t uxIndexToWait,
+                                          uint32_t ulBitsToWaitFor,
+                                          BaseType_t xClearOnExit,
+                                          BaseType_t xWaitForAllBits,
+                                          TickType_t xTicksToWait )
+    {
+        uint32_t ulReturn;
+
+        configASSERT( uxIndexToWait < configTASK_NOTIFICATION_ARRAY_ENTRIES );
+        configASSERT( ulBitsToWaitFor != 0UL );
+
+        taskENTER_CRITICAL();
+        {
+            /* Notifiers check these before unblocking the task. */
+            pxCurrentTCB->ulNotifyWaitBits = ulBitsToWaitFor;
+            pxCurrentTCB->xNotifyWaitForAllBits = xWaitForAllBits;
+
+            /* Only block if the bits are not already set. */
+            if( prvNotifyWaitConditionMet( pxCurrentTCB, uxIndexToWait ) == pdFALSE )
+            {
+                /* Mark this task as waiting for a notification. */
+                pxCurrentTCB->ucNotifyState[ uxIndexToWait ] = taskWAITING_NOTIFICATION;
+
+                if( xTicksToWait > ( TickType_t ) 0 )
+                {
+                    prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
+                    traceTASK_NOTIFY_WAIT_BLOCK( uxIndexToWait );
+
+                    /* All ports are written to allow a yield in a critical
+                     * section (some will yield immediately, others wait until the
+                     * critical section exits) - but it is not something that
+                     * application code should ever do. */
+                    portYIELD_WITHIN_API();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        taskENTER_CRITICAL();
+        {
+            traceTASK_NOTIFY_WAIT( uxIndexToWait );
+
+            /* The task either did not block, was unblocked because the bits
+             * were set, or timed out.  Only clear the bits in the first two
+             * cases. */
+            ulReturn = pxCurrentTCB->ulNotifiedValue[ uxIndexToWait ];
+
+            if( ( xClearOnExit != pdFALSE ) && ( prvNotifyWaitConditionMet( pxCurrentTCB, uxIndexToWait ) != pdFALSE ) )
+            {
+                pxCurrentTCB->ulNotifiedValue[ uxIndexToWait ] &= ~ulBitsToWaitFor;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxCurrentTCB->ucNotifyState[ uxIndexToWait ] = taskNOT_WAITING_NOTIFICATION;
+            pxCurrentTCB->ulNotifyWaitBits = 0UL;
+        }
+        taskEXIT_CRITICAL();
+
+        return ulReturn;
+    }
+
+#endif /* configUSE_TASK_NOTIFY_WAIT_BITS */
+/*-----------------------------------------------------------*/
+
 #if ( configUSE_TASK_NOTIFICATIONS == 1 )
 
     BaseType_t xTaskGenericNotify( TaskHandle_t xTaskToNotify,
@@ -4917,6 +8401,12 @@ TickType_t uxTaskResetEventItemValue( void )
 
             traceTASK_NOTIFY( uxIndexToNotify );
 
+            #if ( configUSE_TASK_NOTIFY_WAIT_BITS == 1 )
+            {
+                ucOriginalNotifyState = prvFilterNotifyWaitBits( pxTCB, uxIndexToNotify, ucOriginalNotifyState );
+            }
+            #endif /* configUSE_TASK_NOTIFY_WAIT_BITS */
+
             /* If the task is in the blocked state specifically to wait for a
              * notification then unblock it now. */
             if( ucOriginalNotifyState == taskWAITING_NOTIFICATION )
@@ -5059,6 +8549,12 @@ TickType_t uxTaskResetEventItemValue( void )
 
             traceTASK_NOTIFY_FROM_ISR( uxIndexToNotify );
 
+            #if ( configUSE_TASK_NOTIFY_WAIT_BITS == 1 )
+            {
+                ucOriginalNotifyState = prvFilterNotifyWaitBits( pxTCB, uxIndexToNotify, ucOriginalNotifyState );
+            }
+            #endif /* configUSE_TASK_NOTIFY_WAIT_BITS */
+
             /* If the task is in the blocked state specifically to wait for a
              * notification then unblock it now. */
             if( ucOriginalNotifyState == taskWAITING_NOTIFICATION )
@@ -5150,6 +8646,12 @@ TickType_t uxTaskResetEventItemValue( void )
 
             traceTASK_NOTIFY_GIVE_FROM_ISR( uxIndexToNotify );
 
+            #if ( configUSE_TASK_NOTIFY_WAIT_BITS == 1 )
+            {
+                ucOriginalNotifyState = prvFilterNotifyWaitBits( pxTCB, uxIndexToNotify, ucOriginalNotifyState );
+            }
+            #endif /* configUSE_TASK_NOTIFY_WAIT_BITS */
+
             /* If the task is in the blocked state specifically to wait for a
              * notification then unblock it now. */
             if( ucOriginalNotifyState == taskWAITING_NOTIFICATION )
@@ -5298,7 +8800,11 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
                                             const BaseType_t xCanBlockIndefinitely )
 {
     TickType_t xTimeToWake;
-    const TickType_t xConstTickCount = xTickCount;
+    TickType_t xConstTickCount;
+
+    /* The wake time is relative to the current time. */
+    taskEXIT_ADAPTIVE_TICK();
+    xConstTickCount = xTickCount;
 
     #if ( INCLUDE_xTaskAbortDelay == 1 )
     {
@@ -352,6 +352,44 @@
     #endif /* configSUPPORT_STATIC_ALLOCATION */
 /*-----------------------------------------------------------*/
 
+    TimerHandle_t xTimerInitIntrusive( StaticTimer_t * pxTimerNode,
+                                       const char * const pcTimerName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+                                       const TickType_t xTimerPeriodInTicks,
+                                       const BaseType_t xAutoReload,
+                                       TimerCallbackFunction_t pxCallbackFunction )
+    {
+        Timer_t * pxNewTimer;
+
+        #if ( configASSERT_DEFINED == 1 )
+        {
+            /* Sanity check that the size of the structure used to declare a
+             * variable of type StaticTimer_t equals the size of the real timer
+             * structure. */
+            volatile size_t xSize = sizeof( StaticTimer_t );
+            configASSERT( xSize == sizeof( Timer_t ) );
+            ( void ) xSize; /* Keeps lint quiet when configASSERT() is not defined. */
+        }
+        #endif /* configASSERT_DEFINED */
+
+        configASSERT( pxTimerNode );
+        pxNewTimer = ( Timer_t * ) pxTimerNode; /*lint !e740 !e9087 StaticTimer_t is a pointer to a Timer_t, so guaranteed to be aligned and sized correctly (checked by an assert()), so this is safe. */
+
+        if( pxNewTimer != NULL )
+        {
+            /* The memory belongs to a structure owned by the application, so
+             * is marked as statically allocated to ensure the timer task never
+             * attempts to free it when the timer is deleted.  The callback
+             * finds its context from the address of the timer rather than from
+             * the ID. */
+            pxNewTimer->ucStatus = tmrSTATUS_IS_STATICALLY_ALLOCATED;
+
+            prvInitialiseNewTimer( pcTimerName, xTimerPeriodInTicks, xAutoReload, NULL, pxCallbackFunction, pxNewTimer );
+        }
+
+        return pxNewTimer;
+    }
+/*-----------------------------------------------------------*/
+
     static void prvInitialiseNewTimer( const char * const pcTimerName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
                                        const TickType_t xTimerPeriodInTicks,
                                        const BaseType_t xAutoReload,
@@ -91,6 +91,15 @@ typedef void (* TimerCallbackFunction_t)( TimerHandle_t xTimer );
 typedef void (* PendedFunction_t)( void *,
                                    uint32_t );
 
+/*
+ * Used with timers initialised by xTimerInitIntrusive().  timerHANDLE_FROM_NODE()
+ * returns the handle of the timer held in a StaticTimer_t, and
+ * timerCONTAINER_OF() returns a pointer to the structure of the given type in
+ * which the timer referenced by xTimer is embedded as the given member.
+ */
+#define timerHANDLE_FROM_NODE( pxTimerNode )         ( ( TimerHandle_t ) ( pxTimerNode ) )
+#define timerCONTAINER_OF( xTimer, type, member )    ( ( type * ) ( void * ) ( ( ( uint8_t * ) ( xTimer ) ) - offsetof( type, member ) ) )
+
 /**
  * TimerHandle_t xTimerCreate(  const char * const pcTimerName,
  *                              TickType_t xTimerPeriodInTicks,
@@ -367,6 +376,83 @@ typedef void (* PendedFunction_t)( void *,
                                       StaticTimer_t * pxTimerBuffer ) PRIVILEGED_FUNCTION;
 #endif /* configSUPPORT_STATIC_ALLOCATION */
 
+/**
+ * TimerHandle_t xTimerInitIntrusive( StaticTimer_t * pxTimerNode,
+ *                                    const char * const pcTimerName,
+ *                                    TickType_t xTimerPeriodInTicks,
+ *                                    BaseType_t xAutoReload,
+ *                                    TimerCallbackFunction_t pxCallbackFunction );
+ *
+ * Initialise a software timer in place within a StaticTimer_t that is a member
+ * of an application structure.  No memory is allocated, and the timer does not
+ * need an ID, as the callback function can use timerCONTAINER_OF() to obtain
+ * the structure in which the timer is embedded.  Unlike xTimerCreateStatic(),
+ * this function is available whatever the value of
+ * configSUPPORT_STATIC_ALLOCATION.
+ *
+ * The returned handle is the address of the StaticTimer_t, so
+ * timerHANDLE_FROM_NODE() can be used to obtain it again, rather than storing
+ * it.  The timer is started, stopped and reset with the standard API functions,
+ * none of which allocate memory.  xTimerDelete() never frees the memory of an
+ * intrusive timer - it only stops the timer, after which it can be initialised
+ * again.  A timer must not be initialised again while it is active, or while a
+ * command for it is still in the timer command queue.
+ *
+ * @param pxTimerNode The StaticTimer_t in which the timer is held.
+ *
+ * @param pcTimerName A text name that is assigned to the timer.  This is done
+ * purely to assist debugging.
+ *
+ * @param xTimerPeriodInTicks The timer period, which must be greater than 0.
+ *
+ * @param xAutoReload If set to pdTRUE the timer expires repeatedly with a
+ * frequency set by xTimerPeriodInTicks.  If set to pdFALSE the timer is a
+ * one-shot timer.
+ *
+ * @param pxCallbackFunction The function to call when the timer expires.
+ *
+ * @return The handle of the timer.
+ *
+ * Example usage:
+ * @verbatim
+ * typedef struct
+ * {
+ *     uint32_t ulSequence;
+ *     StaticTimer_t xRetransmitTimer;
+ * } Connection_t;
+ *
+ * static Connection_t xConnections[ 512 ];
+ *
+ * static void prvRetransmit( TimerHandle_t xTimer )
+ * {
+ *     Connection_t * pxConnection = timerCONTAINER_OF( xTimer, Connection_t, xRetransmitTimer );
+ *
+ *     // Resend the unacknowledged data for pxConnection here.
+ * }
+ *
+ * void vInitialiseConnections( void )
+ * {
+ *     size_t x;
+ *
+ *     for( x = 0; x < 512; x++ )
+ *     {
+ *         ( void ) xTimerInitIntrusive( &( xConnections[ x ].xRetransmitTimer ), "RTX", pdMS_TO_TICKS( 200 ), pdFALSE, prvRetransmit );
+ *     }
+ * }
+ *
+ * void vDataSent( Connection_t * pxConnection )
+ * {
+ *     // Arm, or re-arm, the retransmit timer.
+ *     xTimerReset( timerHANDLE_FROM_NODE( &( pxConnection->xRetransmitTimer ) ), 0 );
+ * }
+ * @endverbatim
+ */
+TimerHandle_t xTimerInitIntrusive( StaticTimer_t * pxTimerNode,
+                                   const char * const pcTimerName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+                                   const TickType_t xTimerPeriodInTicks,
+                                   const BaseType_t xAutoReload,
+                                   TimerCallbackFunction_t pxCallbackFunction ) PRIVILEGED_FUNCTION;
+
 /**
  * void *pvTimerGetTimerID( TimerHandle_t xTimer );
  *